@@ -16,22 +16,33 @@
 #endif //__cplusplus
 
 #include "mt_chess_data.h"
+#include "mt_chess_game.h"
+#include "mt_chess_mem.h"
 #include "mt_chess_piece.h"
 #include "mt_chess_color.h"
 #include "mt_chess_type.h"
 #include "mt_chess_col.h"
 #include "mt_chess.h"
-#include "mt_chess_log_node.h"
 #include "mt_chess_move.h"
+#include "mt_chess_movegen.h"
+#include "mt_chess_pos.h"
 #include "mt_chess_str.h"
+#include "mt_chess_check.h"
+#include "mt_chess_bit.h"
+#include "mt_chess_line.h"
+#include "mt_chess_stats.h"
+#include "mt_chess_latency.h"
+#include "mt_chess_hist.h"
 
-static struct mt_chess_data * s_data = NULL;
+static struct mt_chess_game * s_game = NULL;
 
 static bool is_move_allowed_king(
+    struct mt_chess_data const * const data,
     struct mt_chess_pos const * const from,
     struct mt_chess_pos const * const to,
     char const * * const out_msg)
 {
+    assert(data != NULL);
     assert(from != NULL && !mt_chess_pos_is_invalid(from));
     assert(to != NULL && !mt_chess_pos_is_invalid(to));
     assert(out_msg != NULL);
@@ -84,7 +95,7 @@ static bool is_move_allowed_king(
 
         // Is the straight horizontal two square move allowed on current rank?
 
-        uint8_t const start_row = s_data->turn == mt_chess_color_white
+        uint8_t const start_row = data->turn == mt_chess_color_white
             ? (uint8_t)mt_chess_row_1 : (uint8_t)mt_chess_row_8;
 
         if(from/*to*/->row != start_row)
@@ -99,30 +110,32 @@ static bool is_move_allowed_king(
                 from->row * ((int)mt_chess_col_h + 1) + from->col;
         assert(0 <= board_index_king && board_index_king < 8 * 8);
 
-        uint8_t const piece_id_king = s_data->board[board_index_king];
+        uint8_t const piece_id_king = data->board[board_index_king];
 
         int const piece_index_king = mt_chess_piece_get_index(
-                s_data->pieces, piece_id_king);
+                data->pieces, piece_id_king);
 
         struct mt_chess_piece const * const piece_king =
-            &s_data->pieces[piece_index_king];
+            &data->pieces[piece_index_king];
 
         assert(piece_king->type == mt_chess_type_king);
-        assert(piece_king->color == s_data->turn);
-
-        // Is this the king's initial move?
-        
-        // Not performance-optimized (but should be OK, here):
-        struct mt_chess_log_node * const last_log_node_king =
-            mt_chess_log_node_get_latest_of_piece(s_data->log, piece_king->id);
-
-        if(last_log_node_king != NULL)
+        assert(piece_king->color == data->turn);
+
+        // Did the king not move, yet (both castling rights of its color are
+        // lost, as soon as the king moves)?
+
+        uint8_t const castling_kingside =
+            data->turn == mt_chess_color_white
+            ? MT_CHESS_DATA_CASTLING_WHITE_KINGSIDE
+            : MT_CHESS_DATA_CASTLING_BLACK_KINGSIDE;
+        uint8_t const castling_queenside =
+            data->turn == mt_chess_color_white
+            ? MT_CHESS_DATA_CASTLING_WHITE_QUEENSIDE
+            : MT_CHESS_DATA_CASTLING_BLACK_QUEENSIDE;
+
+        if((data->castling
+                & (castling_kingside | castling_queenside)) == 0)
         {
-            assert(last_log_node_king->move.piece.id == piece_king->id);
-            assert(last_log_node_king->move.piece.type == mt_chess_type_king);
-            assert(last_log_node_king->move.piece.color = s_data->turn);
-            assert(mt_chess_pos_are_equal(&last_log_node_king->move.to, from));
-
             *out_msg = "This is not the king's first move, castling not possible.";
             return false;
         }
@@ -144,7 +157,8 @@ static bool is_move_allowed_king(
 
         // Get what may be the rook's piece ID, from the board:
 
-        uint8_t const board_rook_piece_id = s_data->board[board_index_rook];
+        uint8_t const board_rook_piece_id =
+            data->board[board_index_rook];
 
         // Is there a piece on the rook position necessary for castling?
 
@@ -163,11 +177,11 @@ static bool is_move_allowed_king(
         // Get object of piece that resides at the rook castling square:
 
         int const rook_piece_index = mt_chess_piece_get_index(
-                s_data->pieces, board_rook_piece_id);
+                data->pieces, board_rook_piece_id);
         assert(0 < rook_piece_index);
 
         struct mt_chess_piece const * const rook_piece =
-            s_data->pieces + rook_piece_index;
+            data->pieces + rook_piece_index;
         assert(rook_piece->id == board_rook_piece_id);
 
         // Is it actually a rook at the position for castling?
@@ -186,7 +200,7 @@ static bool is_move_allowed_king(
 
         // Is the rook at the castling position the current player's?
 
-        if(rook_piece->color != s_data->turn)
+        if(rook_piece->color != data->turn)
         {
             if(rook_col == rook_col_short)
             {
@@ -200,25 +214,13 @@ static bool is_move_allowed_king(
 
         // Did the rook not move (on its own), yet?
 
-        // (this code is OK, even, if rook was implicitly moved before via
-        //  already done castling, because then the kind's-first-move check
-        //  will fail)
+        // (the castling right is lost, as soon as the rook moves or is caught,
+        //  so the rook is the original one, if the right is still available)
 
-        // Not performance-optimized (but should be OK, here):
-        struct mt_chess_log_node * const last_log_node_rook =
-            mt_chess_log_node_get_latest_of_piece(
-                s_data->log, rook_piece->id);
-
-        if(last_log_node_rook != NULL)
+        if((data->castling
+                & (rook_col == rook_col_short
+                    ? castling_kingside : castling_queenside)) == 0)
         {
-            assert(last_log_node_rook->move.piece.id == rook_piece->id);
-            assert(
-                last_log_node_rook->move.piece.type == mt_chess_type_rook);
-            assert(last_log_node_rook->move.piece.color = s_data->turn);
-            assert(
-                last_log_node_rook->move.to.row == rook_col
-                    && last_log_node_rook->move.to.col == from/*to*/->row);
-
             *out_msg = "This rook was already moved, castling not possible.";
             return false;
         }
@@ -231,7 +233,7 @@ static bool is_move_allowed_king(
 
             // Is the square of file F empty?
 
-            if(s_data->board[board_index_king + 1] != 0)
+            if(data->board[board_index_king + 1] != 0)
             {
                 *out_msg = "Square of file F is not empty, kingside castling not possible.";
                 return false;
@@ -239,7 +241,7 @@ static bool is_move_allowed_king(
         
             // Is the square of file G empty?
 
-            if(s_data->board[board_index_king + 2] != 0)
+            if(data->board[board_index_king + 2] != 0)
             {
                 *out_msg = "Square of file G is not empty, kingside castling not possible.";
                 return false;
@@ -252,7 +254,7 @@ static bool is_move_allowed_king(
 
             // Is the square of file B empty?
             
-            if(s_data->board[board_index_rook + 1] != 0)
+            if(data->board[board_index_rook + 1] != 0)
             {
                 *out_msg = "Square of file B is not empty, queenside castling not possible.";
                 return false;
@@ -260,7 +262,7 @@ static bool is_move_allowed_king(
 
             // Is the square of file C empty?
 
-            if(s_data->board[board_index_rook + 2] != 0)
+            if(data->board[board_index_rook + 2] != 0)
             {
                 *out_msg = "Square of file C is not empty, queenside castling not possible.";
                 return false;
@@ -268,17 +270,31 @@ static bool is_move_allowed_king(
 
             // Is the square of file D empty?
 
-            if(s_data->board[board_index_rook + 3] != 0)
+            if(data->board[board_index_rook + 3] != 0)
             {
                 *out_msg = "Square of file D is not empty, queenside castling not possible.";
                 return false;
             }
         }
 
-        // TODO:
-        // - Is the king not attacked on the from-square?
-        // - Is the square the king crosses not attacked?
-        // [- Not necessary to check, here: Is to-square not attacked?]
+        // Is the king not in check and does it not cross an attacked square?
+        // [not necessary to check, here: Is to-square not attacked? (this is
+        //  checked for all king moves by is_move_allowed())]
+
+        if(data->check.checkers != 0)
+        {
+            *out_msg = "The king is in check, castling not possible.";
+            return false;
+        }
+
+        int const crossed_board_index = board_index_king + horiz_dist_val / 2;
+
+        if((data->check.danger
+                & MT_CHESS_BIT_SQUARE(crossed_board_index)) != 0)
+        {
+            *out_msg = "The king would cross an attacked square, castling not possible.";
+            return false;
+        }
 
         assert(*out_msg == NULL);
         return true;
@@ -287,17 +303,19 @@ static bool is_move_allowed_king(
     // NOT castling.
 
     assert(vert_dist <= 1 && horiz_dist <= 1);
-    assert((vert_dist == 0) != (horiz_dist == 0));
+    assert(vert_dist != 0 || horiz_dist != 0); // (diagonal is OK, too)
 
     assert(*out_msg == NULL);
     return true;
 }
 
 static bool is_move_allowed_knight(
+    struct mt_chess_data const * const data,
     struct mt_chess_pos const * const from,
     struct mt_chess_pos const * const to,
     char const * * const out_msg)
 {
+    assert(data != NULL);
     assert(from != NULL && !mt_chess_pos_is_invalid(from));
     assert(to != NULL && !mt_chess_pos_is_invalid(to));
     assert(out_msg != NULL);
@@ -329,199 +347,122 @@ static bool is_move_allowed_knight(
     return false;
 }
 
+/**
+ * - Returns true, if there is no piece between the squares at given board
+ *   indices (which must be on a common rank, file or diagonal).
+ */
+static bool is_path_clear(
+    struct mt_chess_data const * const data,
+    int const from_index,
+    int const to_index)
+{
+    uint64_t between = mt_chess_line_between[from_index][to_index];
+
+    while(between != 0)
+    {
+        if(data->board[mt_chess_bit_pop_first(&between)] != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 static bool is_move_allowed_bishop(
+    struct mt_chess_data const * const data,
     struct mt_chess_pos const * const from,
     struct mt_chess_pos const * const to,
     char const * * const out_msg)
 {
+    assert(data != NULL);
     assert(from != NULL && !mt_chess_pos_is_invalid(from));
     assert(to != NULL && !mt_chess_pos_is_invalid(to));
     assert(out_msg != NULL);
 
     assert(*out_msg == NULL);
 
-    int col = 0;
-    int row = 0;
-
-    int const horiz_dist = abs(to->col - from->col);
-    int const vert_dist = abs(to->row - from->row);
+    int const from_index = ((int)mt_chess_col_h + 1) * from->row + from->col;
+    int const to_index = ((int)mt_chess_col_h + 1) * to->row + to->col;
+    int const dir = (int)mt_chess_line_dir[from_index][to_index];
 
-    if(horiz_dist != vert_dist)
+    // (the first four directions are the diagonal ones)
+    if(dir == MT_CHESS_LINE_NO_DIR || 4 <= dir)
     {
         *out_msg = "A bishop can move diagonally, only.";
         return false;
     }
 
-    if(horiz_dist == 1)
-    {
-        // That there is at most one of the opponent's pieces on the destination
-        // square must be checked elsewhere.
-
-        assert(vert_dist == 1);
+    // That there is at most one of the opponent's pieces on the destination
+    // square must be checked elsewhere.
 
-        assert(*out_msg == NULL);
-        return true;
-    }
-
-    int const col_add = from->col < to->col ? 1 : -1;
-    int const row_add = from->row < to->row ? 1 : -1;
-
-    int const first_col = from->col + col_add;
-    int const first_row = from->row + row_add;
-
-    assert(0 <= first_col && first_col <= 7);
-    assert(0 <= first_row && first_row <= 7);
-
-    int const last_col = first_col + col_add * (horiz_dist - 2);
-    int const last_row = first_row + row_add * (vert_dist - 2);
-
-    assert(0 <= last_col && last_col <= 7);
-    assert(0 <= last_row && last_row <= 7);
-
-    col = first_col;
-    row = first_row;
-    do
+    if(!is_path_clear(data, from_index, to_index))
     {
-        int const row_offset = ((int)mt_chess_col_h + 1) * row;
-        int const board_index = row_offset + col;
-        assert(0 <= board_index && board_index < 8 * 8);
-
-        if(s_data->board[board_index] != 0)
-        {
-            *out_msg = "There is at least one piece in the bishop's path.";
-            return false;
-        }
-
-        if(row == last_row)
-        {
-            assert(col == last_col);
-            break; // Done
-        }
-
-        row += row_add;
-        col += col_add;
-    } while(true);
+        *out_msg = "There is at least one piece in the bishop's path.";
+        return false;
+    }
 
     assert(*out_msg == NULL);
     return true;
 }
 
 static bool is_move_allowed_rook(
+    struct mt_chess_data const * const data,
     struct mt_chess_pos const * const from,
     struct mt_chess_pos const * const to,
     char const * * const out_msg)
 {
+    assert(data != NULL);
     assert(from != NULL && !mt_chess_pos_is_invalid(from));
     assert(to != NULL && !mt_chess_pos_is_invalid(to));
     assert(out_msg != NULL);
 
     assert(*out_msg == NULL);
 
-    if(from->row == to->row)
-    {
-        assert(from->col != to->col); // Must have been checked before.
-
-        // A horizontal move.
-
-        int board_index = 0;
-        int last_board_index = 0;
-
-        if(from->col < to->col)
-        {
-            board_index = from->col + 1;
-            last_board_index = to->col - 1;
-        }
-        else
-        {
-            assert(to->col <= from->col);
-            board_index = to->col + 1;
-            last_board_index = from->col - 1;
-        }
-
-        int const row_offset =
-                ((int)mt_chess_col_h + 1) * from/*to*/->row;
-
-        board_index += row_offset;
-        assert(0 <= board_index && board_index < 8 * 8);
-        last_board_index += row_offset;
-        assert(0 <= last_board_index && last_board_index < 8 * 8);
+    int const from_index = ((int)mt_chess_col_h + 1) * from->row + from->col;
+    int const to_index = ((int)mt_chess_col_h + 1) * to->row + to->col;
+    int const dir = (int)mt_chess_line_dir[from_index][to_index];
 
-        while(board_index <= last_board_index)
-        {
-            if(s_data->board[board_index] != 0)
-            {
-                *out_msg = "There is at least one piece blocking the rook's path on its rank.";
-                return false;
-            }
-            ++board_index;
-        }
-
-        assert(*out_msg == NULL);
-        return true; // Seems to be an OK move.
-    }
-
-    if(from->col != to->col)
+    // (the last four directions are the orthogonal ones)
+    if(dir == MT_CHESS_LINE_NO_DIR || dir < 4)
     {
         // Suggested horizontal & vertical move. => Not supported.
         *out_msg = "A rook can either move on a rank or a file, not both.";
         return false;
     }
 
-    // A vertical move.
-
-    uint8_t row = 0;
-    uint8_t last_row = 0;
-
-    if(from->row < to->row)
+    if(!is_path_clear(data, from_index, to_index))
     {
-        row = from->row + 1;
-        last_row = to->row - 1;
-    }
-    else
-    {
-        assert(to->row <= from->row);
-        row = to->row + 1;
-        last_row = from->row - 1;
+        *out_msg = from->row == to->row
+            ? "There is at least one piece blocking the rook's path on its rank."
+            : "There is at least one piece blocking the rook's path on its file.";
+        return false;
     }
 
-    while(row <= last_row)
-    {
-        int const row_offset = ((int)mt_chess_col_h + 1) * row;
-        int const board_index = row_offset + from/*to*/->col;
-
-        assert(0 <= board_index && board_index < 8 * 8);
-
-        if(s_data->board[board_index] != 0)
-        {
-            *out_msg = "There is at least one piece blocking the rook's path on its file.";
-            return false;
-        }
-
-        ++row;
-    }
     assert(*out_msg == NULL);
     return true; // Seems to be an OK move.
 }
 
 static bool is_move_allowed_queen(
+    struct mt_chess_data const * const data,
     struct mt_chess_pos const * const from,
     struct mt_chess_pos const * const to,
     char const * * const out_msg)
 {
+    assert(data != NULL);
     assert(from != NULL && !mt_chess_pos_is_invalid(from));
     assert(to != NULL && !mt_chess_pos_is_invalid(to));
     assert(out_msg != NULL);
 
     assert(*out_msg == NULL);
 
-    if(is_move_allowed_rook(from, to, out_msg))
+    if(is_move_allowed_rook(data, from, to, out_msg))
     {
         assert(*out_msg == NULL);
         return true; // Seems to be an OK move.
     }
     assert(*out_msg != NULL);
     *out_msg = NULL; // To avoid assertion in bishop function..
-    if(is_move_allowed_bishop(from, to, out_msg))
+    if(is_move_allowed_bishop(data, from, to, out_msg))
     {
         assert(*out_msg == NULL);
         return true; // Seems to be an OK move.
@@ -533,12 +474,14 @@ static bool is_move_allowed_queen(
 }
 
 static bool is_move_allowed_pawn(
+    struct mt_chess_data const * const data,
     struct mt_chess_piece const * const piece,
     struct mt_chess_pos const * const from,
     struct mt_chess_pos const * const to,
     uint8_t const to_piece_id,
     char const * * const out_msg)
 {
+    assert(data != NULL);
     assert(piece != NULL && piece->id != 0);
     assert(from != NULL && !mt_chess_pos_is_invalid(from));
     assert(to != NULL && !mt_chess_pos_is_invalid(to));
@@ -610,7 +553,7 @@ static bool is_move_allowed_pawn(
         int const middle_board_index = middle_row * (mt_chess_row_1 + 1)
                 + from/*to*/->col;
 
-        if(s_data->board[middle_board_index] != 0)
+        if(data->board[middle_board_index] != 0)
         {
             *out_msg = "A pawn cannot move two squares in straight forward direction, if there is another piece in-between.";
             return false;
@@ -644,39 +587,20 @@ static bool is_move_allowed_pawn(
         }
         // There is no (opponent's) piece at the destination square.
 
-        struct mt_chess_log_node const * const latest =
-            mt_chess_log_node_get_latest(s_data->log);
-
-        if(latest == NULL)
+        if(data->en_passant == MT_CHESS_DATA_NO_EN_PASSANT)
         {
-            *out_msg = "A pawn cannot move one square diagonally as initial move.";
+            *out_msg = "A pawn can at most move one square diagonally right after an opponent's pawn's two-square move.";
             return false;
         }
-        // There was at least one preceding move.
-        assert(latest->move.piece.color != s_data->turn);
-        if(latest->move.piece.type != mt_chess_type_pawn)
-        {
-            *out_msg = "A pawn can at most move one square diagonally after an opponent's pawn's move.";
-            return false;
-        }
-        // The last move was a pawn's move.
-
-        if(to->col == latest->move.to/*from*/.col
-            && ( // Turn-color must be white:
-                (from->row == mt_chess_row_5
-                && to->row == mt_chess_row_6
-                && latest->move.from.row == mt_chess_row_7
-                && latest->move.to.row == mt_chess_row_5)
-                // Turn color must be black:
-                || (from->row == mt_chess_row_4
-                    && to->row == mt_chess_row_3
-                    && latest->move.from.row == mt_chess_row_2
-                    && latest->move.to.row == mt_chess_row_4)))
-        {
-            assert(to_piece_id == 0); // There must never be a piece there.
+        // The last move was a pawn's two-square move.
 
+        int const to_board_index =
+            ((int)mt_chess_col_h + 1) * to->row + to->col;
+
+        if(to_board_index == (int)data->en_passant)
+        {
             // "En passant" detected.
-            return true; // Seems to be an OK move. 
+            return true; // Seems to be an OK move.
         }
 
         *out_msg = "Not an \"en passant\" move.";
@@ -696,11 +620,13 @@ static bool is_move_allowed_pawn(
 }
 
 static bool is_move_allowed(
+    struct mt_chess_data const * const data,
     struct mt_chess_piece const * const piece,
     struct mt_chess_pos const * const from,
     struct mt_chess_pos const * const to,
     char const * * const out_msg)
 {
+    assert(data != NULL);
     assert(piece != NULL && piece->id != 0);
     assert(from != NULL && !mt_chess_pos_is_invalid(from));
     assert(to != NULL && !mt_chess_pos_is_invalid(to));
@@ -710,7 +636,7 @@ static bool is_move_allowed(
 
     *out_msg = NULL;
 
-    if(piece->color != s_data->turn)
+    if(piece->color != data->turn)
     {
         *out_msg = "It is the other player's turn.";
         return false;
@@ -726,17 +652,17 @@ static bool is_move_allowed(
     int const to_board_index = ((int)mt_chess_col_h + 1) * to->row + to->col;
     assert(0 <= to_board_index && to_board_index < 8 * 8);
 
-    uint8_t const to_piece_id = s_data->board[to_board_index];
+    uint8_t const to_piece_id = data->board[to_board_index];
 
     if(to_piece_id != 0)
     {
         // There is a(-nother) piece on the destination square.
 
         int const to_piece_index = mt_chess_piece_get_index(
-            s_data->pieces, to_piece_id);
+            data->pieces, to_piece_id);
 
-        to_piece = s_data->pieces + to_piece_index;
-        if(to_piece->color == s_data->turn)
+        to_piece = data->pieces + to_piece_index;
+        if(to_piece->color == data->turn)
         {
             *out_msg = "There is another piece belonging to the current player on the destination square.";
             return false;
@@ -748,61 +674,40 @@ static bool is_move_allowed(
         assert(to_piece->type != mt_chess_type_king);
     }
 
+    bool allowed = false;
+    MT_CHESS_STATS_BEGIN(stats_begin);
+
     switch(piece->type)
     {
         case mt_chess_type_king:
         {
-            if(!is_move_allowed_king(from, to, out_msg))
-            {
-                assert(*out_msg != NULL);
-                return false;
-            }
+            allowed = is_move_allowed_king(data, from, to, out_msg);
             break;
         }
         case mt_chess_type_pawn:
         {
-            if(!is_move_allowed_pawn(
-                piece, from, to, to_piece_id, out_msg))
-            {
-                assert(*out_msg != NULL);
-                return false;
-            }
+            allowed = is_move_allowed_pawn(
+                data, piece, from, to, to_piece_id, out_msg);
             break;
         }
         case mt_chess_type_knight:
         {
-            if(!is_move_allowed_knight(from, to, out_msg))
-            {
-                assert(*out_msg != NULL);
-                return false;
-            }
+            allowed = is_move_allowed_knight(data, from, to, out_msg);
             break;
         }
         case mt_chess_type_bishop:
         {
-            if(!is_move_allowed_bishop(from, to, out_msg))
-            {
-                assert(*out_msg != NULL);
-                return false;
-            }
+            allowed = is_move_allowed_bishop(data, from, to, out_msg);
             break;
         }
         case mt_chess_type_rook:
         {
-            if(!is_move_allowed_rook(from, to, out_msg))
-            {
-                assert(*out_msg != NULL);
-                return false;
-            }
+            allowed = is_move_allowed_rook(data, from, to, out_msg);
             break;
         }
         case mt_chess_type_queen:
         {
-            if(!is_move_allowed_queen(from, to, out_msg))
-            {
-                assert(*out_msg != NULL);
-                return false;
-            }
+            allowed = is_move_allowed_queen(data, from, to, out_msg);
             break;
         }
 
@@ -814,7 +719,68 @@ static bool is_move_allowed(
         }
     }
 
-    // TODO: Check and return false, if king is under attack / in check after move (no matter, if this was already true before or would be caused by the suggested move)!
+    MT_CHESS_STATS_END(
+        (enum mt_chess_stats_id)(
+            (int)mt_chess_stats_id_validate_king + (int)piece->type),
+        stats_begin);
+
+    if(!allowed)
+    {
+        assert(*out_msg != NULL);
+        return false;
+    }
+
+    // Would the own king be in check after the move (no matter, if this was
+    // already true before or would be caused by the suggested move)?
+
+    uint64_t const to_square = MT_CHESS_BIT_SQUARE(to_board_index);
+
+    if(piece->type == mt_chess_type_king)
+    {
+        if((data->check.danger & to_square) != 0)
+        {
+            *out_msg = "A king cannot move to a square attacked by the opponent.";
+            return false;
+        }
+        assert(*out_msg == NULL);
+        return true;
+    }
+
+    int const from_board_index =
+        ((int)mt_chess_col_h + 1) * from->row + from->col;
+    assert(0 <= from_board_index && from_board_index < 8 * 8);
+
+    if(piece->type == mt_chess_type_pawn
+        && from->col != to->col
+        && to_piece_id == 0)
+    {
+        // "En passant" (already validated above).
+
+        if(!mt_chess_check_is_en_passant_safe(
+            data->pieces,
+            data->board,
+            (enum mt_chess_color)data->turn,
+            from_board_index,
+            to_board_index))
+        {
+            *out_msg = "This \"en passant\" move would leave the king in check.";
+            return false;
+        }
+        assert(*out_msg == NULL);
+        return true;
+    }
+
+    if((mt_chess_check_get_mask(&data->check, from_board_index)
+            & to_square) == 0)
+    {
+        if(data->check.checkers != 0)
+        {
+            *out_msg = "The king is in check and this move does not resolve it.";
+            return false;
+        }
+        *out_msg = "This piece is pinned and cannot leave the line to its king.";
+        return false;
+    }
 
     assert(*out_msg == NULL);
     return true;
@@ -827,29 +793,40 @@ MT_EXPORT_CHESS_API void __stdcall mt_chess_free(void * const ptr)
         assert(false); // Although no problem, here.
         return;
     }
-    free(ptr);
+    mt_chess_mem_free(ptr);
+}
+
+MT_EXPORT_CHESS_API struct mt_chess_game * __stdcall mt_chess_create_game(void)
+{
+    return mt_chess_game_create();
+}
+
+MT_EXPORT_CHESS_API void __stdcall mt_chess_free_game(
+    struct mt_chess_game * const game)
+{
+    mt_chess_game_free(game);
 }
 
 MT_EXPORT_CHESS_API void __stdcall mt_chess_deinit(void)
 {
-    if(s_data == NULL)
+    if(s_game == NULL)
     {
         assert(false); // Although no problem.
         return;
     }
-    mt_chess_data_free(s_data);
-    s_data = NULL;
+    mt_chess_game_free(s_game);
+    s_game = NULL;
 }
 
 MT_EXPORT_CHESS_API void __stdcall mt_chess_reinit(void)
 {
-    if(s_data != NULL)
+    if(s_game != NULL)
     {
-        mt_chess_deinit();
+        mt_chess_game_reset(s_game); // Reuses memory of previous game.
+        return;
     }
-    assert(s_data == NULL);
-    s_data = mt_chess_data_create();
-    assert(s_data != NULL);
+    s_game = mt_chess_game_create();
+    assert(s_game != NULL);
 }
 
 /**
@@ -858,18 +835,20 @@ MT_EXPORT_CHESS_API void __stdcall mt_chess_reinit(void)
 MT_EXPORT_CHESS_API char* __stdcall mt_chess_create_board_as_str(
     bool const unicode)
 {
-    if(s_data == NULL)
+    if(s_game == NULL)
     {
         return NULL; // Not initialized, yet.
     }
-    return mt_chess_str_create_board(s_data, unicode);
+    return mt_chess_str_create_board(&s_game->data, unicode);
 }
 
-MT_EXPORT_CHESS_API bool __stdcall mt_chess_try_move(
+static bool try_move(
+    struct mt_chess_game * const game,
     char const from_file, char const from_rank,
     char const to_file, char const to_rank,
     char const * * const out_msg)
 {
+    assert(game != NULL);
     assert(out_msg != NULL);
     *out_msg = NULL;
     
@@ -895,7 +874,7 @@ MT_EXPORT_CHESS_API bool __stdcall mt_chess_try_move(
     int const piece_board_index =
             ((int)mt_chess_col_h + 1) * from.row + from.col;
     assert(0 <= piece_board_index && piece_board_index < 8 * 8);
-    uint8_t const piece_id = s_data->board[piece_board_index];
+    uint8_t const piece_id = game->data.board[piece_board_index];
     
     if(piece_id == 0)
     {
@@ -903,14 +882,16 @@ MT_EXPORT_CHESS_API bool __stdcall mt_chess_try_move(
         return false;
     }
 
-    int const piece_index = mt_chess_piece_get_index(s_data->pieces, piece_id);
+    int const piece_index = mt_chess_piece_get_index(
+        game->data.pieces, piece_id);
     
     assert(0 <= piece_index);
     
-    struct mt_chess_piece const * const piece = s_data->pieces + piece_index;
+    struct mt_chess_piece const * const piece =
+        game->data.pieces + piece_index;
     assert(piece->id == piece_id);
     
-    if(!is_move_allowed(piece, &from, &to, out_msg))
+    if(!is_move_allowed(&game->data, piece, &from, &to, out_msg))
     {
         assert(*out_msg != NULL);
         return false;
@@ -920,37 +901,187 @@ MT_EXPORT_CHESS_API bool __stdcall mt_chess_try_move(
     move.from = from;
     move.to = to;
 
-    mt_chess_move_apply(&move, s_data->board);
+    // (pawns are always promoted to queens)
+    uint16_t const packed = mt_chess_move_get_packed(
+        &move, game->data.board, mt_chess_type_queen);
+
+    mt_chess_game_do_move(game, packed);
 
-    // Log:
-    //
+    assert(*out_msg == NULL);
+    return true;
+}
+
+MT_EXPORT_CHESS_API bool __stdcall mt_chess_try_move_in_game(
+    struct mt_chess_game * const game,
+    char const from_file, char const from_rank,
+    char const to_file, char const to_rank,
+    char const * * const out_msg)
+{
+    uint64_t const latency_begin = mt_chess_latency_begin();
+    MT_CHESS_STATS_BEGIN(stats_begin);
+
+    bool const ret_val = try_move(
+        game, from_file, from_rank, to_file, to_rank, out_msg);
+
+    MT_CHESS_STATS_END(mt_chess_stats_id_try_move, stats_begin);
+    mt_chess_latency_end(mt_chess_latency_id_try_move, latency_begin);
+    return ret_val;
+}
+
+MT_EXPORT_CHESS_API bool __stdcall mt_chess_try_move(
+    char const from_file, char const from_rank,
+    char const to_file, char const to_rank,
+    char const * * const out_msg)
+{
+    assert(s_game != NULL);
+
+    return mt_chess_try_move_in_game(
+        s_game, from_file, from_rank, to_file, to_rank, out_msg);
+}
+
+MT_EXPORT_CHESS_API uint64_t __stdcall mt_chess_get_targets_in_game(
+    struct mt_chess_game const * const game,
+    char const from_file, char const from_rank)
+{
+    assert(game != NULL);
+
+    struct mt_chess_pos const from = mt_chess_pos_get(from_file, from_rank);
+
+    if(mt_chess_pos_is_invalid(&from))
     {
-        struct mt_chess_log_node * const node = mt_chess_log_node_create();
+        return 0;
+    }
 
-        node->move.from = from;
-        node->move.to = to;
-        node->move.piece = *piece;
+    struct mt_chess_move_list list;
 
-        if(s_data->log == NULL)
-        {
-            s_data->log = node; // First move to be logged.
-        }
-        else
-        {
-            
-            struct mt_chess_log_node * const latest_node =
-                mt_chess_log_node_get_latest(s_data->log);
+    mt_chess_movegen_get_legal(&game->data, &list);
+    return mt_chess_movegen_get_targets(
+        &list, ((int)mt_chess_col_h + 1) * from.row + from.col);
+}
 
-            assert(latest_node != NULL);
-            assert(latest_node->next == NULL);
+MT_EXPORT_CHESS_API uint64_t __stdcall mt_chess_get_targets(
+    char const from_file, char const from_rank)
+{
+    if(s_game == NULL)
+    {
+        return 0; // Not initialized, yet.
+    }
+    return mt_chess_get_targets_in_game(s_game, from_file, from_rank);
+}
 
-            latest_node->next = node;
-            node->last = latest_node;
-        }
+MT_EXPORT_CHESS_API uint64_t __stdcall mt_chess_get_movable_in_game(
+    struct mt_chess_game const * const game)
+{
+    assert(game != NULL);
+
+    struct mt_chess_move_list list;
+
+    mt_chess_movegen_get_legal(&game->data, &list);
+    return mt_chess_movegen_get_movable(&list);
+}
+
+MT_EXPORT_CHESS_API uint64_t __stdcall mt_chess_get_movable(void)
+{
+    if(s_game == NULL)
+    {
+        return 0; // Not initialized, yet.
+    }
+    return mt_chess_get_movable_in_game(s_game);
+}
+
+MT_EXPORT_CHESS_API bool __stdcall mt_chess_undo(void)
+{
+    if(s_game == NULL)
+    {
+        return false; // Not initialized, yet.
     }
+    return mt_chess_game_undo(s_game);
+}
 
-    s_data->turn = (enum mt_chess_color)(1 - (int)s_data->turn);
+MT_EXPORT_CHESS_API bool __stdcall mt_chess_redo(void)
+{
+    if(s_game == NULL)
+    {
+        return false; // Not initialized, yet.
+    }
+    return mt_chess_game_redo(s_game);
+}
 
-    assert(*out_msg == NULL);
+MT_EXPORT_CHESS_API bool __stdcall mt_chess_jump_to_ply(int const ply)
+{
+    if(s_game == NULL)
+    {
+        return false; // Not initialized, yet.
+    }
+    return mt_chess_game_jump_to_ply(s_game, ply);
+}
+
+MT_EXPORT_CHESS_API int __stdcall mt_chess_get_ply(void)
+{
+    if(s_game == NULL)
+    {
+        return -1; // Not initialized, yet.
+    }
+    return s_game->ply;
+}
+
+MT_EXPORT_CHESS_API int __stdcall mt_chess_get_ply_count(void)
+{
+    if(s_game == NULL)
+    {
+        return -1; // Not initialized, yet.
+    }
+    return s_game->ply_count;
+}
+
+MT_EXPORT_CHESS_API bool __stdcall mt_chess_get_stats(
+    struct mt_chess_stats * const out_stats)
+{
+    assert(out_stats != NULL);
+
+#ifdef MT_CHESS_STATS_ENABLED
+    mt_chess_stats_get(out_stats);
     return true;
-}
\ No newline at end of file
+#else //MT_CHESS_STATS_ENABLED
+    static struct mt_chess_stats const zero = { 0 };
+
+    *out_stats = zero;
+    return false;
+#endif //MT_CHESS_STATS_ENABLED
+}
+
+MT_EXPORT_CHESS_API void __stdcall mt_chess_reset_stats(void)
+{
+#ifdef MT_CHESS_STATS_ENABLED
+    mt_chess_stats_reset();
+#endif //MT_CHESS_STATS_ENABLED
+}
+
+MT_EXPORT_CHESS_API void __stdcall mt_chess_set_latency_enabled(
+    bool const enabled)
+{
+    mt_chess_latency_set_enabled(enabled);
+}
+
+MT_EXPORT_CHESS_API void __stdcall mt_chess_get_latency(
+    enum mt_chess_latency_id const id, struct mt_chess_hist * const out_hist)
+{
+    mt_chess_latency_get(id, out_hist);
+}
+
+MT_EXPORT_CHESS_API void __stdcall mt_chess_reset_latency(void)
+{
+    mt_chess_latency_reset();
+}
+
+MT_EXPORT_CHESS_API void __stdcall mt_chess_merge_latency(
+    struct mt_chess_hist * const dest, struct mt_chess_hist const * const src)
+{
+    mt_chess_hist_merge(dest, src);
+}
+
+MT_EXPORT_CHESS_API uint64_t __stdcall mt_chess_get_latency_percentile(
+    struct mt_chess_hist const * const hist, double const percentile)
+{
+    return mt_chess_hist_get_percentile(hist, percentile);
+}
@@ -35,17 +35,30 @@
 
 #ifdef __cplusplus
     #include <cstdbool>
+    #include <cstdint>
 #else //__cplusplus
     #include <stdbool.h>
+    #include <stdint.h>
 #endif //__cplusplus
 
+#include "mt_chess_stats.h"
+#include "mt_chess_latency.h"
+#include "mt_chess_hist.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif //__cplusplus
 
+struct mt_chess_game; // (see mt_chess_game.h)
+
 MT_EXPORT_CHESS_API void __stdcall mt_chess_free(void * const ptr);
 
 MT_EXPORT_CHESS_API void __stdcall mt_chess_deinit(void);
+
+/**
+ * - Starts a new game.
+ * - Reuses the memory of the previous game, if not deinitialized.
+ */
 MT_EXPORT_CHESS_API void __stdcall mt_chess_reinit(void);
 
 /**
@@ -58,12 +71,146 @@ MT_EXPORT_CHESS_API char* __stdcall mt_chess_create_board_as_str(
 
 /**
  * - Caller does NOT take ownership of eventually set output message.
+ * - Pawns reaching the last rank are promoted to queens.
+ * - If moves were taken back, the moves after the current one get dropped.
  */
 MT_EXPORT_CHESS_API bool __stdcall mt_chess_try_move(
     char const from_file, char const from_rank,
     char const to_file, char const to_rank,
     char const * * const out_msg);
 
+/**
+ * - Functions taking a game work on that game, only, and do not use the game
+ *   of mt_chess_reinit(). There is no state shared between games, so
+ *   different games may be used by different threads at the same time (calls
+ *   for one game must not overlap).
+ * - Free return value via mt_chess_free_game().
+ */
+MT_EXPORT_CHESS_API struct mt_chess_game * __stdcall mt_chess_create_game(void);
+
+MT_EXPORT_CHESS_API void __stdcall mt_chess_free_game(
+    struct mt_chess_game * const game);
+
+/**
+ * - Like mt_chess_try_move(), but for given game.
+ */
+MT_EXPORT_CHESS_API bool __stdcall mt_chess_try_move_in_game(
+    struct mt_chess_game * const game,
+    char const from_file, char const from_rank,
+    char const to_file, char const to_rank,
+    char const * * const out_msg);
+
+/**
+ * - Returns the mask of the squares the piece at given position can legally
+ *   move to, e.g. to highlight them in a user interface.
+ * - Bit n of the mask represents the square at file n % 8 (0 is file A) and
+ *   rank 8 - n / 8, e.g. a8 is bit 0, h8 is bit 7, a1 is bit 56 and h1 is
+ *   bit 63.
+ * - Returns 0, if there is no piece of the player having the turn at given
+ *   position, given position is invalid or not initialized, yet.
+ * - Costs one legal move generation.
+ */
+MT_EXPORT_CHESS_API uint64_t __stdcall mt_chess_get_targets(
+    char const from_file, char const from_rank);
+
+/**
+ * - Like mt_chess_get_targets(), but for given game.
+ */
+MT_EXPORT_CHESS_API uint64_t __stdcall mt_chess_get_targets_in_game(
+    struct mt_chess_game const * const game,
+    char const from_file, char const from_rank);
+
+/**
+ * - Returns the mask of the squares of the pieces having at least one legal
+ *   move (see mt_chess_get_targets() for the bit order), 0 if the game is
+ *   over or not initialized, yet.
+ * - Costs one legal move generation.
+ */
+MT_EXPORT_CHESS_API uint64_t __stdcall mt_chess_get_movable(void);
+
+/**
+ * - Like mt_chess_get_movable(), but for given game.
+ */
+MT_EXPORT_CHESS_API uint64_t __stdcall mt_chess_get_movable_in_game(
+    struct mt_chess_game const * const game);
+
+/**
+ * - Takes back the last move (it stays available for mt_chess_redo()).
+ * - Returns false, if at the start of the game or not initialized, yet.
+ */
+MT_EXPORT_CHESS_API bool __stdcall mt_chess_undo(void);
+
+/**
+ * - Re-applies the next move that was taken back.
+ * - Returns false, if there is none or not initialized, yet.
+ */
+MT_EXPORT_CHESS_API bool __stdcall mt_chess_redo(void);
+
+/**
+ * - Goes to the position after given count of moves (0 is the start position).
+ * - Takes constant time per move to take back or re-apply.
+ * - Returns false and does nothing, if there is no such move (see
+ *   mt_chess_get_ply_count()) or not initialized, yet.
+ */
+MT_EXPORT_CHESS_API bool __stdcall mt_chess_jump_to_ply(int const ply);
+
+/**
+ * - Returns the count of moves leading to the current position or -1, if not
+ *   initialized, yet.
+ */
+MT_EXPORT_CHESS_API int __stdcall mt_chess_get_ply(void);
+
+/**
+ * - Returns the count of moves available in the game's history (including
+ *   moves taken back) or -1, if not initialized, yet.
+ */
+MT_EXPORT_CHESS_API int __stdcall mt_chess_get_ply_count(void);
+
+/**
+ * - Gets the hot-path counters and timers of the calling thread (see
+ *   mt_chess_stats.h).
+ * - Returns false and zeroes given struct, if the library was built without
+ *   MT_CHESS_STATS_ENABLED.
+ */
+MT_EXPORT_CHESS_API bool __stdcall mt_chess_get_stats(
+    struct mt_chess_stats * const out_stats);
+
+/**
+ * - Zeroes the hot-path counters and timers of the calling thread.
+ */
+MT_EXPORT_CHESS_API void __stdcall mt_chess_reset_stats(void);
+
+/**
+ * - Enables or disables latency recording of mt_chess_try_move() (and
+ *   mt_chess_try_move_in_game()) and of bot move selection for the calling
+ *   thread (see mt_chess_latency.h). Disabled by default.
+ */
+MT_EXPORT_CHESS_API void __stdcall mt_chess_set_latency_enabled(
+    bool const enabled);
+
+/**
+ * - Copies the calling thread's latency histogram (in nanoseconds) of given
+ *   ID.
+ * - Merge histograms of different threads via mt_chess_merge_latency().
+ */
+MT_EXPORT_CHESS_API void __stdcall mt_chess_get_latency(
+    enum mt_chess_latency_id const id, struct mt_chess_hist * const out_hist);
+
+/**
+ * - Empties the calling thread's latency histograms.
+ */
+MT_EXPORT_CHESS_API void __stdcall mt_chess_reset_latency(void);
+
+MT_EXPORT_CHESS_API void __stdcall mt_chess_merge_latency(
+    struct mt_chess_hist * const dest, struct mt_chess_hist const * const src);
+
+/**
+ * - Returns the latency in nanoseconds at given percentile (e.g. 99.9) or 0,
+ *   if given histogram is empty.
+ */
+MT_EXPORT_CHESS_API uint64_t __stdcall mt_chess_get_latency_percentile(
+    struct mt_chess_hist const * const hist, double const percentile);
+
 #ifdef __cplusplus
 }
 #endif //__cplusplus
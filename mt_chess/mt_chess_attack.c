@@ -1,4 +1,3 @@
-
 // Marcel Timm, RhinoDevel, 2025dec28
 
 #ifdef __cplusplus
@@ -19,109 +18,232 @@
 #include "mt_chess_row.h"
 #include "mt_chess_col.h"
 #include "mt_chess_type.h"
+#include "mt_chess_bit.h"
+
+static int const s_row_len = (int)mt_chess_col_h + 1;
+
+// Row and column deltas of the knight's jumps:
+static int const s_knight_row_add[8] = { -2, -2, -1, -1, 1, 1, 2, 2 };
+static int const s_knight_col_add[8] = { -1, 1, -2, 2, -2, 2, -1, 1 };
+
+// Row and column deltas of the king's steps (first four are diagonal):
+static int const s_king_row_add[8] = { -1, -1, 1, 1, -1, 0, 0, 1 };
+static int const s_king_col_add[8] = { -1, 1, -1, 1, 0, -1, 1, 0 };
+
+static bool is_on_board(int const row, int const col)
+{
+    return 0 <= row && row <= (int)mt_chess_row_1
+        && 0 <= col && col <= (int)mt_chess_col_h;
+}
+
+/**
+ * - Adds the squares reachable by single steps with given deltas.
+ */
+static uint64_t get_steps(
+    int const index,
+    int const * const row_add,
+    int const * const col_add,
+    int const count)
+{
+    assert(0 <= index && index < 8 * 8);
+
+    uint64_t ret_val = 0;
+    int const row = index / s_row_len;
+    int const col = index % s_row_len;
+
+    for(int i = 0; i < count; ++i)
+    {
+        int const to_row = row + row_add[i];
+        int const to_col = col + col_add[i];
+
+        if(is_on_board(to_row, to_col))
+        {
+            ret_val |= MT_CHESS_BIT_SQUARE(to_row * s_row_len + to_col);
+        }
+    }
+    return ret_val;
+}
+
+/**
+ * - Adds the squares reachable by sliding with given deltas, stopping at (and
+ *   including) the first occupied square.
+ */
+static uint64_t get_slides(
+    int const index,
+    uint64_t const occupied,
+    int const * const row_add,
+    int const * const col_add,
+    int const count)
+{
+    assert(0 <= index && index < 8 * 8);
+
+    uint64_t ret_val = 0;
+    int const row = index / s_row_len;
+    int const col = index % s_row_len;
+
+    for(int i = 0; i < count; ++i)
+    {
+        int to_row = row + row_add[i];
+        int to_col = col + col_add[i];
 
-static void add_to_attack_map(
+        while(is_on_board(to_row, to_col))
+        {
+            uint64_t const square =
+                MT_CHESS_BIT_SQUARE(to_row * s_row_len + to_col);
+
+            ret_val |= square;
+            if((occupied & square) != 0)
+            {
+                break; // Blocked.
+            }
+            to_row += row_add[i];
+            to_col += col_add[i];
+        }
+    }
+    return ret_val;
+}
+
+uint64_t mt_chess_attack_get_pawn(
+    int const index, enum mt_chess_color const color)
+{
+    assert(0 <= index && index < 8 * 8);
+
+    // White has negative direction, because of rank order (8 to 1).
+    int const row_add = color == mt_chess_color_white ? -1 : 1;
+    int const row_adds[2] = { row_add, row_add };
+    static int const col_adds[2] = { -1, 1 };
+
+    return get_steps(index, row_adds, col_adds, 2);
+}
+
+uint64_t mt_chess_attack_get_knight(int const index)
+{
+    return get_steps(index, s_knight_row_add, s_knight_col_add, 8);
+}
+
+uint64_t mt_chess_attack_get_king(int const index)
+{
+    return get_steps(index, s_king_row_add, s_king_col_add, 8);
+}
+
+uint64_t mt_chess_attack_get_bishop(int const index, uint64_t const occupied)
+{
+    return get_slides(index, occupied, s_king_row_add, s_king_col_add, 4);
+}
+
+uint64_t mt_chess_attack_get_rook(int const index, uint64_t const occupied)
+{
+    return get_slides(
+        index, occupied, s_king_row_add + 4, s_king_col_add + 4, 4);
+}
+
+static uint64_t get_of_piece(
     struct mt_chess_piece const * const piece,
-    int const piece_row,
-    int const piece_col,
-    uint8_t * const attack_map)
+    int const index,
+    uint64_t const occupied)
 {
     assert(piece != NULL);
-    assert(0 <= piece_row && piece_row <= (int)mt_chess_row_1);
-    assert(0 <= piece_col && piece_col <= (int)mt_chess_col_h);
-    assert(attack_map != NULL);
+    assert(0 <= index && index < 8 * 8);
 
     switch(piece->type)
     {
         case mt_chess_type_king:
         {
-            // TODO: Implement!
-            return;
+            return mt_chess_attack_get_king(index);
         }
         case mt_chess_type_pawn:
         {
-            // TODO: Implement!
-            return;
+            return mt_chess_attack_get_pawn(
+                index, (enum mt_chess_color)piece->color);
         }
         case mt_chess_type_knight:
         {
-            // TODO: Implement!
-            return;
+            return mt_chess_attack_get_knight(index);
         }
         case mt_chess_type_bishop:
         {
-            // TODO: Implement!
-            return;
+            return mt_chess_attack_get_bishop(index, occupied);
         }
         case mt_chess_type_rook:
         {
-            // TODO: Implement!
-            return;
+            return mt_chess_attack_get_rook(index, occupied);
         }
         case mt_chess_type_queen:
         {
-            // TODO: Implement!
-            return;
+            return mt_chess_attack_get_bishop(index, occupied)
+                | mt_chess_attack_get_rook(index, occupied);
         }
 
         default:
         {
             assert(false); // Must not get here!
-            return;
+            return 0;
         }
     }
 }
 
-void mt_chess_attack_update(
+uint64_t mt_chess_attack_get_mask(
     struct mt_chess_piece const * const pieces,
     uint8_t const * const board,
     enum mt_chess_color const attacker,
-    uint8_t * const attack_map)
+    uint64_t const occupied)
 {
     assert(pieces != NULL);
     assert(board != NULL);
     assert(
         attacker == mt_chess_color_white || attacker == mt_chess_color_black);
-    assert(attack_map != NULL);
 
-    // Reset the attack map:
-    for(int index = 0; index < 8 * 8; ++index)
-    {
-        attack_map[index] = 0;
-    }
+    uint64_t ret_val = 0;
 
-    // Check each square of the board for a piece. If found, determine which
-    // other squares are attacked by that piece and mark these "squares" on the
-    // attack map:
-    for(int row = (int)mt_chess_row_8; row <= (int)mt_chess_row_1; ++row)
+    for(int index = 0; index < 8 * 8; ++index)
     {
-        int const row_offset = row * ((int)mt_chess_col_h + 1);
+        uint8_t const piece_id = board[index];
 
-        for(int col = (int)mt_chess_col_a; col <= (int)mt_chess_col_h; ++col)
+        if(piece_id == 0)
         {
-            int const index = row_offset + col; // For board & attack map.
-            uint8_t const piece_id = board[index];
+            continue; // Current square is empty. => Does not attack anyone.
+        }
 
-            if(piece_id == 0)
-            {
-                continue; // Current square is empty. => Does not attack anyone.
-            }
+        int const piece_index = mt_chess_piece_get_index(pieces, piece_id);
 
-            // There is a piece at the current square of the board.
+        struct mt_chess_piece const * const piece = pieces + piece_index;
 
-            int const piece_index = mt_chess_piece_get_index(pieces, piece_id);
+        if(piece->color != attacker)
+        {
+            continue;
+        }
+        ret_val |= get_of_piece(piece, index, occupied);
+    }
+    return ret_val;
+}
 
-            struct mt_chess_piece const * const piece = pieces + piece_index;
-            
-            if(piece->color != attacker)
-            {
-                // One of the pieces of the player having the current turn.
-                continue;
-            }
+void mt_chess_attack_update(
+    struct mt_chess_piece const * const pieces,
+    uint8_t const * const board,
+    enum mt_chess_color const attacker,
+    uint8_t * const attack_map)
+{
+    assert(pieces != NULL);
+    assert(board != NULL);
+    assert(
+        attacker == mt_chess_color_white || attacker == mt_chess_color_black);
+    assert(attack_map != NULL);
 
-            // The piece belongs to the attacker.
+    uint64_t occupied = 0;
 
-            add_to_attack_map(piece, row, col, attack_map);
+    for(int index = 0; index < 8 * 8; ++index)
+    {
+        if(board[index] != 0)
+        {
+            occupied |= MT_CHESS_BIT_SQUARE(index);
         }
     }
-}
\ No newline at end of file
+
+    uint64_t const mask = mt_chess_attack_get_mask(
+        pieces, board, attacker, occupied);
+
+    for(int index = 0; index < 8 * 8; ++index)
+    {
+        attack_map[index] = (mask & MT_CHESS_BIT_SQUARE(index)) != 0 ? 1 : 0;
+    }
+}
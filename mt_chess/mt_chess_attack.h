@@ -1,4 +1,3 @@
-
 // Marcel Timm, RhinoDevel, 2025dec28
 
 #ifndef MT_CHESS_ATTACK
@@ -17,6 +16,40 @@
 extern "C" {
 #endif //__cplusplus
 
+// All masks are square masks as described in mt_chess_bit.h.
+
+/**
+ * - Returns the squares attacked by a pawn of given color at given index.
+ */
+uint64_t mt_chess_attack_get_pawn(
+    int const index, enum mt_chess_color const color);
+
+uint64_t mt_chess_attack_get_knight(int const index);
+
+uint64_t mt_chess_attack_get_king(int const index);
+
+/**
+ * - Includes the first occupied square in each direction (if any).
+ */
+uint64_t mt_chess_attack_get_bishop(int const index, uint64_t const occupied);
+
+/**
+ * - Includes the first occupied square in each direction (if any).
+ */
+uint64_t mt_chess_attack_get_rook(int const index, uint64_t const occupied);
+
+/**
+ * - Returns the squares attacked by all pieces of given attacker color.
+ * - Sliding pieces are blocked by the pieces in given occupied mask, only
+ *   (e.g. remove the defending king from that mask to let attacks x-ray
+ *   through it).
+ */
+uint64_t mt_chess_attack_get_mask(
+    struct mt_chess_piece const * const pieces,
+    uint8_t const * const board,
+    enum mt_chess_color const attacker,
+    uint64_t const occupied);
+
 /** Update the attack map given, with the player of given color as attacker.
  */
 void mt_chess_attack_update(
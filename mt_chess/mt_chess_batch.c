@@ -0,0 +1,264 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_batch.h"
+#include "mt_chess_search.h"
+#include "mt_chess_data.h"
+#include "mt_chess_thread.h"
+#include "mt_chess_trace.h"
+#include "mt_chess_mem.h"
+
+// Positions per thread in progress or waiting to be reported at once:
+//
+static int const s_window_per_thread = 4;
+
+/**
+ * - A position fetched, but not reported, yet.
+ */
+struct item
+{
+    bool done; // Searched (or invalid) and waiting to be reported.
+    bool valid;
+    struct mt_chess_search_result result; // Valid, if done and valid.
+};
+
+struct batch
+{
+    struct mt_chess_search_limits limits;
+    enum mt_chess_batch_next (*get_next)(
+        void * const ctx, struct mt_chess_data * const out_data);
+    void (*on_result)(
+        void * const ctx,
+        uint64_t const index,
+        struct mt_chess_search_result const * const result);
+    void * ctx;
+
+    // Protected by the mutex:
+
+    struct mt_chess_thread_mutex mutex;
+    struct mt_chess_thread_cond cond; // Signaled, when positions got reported.
+    bool end; // The get-next function returned the end.
+    uint64_t next_index; // Index of the next position to fetch.
+    uint64_t next_report; // Index of the next position to report.
+    struct item * items; // Ring buffer of the window, indexed by position.
+    int window;
+};
+
+/**
+ * - Reports the positions done in order, starting with the next one to
+ *   report, until one is not done.
+ * - The mutex must be locked by the caller.
+ */
+static void report(struct batch * const batch)
+{
+    bool reported = false;
+
+    while(true)
+    {
+        struct item * const item =
+            batch->items + batch->next_report % (uint64_t)batch->window;
+
+        if(batch->next_report == batch->next_index || !item->done)
+        {
+            break;
+        }
+        batch->on_result(
+            batch->ctx,
+            batch->next_report,
+            item->valid ? &item->result : NULL);
+        item->done = false;
+        ++batch->next_report;
+        reported = true;
+    }
+    if(reported)
+    {
+        mt_chess_thread_cond_broadcast(&batch->cond);
+    }
+}
+
+static void run_thread(void * const arg)
+{
+    struct batch * const batch = (struct batch *)arg;
+    struct mt_chess_data data; // This thread's copy of the position.
+
+    mt_chess_thread_mutex_lock(&batch->mutex);
+    while(true)
+    {
+        // The window is full, if the oldest position not reported, yet, is
+        // still in progress:
+        //
+        while(!batch->end
+            && batch->next_report + (uint64_t)batch->window
+                <= batch->next_index)
+        {
+            mt_chess_thread_cond_wait(&batch->cond, &batch->mutex);
+        }
+        if(batch->end)
+        {
+            break;
+        }
+
+        enum mt_chess_batch_next const next =
+            batch->get_next(batch->ctx, &data);
+
+        if(next == mt_chess_batch_next_end)
+        {
+            batch->end = true;
+            mt_chess_thread_cond_broadcast(&batch->cond);
+            break;
+        }
+
+        uint64_t const index = batch->next_index++;
+        struct item * const item =
+            batch->items + index % (uint64_t)batch->window;
+
+        item->valid = next == mt_chess_batch_next_position;
+        if(item->valid)
+        {
+            mt_chess_thread_mutex_unlock(&batch->mutex);
+
+            MT_CHESS_TRACE_BEGIN(trace_begin);
+
+            mt_chess_search_get_best(&data, &batch->limits, &item->result);
+
+            MT_CHESS_TRACE_END(trace_begin, "batch position", index);
+
+            mt_chess_thread_mutex_lock(&batch->mutex);
+        }
+        item->done = true;
+        report(batch);
+    }
+    mt_chess_thread_mutex_unlock(&batch->mutex);
+}
+
+bool mt_chess_batch_run(
+    struct mt_chess_search_limits const * const limits,
+    int const thread_count,
+    enum mt_chess_batch_next (*get_next)(
+        void * const ctx, struct mt_chess_data * const out_data),
+    void (*on_result)(
+        void * const ctx,
+        uint64_t const index,
+        struct mt_chess_search_result const * const result),
+    void * const ctx)
+{
+    assert(limits != NULL);
+    assert(0 <= thread_count);
+    assert(get_next != NULL);
+    assert(on_result != NULL);
+
+    int const count = thread_count == 0
+        ? mt_chess_thread_get_cpu_count() : thread_count;
+    struct batch batch;
+
+    batch.limits = *limits;
+    batch.limits.timeman = NULL;
+    batch.limits.on_iteration = NULL;
+    batch.limits.is_stopped = NULL;
+    batch.limits.ctx = NULL;
+    batch.get_next = get_next;
+    batch.on_result = on_result;
+    batch.ctx = ctx;
+    mt_chess_thread_mutex_init(&batch.mutex);
+    mt_chess_thread_cond_init(&batch.cond);
+    batch.end = false;
+    batch.next_index = 0;
+    batch.next_report = 0;
+    batch.window = s_window_per_thread * count;
+    batch.items = (struct item *)mt_chess_mem_alloc(
+        (size_t)batch.window * sizeof *batch.items);
+    for(int i = 0; i < batch.window; ++i)
+    {
+        batch.items[i].done = false;
+    }
+
+    struct mt_chess_thread * const threads =
+        (struct mt_chess_thread *)mt_chess_mem_alloc(
+            (size_t)count * sizeof *threads);
+    int started = 0;
+
+    while(started < count
+        && mt_chess_thread_start(threads + started, run_thread, &batch))
+    {
+        ++started;
+    }
+    for(int i = 0; i < started; ++i)
+    {
+        mt_chess_thread_join(threads + i);
+    }
+
+    assert(started == 0 || batch.next_report == batch.next_index);
+
+    mt_chess_mem_free(threads);
+    mt_chess_mem_free(batch.items);
+    mt_chess_thread_cond_deinit(&batch.cond);
+    mt_chess_thread_mutex_deinit(&batch.mutex);
+    return started == count;
+}
+
+/**
+ * - Positions and results of mt_chess_batch_run_array().
+ */
+struct array
+{
+    struct mt_chess_data const * data;
+    uint64_t count;
+    uint64_t next;
+    struct mt_chess_search_result * results;
+};
+
+static enum mt_chess_batch_next get_next_of_array(
+    void * const ctx, struct mt_chess_data * const out_data)
+{
+    struct array * const array = (struct array *)ctx;
+
+    if(array->next == array->count)
+    {
+        return mt_chess_batch_next_end;
+    }
+    *out_data = array->data[array->next++];
+    return mt_chess_batch_next_position;
+}
+
+static void on_result_of_array(
+    void * const ctx,
+    uint64_t const index,
+    struct mt_chess_search_result const * const result)
+{
+    struct array * const array = (struct array *)ctx;
+
+    assert(result != NULL);
+
+    array->results[index] = *result;
+}
+
+bool mt_chess_batch_run_array(
+    struct mt_chess_data const * const data,
+    uint64_t const count,
+    struct mt_chess_search_limits const * const limits,
+    int const thread_count,
+    struct mt_chess_search_result * const out_results)
+{
+    assert(data != NULL || count == 0);
+    assert(out_results != NULL || count == 0);
+
+    struct array array;
+
+    array.data = data;
+    array.count = count;
+    array.next = 0;
+    array.results = out_results;
+    return mt_chess_batch_run(
+        limits, thread_count, get_next_of_array, on_result_of_array, &array);
+}
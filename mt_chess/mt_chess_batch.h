@@ -0,0 +1,79 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_BATCH
+#define MT_CHESS_BATCH
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_data.h"
+#include "mt_chess_search.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Bulk evaluation: Searches many positions with the same limits (e.g. a fixed
+// depth or node budget) on multiple threads. Positions are pulled from and
+// results pushed to the caller one at a time, so memory use does not depend
+// on the count of positions.
+
+/**
+ * - Return values of the function getting the next position.
+ */
+enum mt_chess_batch_next
+{
+    mt_chess_batch_next_end = 0, // No more positions.
+    mt_chess_batch_next_position = 1,
+    mt_chess_batch_next_invalid = 2 // Not searched, but reported (as NULL).
+};
+
+/**
+ * - Searches the positions given by the get-next function with given limits
+ *   by given count of threads (0 for one per logical processor), each thread
+ *   searching its own copy of a position.
+ * - Calls given get-next function to store the next position (as long as it
+ *   does not return the end) and given result function with the index of a
+ *   position (counting from 0) and its search result (NULL for an invalid
+ *   one), in the order of the positions.
+ * - Calls of the two functions never overlap (so they do not need to be
+ *   thread-safe), but may come from any of the threads.
+ * - At most four positions per thread are in progress or waiting to be
+ *   reported at once.
+ * - Ignores the time manager and the functions of given limits.
+ * - Returns false, if a thread could not be started (after all positions
+ *   were processed by the threads started).
+ */
+bool mt_chess_batch_run(
+    struct mt_chess_search_limits const * const limits,
+    int const thread_count,
+    enum mt_chess_batch_next (*get_next)(
+        void * const ctx, struct mt_chess_data * const out_data),
+    void (*on_result)(
+        void * const ctx,
+        uint64_t const index,
+        struct mt_chess_search_result const * const result),
+    void * const ctx);
+
+/**
+ * - Searches the given count of positions of given array like
+ *   mt_chess_batch_run() and stores the results in given array of the same
+ *   count.
+ */
+bool mt_chess_batch_run_array(
+    struct mt_chess_data const * const data,
+    uint64_t const count,
+    struct mt_chess_search_limits const * const limits,
+    int const thread_count,
+    struct mt_chess_search_result * const out_results);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_BATCH
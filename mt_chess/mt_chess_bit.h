@@ -0,0 +1,109 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_BIT
+#define MT_CHESS_BIT
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstddef>
+    #include <cassert>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <assert.h>
+#endif //__cplusplus
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif //_MSC_VER
+
+// Square masks ("bitboards"):
+//
+// - Bit n represents the board index n (see mt_chess_data.board), which is
+//   row * 8 + col, with row 0 being rank 8 and col 0 being file A.
+// - E.g. a8 is bit 0, h8 is bit 7, a1 is bit 56 and h1 is bit 63.
+
+#define MT_CHESS_BIT_SQUARE(index) (((uint64_t)1) << (index))
+
+/**
+ * - Returns the index of the lowest set bit.
+ * - Given mask must not be zero.
+ */
+static inline int mt_chess_bit_get_first(uint64_t const mask)
+{
+    assert(mask != 0);
+
+#ifdef _MSC_VER
+    unsigned long ret_val = 0;
+
+    #if defined(_M_X64) || defined(_M_ARM64)
+        _BitScanForward64(&ret_val, mask);
+    #else // (32-bit)
+        if(_BitScanForward(&ret_val, (unsigned long)mask))
+        {
+            return (int)ret_val;
+        }
+        _BitScanForward(&ret_val, (unsigned long)(mask >> 32));
+        ret_val += 32;
+    #endif
+    return (int)ret_val;
+#else //_MSC_VER
+    return __builtin_ctzll(mask);
+#endif //_MSC_VER
+}
+
+/**
+ * - Returns the index of the highest set bit.
+ * - Given mask must not be zero.
+ */
+static inline int mt_chess_bit_get_last(uint64_t const mask)
+{
+    assert(mask != 0);
+
+#ifdef _MSC_VER
+    unsigned long ret_val = 0;
+
+    #if defined(_M_X64) || defined(_M_ARM64)
+        _BitScanReverse64(&ret_val, mask);
+    #else // (32-bit)
+        if(_BitScanReverse(&ret_val, (unsigned long)(mask >> 32)))
+        {
+            return (int)ret_val + 32;
+        }
+        _BitScanReverse(&ret_val, (unsigned long)mask);
+    #endif
+    return (int)ret_val;
+#else //_MSC_VER
+    return 63 - __builtin_clzll(mask);
+#endif //_MSC_VER
+}
+
+/**
+ * - Returns the index of the lowest set bit and clears that bit.
+ * - Given mask must not be zero.
+ */
+static inline int mt_chess_bit_pop_first(uint64_t * const mask)
+{
+    assert(mask != NULL && *mask != 0);
+
+    int const ret_val = mt_chess_bit_get_first(*mask);
+
+    *mask &= *mask - 1;
+    return ret_val;
+}
+
+static inline int mt_chess_bit_count(uint64_t const mask)
+{
+#ifdef _MSC_VER
+    #if defined(_M_X64) || defined(_M_ARM64)
+        return (int)__popcnt64(mask);
+    #else // (32-bit)
+        return (int)(__popcnt((unsigned int)mask)
+            + __popcnt((unsigned int)(mask >> 32)));
+    #endif
+#else //_MSC_VER
+    return __builtin_popcountll(mask);
+#endif //_MSC_VER
+}
+
+#endif //MT_CHESS_BIT
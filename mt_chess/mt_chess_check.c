@@ -0,0 +1,247 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_check.h"
+#include "mt_chess_attack.h"
+#include "mt_chess_piece.h"
+#include "mt_chess_color.h"
+#include "mt_chess_type.h"
+#include "mt_chess_row.h"
+#include "mt_chess_col.h"
+#include "mt_chess_bit.h"
+#include "mt_chess_line.h"
+
+static int const s_row_len = (int)mt_chess_col_h + 1;
+
+/**
+ * - Fills given array with a square mask per color and piece type.
+ * - Returns the board index of the king of given color.
+ */
+static int fill_masks(
+    struct mt_chess_piece const * const pieces,
+    uint8_t const * const board,
+    enum mt_chess_color const turn,
+    uint64_t masks[2][6])
+{
+    int ret_val = -1;
+
+    for(int color = 0; color < 2; ++color)
+    {
+        for(int type = 0; type < 6; ++type)
+        {
+            masks[color][type] = 0;
+        }
+    }
+
+    for(int index = 0; index < 8 * 8; ++index)
+    {
+        uint8_t const piece_id = board[index];
+
+        if(piece_id == 0)
+        {
+            continue;
+        }
+
+        struct mt_chess_piece const * const piece =
+            pieces + mt_chess_piece_get_index(pieces, piece_id);
+
+        masks[piece->color][piece->type] |= MT_CHESS_BIT_SQUARE(index);
+
+        if(piece->type == mt_chess_type_king && piece->color == turn)
+        {
+            ret_val = index;
+        }
+    }
+    assert(0 <= ret_val && ret_val < 8 * 8);
+    return ret_val;
+}
+
+/**
+ * - Returns the opponent's pieces attacking the square at given index, with
+ *   sliding pieces being blocked by given occupied squares, only.
+ */
+static uint64_t get_attackers(
+    uint64_t masks[2][6],
+    enum mt_chess_color const turn,
+    int const index,
+    uint64_t const occupied)
+{
+    int const opp = 1 - (int)turn;
+
+    uint64_t const diag =
+        masks[opp][mt_chess_type_bishop] | masks[opp][mt_chess_type_queen];
+    uint64_t const orth =
+        masks[opp][mt_chess_type_rook] | masks[opp][mt_chess_type_queen];
+
+    // A pawn of the turn's color at the given index "sees" exactly those
+    // squares, from where opponent's pawns attack the given index:
+    return (mt_chess_attack_get_pawn(index, turn)
+                & masks[opp][mt_chess_type_pawn])
+        | (mt_chess_attack_get_knight(index)
+                & masks[opp][mt_chess_type_knight])
+        | (mt_chess_attack_get_king(index)
+                & masks[opp][mt_chess_type_king])
+        | (mt_chess_attack_get_bishop(index, occupied) & diag)
+        | (mt_chess_attack_get_rook(index, occupied) & orth);
+}
+
+void mt_chess_check_update(
+    struct mt_chess_check * const check,
+    struct mt_chess_piece const * const pieces,
+    uint8_t const * const board,
+    enum mt_chess_color const turn)
+{
+    assert(check != NULL);
+    assert(pieces != NULL);
+    assert(board != NULL);
+
+    uint64_t masks[2][6];
+    int const king_index = fill_masks(pieces, board, turn, masks);
+    int const opp = 1 - (int)turn;
+    uint64_t own = 0;
+    uint64_t occupied = 0;
+
+    for(int type = 0; type < 6; ++type)
+    {
+        own |= masks[turn][type];
+        occupied |= masks[0][type] | masks[1][type];
+    }
+
+    check->checkers = get_attackers(masks, turn, king_index, occupied);
+    check->evasion = check->checkers == 0 ? ~(uint64_t)0 : 0;
+    check->pinned = 0;
+
+    // Opponent's sliding pieces on a line with the king, to find sliding
+    // checkers (and the squares to block them) and pinned pieces:
+
+    uint64_t const diag = masks[opp][mt_chess_type_bishop]
+        | masks[opp][mt_chess_type_queen];
+    uint64_t const orth = masks[opp][mt_chess_type_rook]
+        | masks[opp][mt_chess_type_queen];
+    uint64_t sliders = diag | orth;
+
+    for(int dir = 0; dir < 8; ++dir)
+    {
+        check->pin_rays[dir] = 0;
+    }
+    while(sliders != 0)
+    {
+        int const index = mt_chess_bit_pop_first(&sliders);
+        int const dir = (int)mt_chess_line_dir[king_index][index];
+        uint64_t const square = MT_CHESS_BIT_SQUARE(index);
+
+        // (the first four directions are the diagonal ones)
+        if(dir == MT_CHESS_LINE_NO_DIR
+            || ((dir < 4 ? diag : orth) & square) == 0)
+        {
+            continue; // Cannot attack along the line to the king.
+        }
+
+        uint64_t const ray = mt_chess_line_between[king_index][index] | square;
+        uint64_t const blockers = ray & occupied & ~square;
+
+        if(blockers == 0)
+        {
+            // Checker found (already part of checkers mask).
+
+            assert((check->checkers & square) != 0);
+            if(mt_chess_bit_count(check->checkers) == 1)
+            {
+                check->evasion = ray;
+            }
+            continue;
+        }
+        if((blockers & own) == blockers && mt_chess_bit_count(blockers) == 1)
+        {
+            check->pinned |= blockers;
+            check->pin_rays[dir] = ray;
+        }
+    }
+
+    if(mt_chess_bit_count(check->checkers) == 1
+        && (check->evasion & check->checkers) == 0)
+    {
+        // Single non-sliding checker. => Capture it, only.
+        check->evasion = check->checkers;
+    }
+
+    // Opponent's attacks, not blocked by the own king:
+
+    check->danger = mt_chess_attack_get_mask(
+        pieces,
+        board,
+        (enum mt_chess_color)opp,
+        occupied & ~MT_CHESS_BIT_SQUARE(king_index));
+}
+
+uint64_t mt_chess_check_get_mask(
+    struct mt_chess_check const * const check, int const from_index)
+{
+    assert(check != NULL);
+    assert(0 <= from_index && from_index < 8 * 8);
+
+    uint64_t const from = MT_CHESS_BIT_SQUARE(from_index);
+
+    if((check->pinned & from) == 0)
+    {
+        return check->evasion; // Not pinned.
+    }
+    for(int dir = 0; dir < 8; ++dir)
+    {
+        if((check->pin_rays[dir] & from) != 0)
+        {
+            return check->evasion & check->pin_rays[dir];
+        }
+    }
+    assert(false); // Must not get here.
+    return 0;
+}
+
+bool mt_chess_check_is_en_passant_safe(
+    struct mt_chess_piece const * const pieces,
+    uint8_t const * const board,
+    enum mt_chess_color const turn,
+    int const from_index,
+    int const to_index)
+{
+    assert(pieces != NULL);
+    assert(board != NULL);
+    assert(0 <= from_index && from_index < 8 * 8);
+    assert(0 <= to_index && to_index < 8 * 8);
+
+    uint64_t masks[2][6];
+    int const king_index = fill_masks(pieces, board, turn, masks);
+    int const opp = 1 - (int)turn;
+
+    // The captured pawn is at the from-row and the to-column:
+    int const captured_index =
+        (from_index / s_row_len) * s_row_len + to_index % s_row_len;
+
+    uint64_t const from = MT_CHESS_BIT_SQUARE(from_index);
+    uint64_t const to = MT_CHESS_BIT_SQUARE(to_index);
+    uint64_t const captured = MT_CHESS_BIT_SQUARE(captured_index);
+
+    assert((masks[opp][mt_chess_type_pawn] & captured) != 0);
+
+    uint64_t occupied = 0;
+
+    for(int type = 0; type < 6; ++type)
+    {
+        occupied |= masks[0][type] | masks[1][type];
+    }
+    occupied = (occupied & ~from & ~captured) | to;
+    masks[opp][mt_chess_type_pawn] &= ~captured;
+
+    return get_attackers(masks, turn, king_index, occupied) == 0;
+}
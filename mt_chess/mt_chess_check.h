@@ -0,0 +1,81 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_CHECK
+#define MT_CHESS_CHECK
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_piece.h"
+#include "mt_chess_color.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+/**
+ * - King-safety information about the player having the turn, computed once
+ *   per position (see mt_chess_check_update()).
+ * - All members are square masks as described in mt_chess_bit.h.
+ */
+struct mt_chess_check
+{
+    // Opponent's pieces giving check.
+    uint64_t checkers;
+
+    // Destination squares that resolve a check by capture or interposition
+    // (all squares, if not in check, no square, if in double check).
+    // Not to be used for king moves.
+    uint64_t evasion;
+
+    // Own pieces pinned to the own king.
+    uint64_t pinned;
+
+    // Per direction from the king: The squares from (excluding) the king up to
+    // (including) the pinning piece, if there is a pinned piece in that
+    // direction. Zero, otherwise.
+    uint64_t pin_rays[8];
+
+    // Squares attacked by the opponent, with attacks x-raying through the own
+    // king (the king must not step "away" along an attacking line).
+    uint64_t danger;
+};
+
+void mt_chess_check_update(
+    struct mt_chess_check * const check,
+    struct mt_chess_piece const * const pieces,
+    uint8_t const * const board,
+    enum mt_chess_color const turn);
+
+/**
+ * - Returns the destination squares that do not leave the own king in check,
+ *   if the (non-king) piece at given board index moves.
+ * - Does not cover the additional pawn removed by an "en passant" move (see
+ *   mt_chess_check_is_en_passant_safe()).
+ */
+uint64_t mt_chess_check_get_mask(
+    struct mt_chess_check const * const check, int const from_index);
+
+/**
+ * - Returns true, if the "en passant" move given does not leave the own king
+ *   in check.
+ * - Slow path (recomputes the attackers of the king), but "en passant" moves
+ *   are rare and the only moves removing two pieces from a line at once.
+ */
+bool mt_chess_check_is_en_passant_safe(
+    struct mt_chess_piece const * const pieces,
+    uint8_t const * const board,
+    enum mt_chess_color const turn,
+    int const from_index,
+    int const to_index);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_CHECK
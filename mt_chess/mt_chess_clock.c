@@ -0,0 +1,47 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 199309L // For clock_gettime().
+#endif //_WIN32
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cassert>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <assert.h>
+#endif //__cplusplus
+
+#ifdef _WIN32
+    #include <windows.h>
+#else //_WIN32
+    #include <time.h>
+#endif //_WIN32
+
+#include "mt_chess_clock.h"
+
+uint64_t mt_chess_clock_get_ns(void)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER s_frequency = { 0 }; // (benign race)
+    LARGE_INTEGER counter;
+
+    if(s_frequency.QuadPart == 0)
+    {
+        QueryPerformanceFrequency(&s_frequency);
+    }
+    QueryPerformanceCounter(&counter);
+
+    // Split to avoid overflow of counter * 1e9:
+    return (uint64_t)(counter.QuadPart / s_frequency.QuadPart) * 1000000000ULL
+        + (uint64_t)(counter.QuadPart % s_frequency.QuadPart) * 1000000000ULL
+            / (uint64_t)s_frequency.QuadPart;
+#else //_WIN32
+    struct timespec t;
+    int const result = clock_gettime(CLOCK_MONOTONIC, &t);
+
+    assert(result == 0);
+    (void)result;
+    return (uint64_t)t.tv_sec * 1000000000ULL + (uint64_t)t.tv_nsec;
+#endif //_WIN32
+}
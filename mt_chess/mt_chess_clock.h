@@ -0,0 +1,26 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_CLOCK
+#define MT_CHESS_CLOCK
+
+#ifdef __cplusplus
+    #include <cstdint>
+#else //__cplusplus
+    #include <stdint.h>
+#endif //__cplusplus
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+/**
+ * - Returns the current value of a monotonic clock in nanoseconds.
+ * - Just meaningful as difference between two calls.
+ */
+uint64_t mt_chess_clock_get_ns(void);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_CLOCK
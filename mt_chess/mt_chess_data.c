@@ -19,10 +19,51 @@
 #include "mt_chess_col.h"
 #include "mt_chess_color.h"
 #include "mt_chess_type.h"
-#include "mt_chess_attack.h"
+#include "mt_chess_check.h"
+#include "mt_chess_move.h"
+#include "mt_chess_zobrist.h"
+#include "mt_chess_stats.h"
 
 static int const s_row_len = (int)mt_chess_col_h + 1;
 
+// Index of the first piece of a type of a color (see mt_chess_piece_init()),
+// indexed by enum mt_chess_type:
+//
+static int const s_first_piece[6] = { 0, 1, 9, 11, 13, 15 };
+
+// Count of pieces of a type of a color at the start, indexed by enum
+// mt_chess_type:
+//
+static int const s_start_count[6] = { 1, 8, 2, 2, 2, 1 };
+
+#ifndef __cplusplus
+_Static_assert(
+    sizeof(struct mt_chess_data) <= 5 * 64,
+    "mt_chess_data must fit in five cache lines.");
+#endif //__cplusplus
+
+// Castling rights to keep, if a move starts or ends at the board index:
+static uint8_t const s_castling_keep[8 * 8] = {
+    0xF & ~MT_CHESS_DATA_CASTLING_BLACK_QUEENSIDE, // a8
+    0xF, 0xF, 0xF,
+    0xF & ~(MT_CHESS_DATA_CASTLING_BLACK_KINGSIDE
+        | MT_CHESS_DATA_CASTLING_BLACK_QUEENSIDE), // e8
+    0xF, 0xF,
+    0xF & ~MT_CHESS_DATA_CASTLING_BLACK_KINGSIDE, // h8
+    0xF, 0xF, 0xF, 0xF, 0xF, 0xF, 0xF, 0xF,
+    0xF, 0xF, 0xF, 0xF, 0xF, 0xF, 0xF, 0xF,
+    0xF, 0xF, 0xF, 0xF, 0xF, 0xF, 0xF, 0xF,
+    0xF, 0xF, 0xF, 0xF, 0xF, 0xF, 0xF, 0xF,
+    0xF, 0xF, 0xF, 0xF, 0xF, 0xF, 0xF, 0xF,
+    0xF, 0xF, 0xF, 0xF, 0xF, 0xF, 0xF, 0xF,
+    0xF & ~MT_CHESS_DATA_CASTLING_WHITE_QUEENSIDE, // a1
+    0xF, 0xF, 0xF,
+    0xF & ~(MT_CHESS_DATA_CASTLING_WHITE_KINGSIDE
+        | MT_CHESS_DATA_CASTLING_WHITE_QUEENSIDE), // e1
+    0xF, 0xF,
+    0xF & ~MT_CHESS_DATA_CASTLING_WHITE_KINGSIDE // h1
+};
+
 /**
  * - It is wasteful using this function to get the ID of a specific piece
  *   described by the given parameters, but it is used to avoid hard-coded stuff
@@ -165,43 +206,365 @@ static void init_board(
     add_pieces_of_given_color_to_board(mt_chess_color_white, pieces, board);
 }
 
-void mt_chess_data_free(struct mt_chess_data * const data)
+void mt_chess_data_init(struct mt_chess_data * const data)
 {
-    if(data == NULL)
+    assert(data != NULL);
+
+    mt_chess_piece_init(data->pieces);
+    init_board(data->pieces, data->board);
+    data->turn = (uint8_t)mt_chess_color_white; // <- Has the first turn.
+    data->castling = MT_CHESS_DATA_CASTLING_WHITE_KINGSIDE
+        | MT_CHESS_DATA_CASTLING_WHITE_QUEENSIDE
+        | MT_CHESS_DATA_CASTLING_BLACK_KINGSIDE
+        | MT_CHESS_DATA_CASTLING_BLACK_QUEENSIDE;
+    data->en_passant = MT_CHESS_DATA_NO_EN_PASSANT;
+    data->halfmove_clock = 0;
+    data->ply = 0;
+    data->hash = mt_chess_zobrist_get(data);
+    data->pawn_hash = mt_chess_zobrist_get_pawns(data);
+    mt_chess_data_update_check(data);
+}
+
+bool mt_chess_data_set_pieces(
+    struct mt_chess_data * const data, int8_t const * const squares)
+{
+    assert(data != NULL);
+    assert(squares != NULL);
+
+    int counts[2][6] = { { 0 } };
+
+    for(int index = 0; index < 8 * 8; ++index)
     {
-        assert(false); // Although no problem (here).
-        return;
+        if(squares[index] != 0)
+        {
+            int const color = squares[index] < 0 ? 1 : 0;
+            int const type =
+                (squares[index] < 0 ? -squares[index] : squares[index]) - 1;
+
+            assert(0 <= type && type <= (int)mt_chess_type_queen);
+
+            ++counts[color][type];
+        }
     }
-    
-    if(data->log != NULL)
+
+    for(int color = 0; color < 2; ++color)
+    {
+        int extra = 0;
+
+        for(int type = (int)mt_chess_type_knight;
+            type <= (int)mt_chess_type_queen;
+            ++type)
+        {
+            if(s_start_count[type] < counts[color][type])
+            {
+                extra += counts[color][type] - s_start_count[type];
+            }
+        }
+        if(counts[color][mt_chess_type_king] != 1
+            || s_start_count[mt_chess_type_pawn]
+                < counts[color][mt_chess_type_pawn] + extra)
+        {
+            return false;
+        }
+    }
+
+    int used[2][6] = { { 0 } };
+    int promoted[2] = { 0, 0 }; // Taken from the last pawn downwards.
+
+    mt_chess_piece_init(data->pieces);
+    for(int index = 0; index < 8 * 8; ++index)
+    {
+        if(squares[index] == 0)
+        {
+            data->board[index] = 0;
+            continue;
+        }
+
+        int const color = squares[index] < 0 ? 1 : 0;
+        int const type =
+            (squares[index] < 0 ? -squares[index] : squares[index]) - 1;
+        int const row = index / s_row_len;
+        int piece_index = color * 2 * s_row_len;
+
+        if(type == (int)mt_chess_type_pawn
+            && (row == (int)mt_chess_row_8 || row == (int)mt_chess_row_1))
+        {
+            return false;
+        }
+        if(used[color][type] < s_start_count[type])
+        {
+            piece_index += s_first_piece[type] + used[color][type];
+            ++used[color][type];
+        }
+        else
+        {
+            ++promoted[color];
+            piece_index += s_first_piece[mt_chess_type_pawn]
+                + s_start_count[mt_chess_type_pawn] - promoted[color];
+            data->pieces[piece_index].type = (uint8_t)type;
+        }
+        data->board[index] = data->pieces[piece_index].id;
+    }
+    return true;
+}
+
+void mt_chess_data_update_check(struct mt_chess_data * const data)
+{
+    assert(data != NULL);
+
+    MT_CHESS_STATS_BEGIN(stats_begin);
+
+    mt_chess_check_update(
+        &data->check,
+        data->pieces,
+        data->board,
+        (enum mt_chess_color)data->turn);
+
+    MT_CHESS_STATS_END(mt_chess_stats_id_check_update, stats_begin);
+}
+
+/**
+ * - Returns, if there is a pawn of given color next to given board index (at
+ *   the same row).
+ */
+static bool is_pawn_beside(
+    struct mt_chess_data const * const data,
+    int const index,
+    enum mt_chess_color const color)
+{
+    int const col = index % s_row_len;
+
+    for(int add = -1; add <= 1; add += 2)
     {
-        mt_chess_log_node_free(data->log);
-        data->log = NULL;
+        if(col + add < (int)mt_chess_col_a || (int)mt_chess_col_h < col + add)
+        {
+            continue;
+        }
+
+        uint8_t const piece_id = data->board[index + add];
+
+        if(piece_id == 0)
+        {
+            continue;
+        }
+
+        struct mt_chess_piece const * const piece =
+            data->pieces + mt_chess_piece_get_index(data->pieces, piece_id);
+
+        if(piece->type == mt_chess_type_pawn && piece->color == color)
+        {
+            return true;
+        }
     }
-    free(data);
+    return false;
 }
 
-struct mt_chess_data * mt_chess_data_create(void)
+/**
+ * - Returns the board index of the piece caught by given move, which is the
+ *   to-square, except for "en passant".
+ */
+static int get_captured_index(uint16_t const move)
 {
-    struct mt_chess_data * const ret_val =
-        (struct mt_chess_data *)malloc(sizeof *ret_val);
-        
-    assert(ret_val != NULL);
-    
-    mt_chess_piece_init(ret_val->pieces);
-    init_board(ret_val->pieces, ret_val->board);
-    mt_chess_attack_update(
-        ret_val->pieces,
-        ret_val->board,
-        mt_chess_color_black, // <- Initial attacker.
-        ret_val->attacked_by_black);
-    mt_chess_attack_update(
-        ret_val->pieces,
-        ret_val->board,
-        mt_chess_color_white,
-        ret_val->attacked_by_white);
-    ret_val->turn = mt_chess_color_white; // <- Has the first turn.
-    ret_val->log = NULL;
-    
-    return ret_val;
-}
\ No newline at end of file
+    int const to_index = mt_chess_move_get_to(move);
+
+    if(mt_chess_move_get_special(move) != mt_chess_move_special_en_passant)
+    {
+        return to_index;
+    }
+
+    int const from_index = mt_chess_move_get_from(move);
+
+    // The opponent's pawn is at the from-row and the to-column:
+    return from_index - from_index % s_row_len + to_index % s_row_len;
+}
+
+void mt_chess_data_apply_move(
+    struct mt_chess_data * const data,
+    uint16_t const move,
+    struct mt_chess_data_undo * const out_undo)
+{
+    assert(data != NULL);
+
+    int const from_index = mt_chess_move_get_from(move);
+    int const to_index = mt_chess_move_get_to(move);
+    enum mt_chess_move_special const special = mt_chess_move_get_special(move);
+    uint8_t const piece_id = data->board[from_index];
+    int const captured_index = get_captured_index(move);
+    uint8_t const captured_id = data->board[captured_index];
+
+    assert(piece_id != 0);
+
+    struct mt_chess_piece * const piece =
+        data->pieces + mt_chess_piece_get_index(data->pieces, piece_id);
+
+    assert(piece->color == data->turn);
+
+    if(out_undo != NULL)
+    {
+        out_undo->hash = data->hash;
+        out_undo->halfmove_clock = data->halfmove_clock;
+        out_undo->captured = captured_id;
+        out_undo->castling = data->castling;
+        out_undo->en_passant = data->en_passant;
+    }
+
+    uint64_t hash = data->hash;
+
+    if(captured_id != 0)
+    {
+        struct mt_chess_piece const * const captured = data->pieces
+            + mt_chess_piece_get_index(data->pieces, captured_id);
+        uint64_t const key = mt_chess_zobrist_pieces[captured->color][
+            captured->type][captured_index];
+
+        hash ^= key;
+        if(captured->type == mt_chess_type_pawn)
+        {
+            data->pawn_hash ^= key;
+        }
+    }
+    hash ^= mt_chess_zobrist_pieces[piece->color][piece->type][from_index];
+    if(piece->type == mt_chess_type_pawn)
+    {
+        data->pawn_hash ^= mt_chess_zobrist_pieces[piece->color][
+            mt_chess_type_pawn][from_index];
+    }
+
+    if(special == mt_chess_move_special_castling)
+    {
+        int rook_from_index = -1;
+        int rook_to_index = -1;
+
+        mt_chess_move_get_castling_rook(move, &rook_from_index, &rook_to_index);
+
+        hash ^= mt_chess_zobrist_pieces[piece->color][mt_chess_type_rook][
+                rook_from_index]
+            ^ mt_chess_zobrist_pieces[piece->color][mt_chess_type_rook][
+                rook_to_index];
+    }
+
+    hash ^= mt_chess_zobrist_castling[data->castling];
+    data->castling &= s_castling_keep[from_index] & s_castling_keep[to_index];
+    hash ^= mt_chess_zobrist_castling[data->castling];
+
+    ++data->halfmove_clock;
+    if(piece->type == mt_chess_type_pawn || captured_id != 0)
+    {
+        data->halfmove_clock = 0; // Pawn move or catch.
+    }
+    ++data->ply;
+
+    if(data->en_passant != MT_CHESS_DATA_NO_EN_PASSANT)
+    {
+        hash ^= mt_chess_zobrist_en_passant[data->en_passant % s_row_len];
+        data->en_passant = MT_CHESS_DATA_NO_EN_PASSANT;
+    }
+    if(piece->type == mt_chess_type_pawn
+        && abs(to_index - from_index) == 2 * s_row_len
+        && is_pawn_beside(
+            data, to_index, (enum mt_chess_color)(1 - (int)data->turn)))
+    {
+        data->en_passant = (uint8_t)((from_index + to_index) / 2);
+        hash ^= mt_chess_zobrist_en_passant[data->en_passant % s_row_len];
+    }
+
+    mt_chess_move_apply(move, data->board);
+
+    if(special == mt_chess_move_special_promotion)
+    {
+        assert(piece->type == mt_chess_type_pawn);
+
+        piece->type = (uint8_t)mt_chess_move_get_promotion(move);
+    }
+    hash ^= mt_chess_zobrist_pieces[piece->color][piece->type][to_index];
+    if(piece->type == mt_chess_type_pawn)
+    {
+        data->pawn_hash ^= mt_chess_zobrist_pieces[piece->color][
+            mt_chess_type_pawn][to_index];
+    }
+
+    hash ^= mt_chess_zobrist_black;
+    data->hash = hash;
+
+    data->turn = (uint8_t)(1 - (int)data->turn);
+    mt_chess_data_update_check(data);
+}
+
+void mt_chess_data_undo_move(
+    struct mt_chess_data * const data,
+    uint16_t const move,
+    struct mt_chess_data_undo const * const undo)
+{
+    assert(data != NULL);
+    assert(undo != NULL);
+    assert(0 < data->ply);
+
+    int const from_index = mt_chess_move_get_from(move);
+    int const to_index = mt_chess_move_get_to(move);
+    enum mt_chess_move_special const special = mt_chess_move_get_special(move);
+    uint8_t const piece_id = data->board[to_index];
+
+    assert(piece_id != 0);
+    assert(data->board[from_index] == 0);
+
+    struct mt_chess_piece * const piece =
+        data->pieces + mt_chess_piece_get_index(data->pieces, piece_id);
+
+    data->turn = (uint8_t)(1 - (int)data->turn);
+
+    assert(piece->color == data->turn);
+
+    // The pawn hash is updated like by mt_chess_data_apply_move() (XOR being
+    // its own inverse), because the undo record does not hold it:
+
+    if(piece->type == mt_chess_type_pawn)
+    {
+        data->pawn_hash ^= mt_chess_zobrist_pieces[piece->color][
+            mt_chess_type_pawn][to_index];
+    }
+    if(special == mt_chess_move_special_promotion)
+    {
+        piece->type = (uint8_t)mt_chess_type_pawn;
+    }
+    if(piece->type == mt_chess_type_pawn)
+    {
+        data->pawn_hash ^= mt_chess_zobrist_pieces[piece->color][
+            mt_chess_type_pawn][from_index];
+    }
+    if(undo->captured != 0)
+    {
+        struct mt_chess_piece const * const captured = data->pieces
+            + mt_chess_piece_get_index(data->pieces, undo->captured);
+
+        if(captured->type == mt_chess_type_pawn)
+        {
+            data->pawn_hash ^= mt_chess_zobrist_pieces[captured->color][
+                mt_chess_type_pawn][get_captured_index(move)];
+        }
+    }
+
+    data->board[from_index] = piece_id;
+    data->board[to_index] = 0;
+    data->board[get_captured_index(move)] = undo->captured;
+
+    if(special == mt_chess_move_special_castling)
+    {
+        int rook_from_index = -1;
+        int rook_to_index = -1;
+
+        mt_chess_move_get_castling_rook(move, &rook_from_index, &rook_to_index);
+
+        assert(data->board[rook_from_index] == 0);
+
+        data->board[rook_from_index] = data->board[rook_to_index];
+        data->board[rook_to_index] = 0;
+    }
+
+    data->hash = undo->hash;
+    data->halfmove_clock = undo->halfmove_clock;
+    data->castling = undo->castling;
+    data->en_passant = undo->en_passant;
+    --data->ply;
+
+    mt_chess_data_update_check(data);
+}
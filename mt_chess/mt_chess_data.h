@@ -6,50 +6,133 @@
 
 #ifdef __cplusplus
     #include <cstdint>
+    #include <cstdbool>
 #else //__cplusplus
     #include <stdint.h>
+    #include <stdbool.h>
 #endif //__cplusplus
 
 #include "mt_chess_piece.h"
-#include "mt_chess_log_node.h"
 #include "mt_chess_row.h"
 #include "mt_chess_col.h"
 #include "mt_chess_color.h"
+#include "mt_chess_check.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif //__cplusplus
 
+// Castling rights (bits of mt_chess_data.castling):
+//
+#define MT_CHESS_DATA_CASTLING_WHITE_KINGSIDE 1
+#define MT_CHESS_DATA_CASTLING_WHITE_QUEENSIDE 2
+#define MT_CHESS_DATA_CASTLING_BLACK_KINGSIDE 4
+#define MT_CHESS_DATA_CASTLING_BLACK_QUEENSIDE 8
+
+// Value of mt_chess_data.en_passant, if there is no "en passant" square.
+//
+#define MT_CHESS_DATA_NO_EN_PASSANT 0xFF
+
+/**
+ * - A position: Plain data of fixed size without pointers, so copying (e.g. for
+ *   a worker thread or copy-make search) is a single memcpy().
+ * - Members are ordered by alignment (largest first) to avoid padding.
+ */
 struct mt_chess_data
 {
-    struct mt_chess_piece pieces[2 * 2 * ((int)mt_chess_col_h + 1)];
-    
+    // King-safety information about the player having the turn.
+    struct mt_chess_check check;
+
+    // Zobrist hash of the position (see mt_chess_zobrist.h).
+    uint64_t hash;
+
+    // Zobrist hash of the pawns, only (e.g. for caching pawn-structure
+    // evaluation, see mt_chess_zobrist.h).
+    uint64_t pawn_hash;
+
+    // Half-moves since the last catch or pawn move (for the 50-move rule).
+    uint16_t halfmove_clock;
+
+    // Half-moves done since the start of the game.
+    uint16_t ply;
+
     // Holds mt_chess_piece.id values or 0 (= empty).
     uint8_t board[((int)mt_chess_row_1 + 1) * ((int)mt_chess_col_h + 1)];
-    
-    // Squares being attacked by black.
-    uint8_t attacked_by_black[
-        ((int)mt_chess_row_1 + 1) * ((int)mt_chess_col_h + 1)];
 
-    // Squares being attacked by white.
-    uint8_t attacked_by_white[
-        ((int)mt_chess_row_1 + 1) * ((int)mt_chess_col_h + 1)];
+    struct mt_chess_piece pieces[2 * 2 * ((int)mt_chess_col_h + 1)];
+
+    uint8_t turn; // Holds value of enumeration mt_chess_color.
+
+    // Castling rights still available (see MT_CHESS_DATA_CASTLING_*). Lost, as
+    // soon as the king or the respective rook moves or is caught.
+    uint8_t castling;
 
-    enum mt_chess_color turn;
+    // Board index of the square a pawn skipped by moving two squares forward
+    // with the last move, or MT_CHESS_DATA_NO_EN_PASSANT. Set only, if an
+    // opponent's pawn stands next to the moved pawn (so the hash differs only,
+    // if the possible moves differ).
+    uint8_t en_passant;
+};
 
-    struct mt_chess_log_node * log;
+/**
+ * - What is needed to take back a move, in addition to the move itself.
+ */
+struct mt_chess_data_undo
+{
+    uint64_t hash;
+    uint16_t halfmove_clock;
+    uint8_t captured; // ID of the caught piece or 0.
+    uint8_t castling;
+    uint8_t en_passant;
 };
 
 /**
- * - Will take ownership of given object (pointer will be invalid after call).
+ * - Initializes given object with the start position.
+ */
+void mt_chess_data_init(struct mt_chess_data * const data);
+
+/**
+ * - Sets board and pieces of given position to given pieces per board index
+ *   (type of enumeration mt_chess_type plus one, negative for black, 0 for
+ *   empty), e.g. for a position not reached from the start position.
+ * - Each piece gets the ID of a piece of its type of the start position,
+ *   pieces exceeding the start count get the ID of a pawn (as if promoted).
+ *   Pieces not on the board keep their type of the start position (as if
+ *   caught).
+ * - Returns false, if not possible (not exactly one king per side, more
+ *   pieces than promotions could give or pawns on the first or last row).
+ * - Does not change anything else (e.g. the hash).
+ */
+bool mt_chess_data_set_pieces(
+    struct mt_chess_data * const data, int8_t const * const squares);
+
+/**
+ * - To be called after each change of the board and/or turn.
+ */
+void mt_chess_data_update_check(struct mt_chess_data * const data);
+
+/**
+ * - Applies given packed move (see mt_chess_move.h) to the position, which
+ *   includes promotion, castling rights, "en passant" square, turn, hash and
+ *   king-safety information.
+ * - Does NOT log the move.
+ * - Does no error handling/detection! Given move must be legal.
+ * - Fills given undo record, if not NULL (see mt_chess_data_undo_move()).
  */
-void mt_chess_data_free(struct mt_chess_data * const data);
+void mt_chess_data_apply_move(
+    struct mt_chess_data * const data,
+    uint16_t const move,
+    struct mt_chess_data_undo * const out_undo);
 
 /**
- * - Free via mt_chess_data_free() after usage.
- * - Just does nothing, if NULL given.
+ * - Takes back given move, which must be the last move applied to the
+ *   position, using the undo record filled by mt_chess_data_apply_move().
+ * - Constant time.
  */
-struct mt_chess_data * mt_chess_data_create(void);
+void mt_chess_data_undo_move(
+    struct mt_chess_data * const data,
+    uint16_t const move,
+    struct mt_chess_data_undo const * const undo);
 
 #ifdef __cplusplus
 }
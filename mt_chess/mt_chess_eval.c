@@ -0,0 +1,179 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_eval.h"
+#include "mt_chess_data.h"
+#include "mt_chess_piece.h"
+#include "mt_chess_color.h"
+#include "mt_chess_type.h"
+#include "mt_chess_pawn.h"
+
+// Indexed by enum mt_chess_type:
+static int const s_values[6] = { 0, 100, 320, 330, 500, 900 };
+
+// Piece-square tables from white's point of view, indexed by board index (a8
+// first). Black uses the vertically mirrored index.
+
+static int8_t const s_king[8 * 8] = {
+    -30, -40, -40, -50, -50, -40, -40, -30,
+    -30, -40, -40, -50, -50, -40, -40, -30,
+    -30, -40, -40, -50, -50, -40, -40, -30,
+    -30, -40, -40, -50, -50, -40, -40, -30,
+    -20, -30, -30, -40, -40, -30, -30, -20,
+    -10, -20, -20, -20, -20, -20, -20, -10,
+     20,  20,   0,   0,   0,   0,  20,  20,
+     20,  30,  10,   0,   0,  10,  30,  20
+};
+
+static int8_t const s_pawn[8 * 8] = {
+      0,   0,   0,   0,   0,   0,   0,   0,
+     50,  50,  50,  50,  50,  50,  50,  50,
+     10,  10,  20,  30,  30,  20,  10,  10,
+      5,   5,  10,  25,  25,  10,   5,   5,
+      0,   0,   0,  20,  20,   0,   0,   0,
+      5,  -5, -10,   0,   0, -10,  -5,   5,
+      5,  10,  10, -20, -20,  10,  10,   5,
+      0,   0,   0,   0,   0,   0,   0,   0
+};
+
+static int8_t const s_knight[8 * 8] = {
+    -50, -40, -30, -30, -30, -30, -40, -50,
+    -40, -20,   0,   0,   0,   0, -20, -40,
+    -30,   0,  10,  15,  15,  10,   0, -30,
+    -30,   5,  15,  20,  20,  15,   5, -30,
+    -30,   0,  15,  20,  20,  15,   0, -30,
+    -30,   5,  10,  15,  15,  10,   5, -30,
+    -40, -20,   0,   5,   5,   0, -20, -40,
+    -50, -40, -30, -30, -30, -30, -40, -50
+};
+
+static int8_t const s_bishop[8 * 8] = {
+    -20, -10, -10, -10, -10, -10, -10, -20,
+    -10,   0,   0,   0,   0,   0,   0, -10,
+    -10,   0,   5,  10,  10,   5,   0, -10,
+    -10,   5,   5,  10,  10,   5,   5, -10,
+    -10,   0,  10,  10,  10,  10,   0, -10,
+    -10,  10,  10,  10,  10,  10,  10, -10,
+    -10,   5,   0,   0,   0,   0,   5, -10,
+    -20, -10, -10, -10, -10, -10, -10, -20
+};
+
+static int8_t const s_rook[8 * 8] = {
+      0,   0,   0,   0,   0,   0,   0,   0,
+      5,  10,  10,  10,  10,  10,  10,   5,
+     -5,   0,   0,   0,   0,   0,   0,  -5,
+     -5,   0,   0,   0,   0,   0,   0,  -5,
+     -5,   0,   0,   0,   0,   0,   0,  -5,
+     -5,   0,   0,   0,   0,   0,   0,  -5,
+     -5,   0,   0,   0,   0,   0,   0,  -5,
+      0,   0,   0,   5,   5,   0,   0,   0
+};
+
+static int8_t const s_queen[8 * 8] = {
+    -20, -10, -10,  -5,  -5, -10, -10, -20,
+    -10,   0,   0,   0,   0,   0,   0, -10,
+    -10,   0,   5,   5,   5,   5,   0, -10,
+     -5,   0,   5,   5,   5,   5,   0,  -5,
+      0,   0,   5,   5,   5,   5,   0,  -5,
+    -10,   5,   5,   5,   5,   5,   0, -10,
+    -10,   0,   5,   0,   0,   0,   0, -10,
+    -20, -10, -10,  -5,  -5, -10, -10, -20
+};
+
+// Indexed by enum mt_chess_type:
+static int8_t const * const s_tables[6] = {
+    s_king, s_pawn, s_knight, s_bishop, s_rook, s_queen
+};
+
+int mt_chess_eval_get_value(enum mt_chess_type const type)
+{
+    assert(0 <= (int)type && (int)type < 6);
+
+    return s_values[type];
+}
+
+int mt_chess_eval_get(struct mt_chess_data const * const data)
+{
+    assert(data != NULL);
+
+    int white = 0; // White's score minus black's score.
+    uint64_t pawns[2] = { 0, 0 }; // Per color, bit n for board index n.
+    int king_index[2] = { -1, -1 }; // Per color.
+    bool has_queen[2] = { false, false }; // Per color.
+
+    for(int index = 0; index < 8 * 8; ++index)
+    {
+        uint8_t const piece_id = data->board[index];
+
+        if(piece_id == 0)
+        {
+            continue;
+        }
+
+        struct mt_chess_piece const * const piece =
+            data->pieces + mt_chess_piece_get_index(data->pieces, piece_id);
+
+        switch((enum mt_chess_type)piece->type)
+        {
+            case mt_chess_type_pawn:
+            {
+                pawns[piece->color] |= 1ULL << index;
+                break;
+            }
+            case mt_chess_type_king:
+            {
+                king_index[piece->color] = index;
+                break;
+            }
+            case mt_chess_type_queen:
+            {
+                has_queen[piece->color] = true;
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+
+        if(piece->color == mt_chess_color_white)
+        {
+            white += s_values[piece->type] + s_tables[piece->type][index];
+            continue;
+        }
+        white -= s_values[piece->type] + s_tables[piece->type][index ^ 56];
+    }
+
+    struct mt_chess_pawn_entry const * const pawn_entry =
+        mt_chess_pawn_probe(data->pawn_hash, pawns);
+
+    white += pawn_entry->score;
+
+    // King shelter, while the opponent has a queen to attack with and the
+    // king is on one of the first two rows of its side:
+    //
+    if(has_queen[mt_chess_color_black]
+        && 6 * 8 <= king_index[mt_chess_color_white])
+    {
+        white += pawn_entry->shelter[mt_chess_color_white][
+            king_index[mt_chess_color_white] % 8];
+    }
+    if(has_queen[mt_chess_color_white]
+        && king_index[mt_chess_color_black] < 2 * 8)
+    {
+        white -= pawn_entry->shelter[mt_chess_color_black][
+            king_index[mt_chess_color_black] % 8];
+    }
+    return data->turn == mt_chess_color_white ? white : -white;
+}
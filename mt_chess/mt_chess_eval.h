@@ -0,0 +1,32 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_EVAL
+#define MT_CHESS_EVAL
+
+#include "mt_chess_data.h"
+#include "mt_chess_type.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+/**
+ * - Returns the static evaluation of given position in centipawns, from the
+ *   point of view of the player having the turn (positive is good for that
+ *   player).
+ * - Material plus piece-square tables plus pawn structure and king shelter
+ *   (see mt_chess_pawn.h).
+ */
+int mt_chess_eval_get(struct mt_chess_data const * const data);
+
+/**
+ * - Returns the material value of given piece type in centipawns (0 for
+ *   king).
+ */
+int mt_chess_eval_get_value(enum mt_chess_type const type);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_EVAL
@@ -0,0 +1,480 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_fen.h"
+#include "mt_chess_data.h"
+#include "mt_chess_piece.h"
+#include "mt_chess_color.h"
+#include "mt_chess_type.h"
+#include "mt_chess_row.h"
+#include "mt_chess_col.h"
+#include "mt_chess_zobrist.h"
+
+static int const s_row_len = (int)mt_chess_col_h + 1;
+
+// Indexed by enum mt_chess_type (white, black gets lower case):
+//
+static char const s_letters[6] = { 'K', 'P', 'N', 'B', 'R', 'Q' };
+
+// Castling rights with the board indices of king and rook they need:
+//
+static struct
+{
+    char letter;
+    uint8_t right;
+    uint8_t color;
+    uint8_t king_index;
+    uint8_t rook_index;
+} const s_castlings[4] = {
+    {
+        'K', MT_CHESS_DATA_CASTLING_WHITE_KINGSIDE,
+        mt_chess_color_white, 60, 63 // e1, h1
+    },
+    {
+        'Q', MT_CHESS_DATA_CASTLING_WHITE_QUEENSIDE,
+        mt_chess_color_white, 60, 56 // e1, a1
+    },
+    {
+        'k', MT_CHESS_DATA_CASTLING_BLACK_KINGSIDE,
+        mt_chess_color_black, 4, 7 // e8, h8
+    },
+    {
+        'q', MT_CHESS_DATA_CASTLING_BLACK_QUEENSIDE,
+        mt_chess_color_black, 4, 0 // e8, a8
+    }
+};
+
+static bool is_space(char const c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static char const * skip_space(char const * str)
+{
+    while(is_space(*str))
+    {
+        ++str;
+    }
+    return str;
+}
+
+/**
+ * - Returns the type of given (upper or lower case) piece letter and sets the
+ *   color, or returns -1, if it is no piece letter.
+ */
+static int get_type(char const c, enum mt_chess_color * const out_color)
+{
+    bool const is_black = 'a' <= c && c <= 'z';
+    char const upper = is_black ? (char)(c - 'a' + 'A') : c;
+
+    for(int type = 0; type < 6; ++type)
+    {
+        if(s_letters[type] == upper)
+        {
+            *out_color = is_black ? mt_chess_color_black : mt_chess_color_white;
+            return type;
+        }
+    }
+    return -1;
+}
+
+/**
+ * - Returns the type of the piece at given board index or -1, if there is
+ *   no piece of given color.
+ */
+static int get_type_at(
+    struct mt_chess_data const * const data,
+    int const index,
+    enum mt_chess_color const color)
+{
+    uint8_t const id = data->board[index];
+
+    if(id == 0)
+    {
+        return -1;
+    }
+
+    struct mt_chess_piece const * const piece =
+        data->pieces + mt_chess_piece_get_index(data->pieces, id);
+
+    return piece->color == (uint8_t)color ? (int)piece->type : -1;
+}
+
+/**
+ * - Reads the board field of a FEN into given board (see
+ *   mt_chess_data_set_pieces()).
+ * - Returns a pointer to the first character after the field or NULL, if
+ *   invalid.
+ */
+static char const * read_board(char const * str, int8_t * const out_board)
+{
+    for(int row = 0; row < s_row_len; ++row)
+    {
+        if(row != 0)
+        {
+            if(*str != '/')
+            {
+                return NULL;
+            }
+            ++str;
+        }
+
+        int col = 0;
+
+        while(col < s_row_len)
+        {
+            char const c = *str++;
+
+            if('1' <= c && c <= '8')
+            {
+                if(s_row_len < col + (c - '0'))
+                {
+                    return NULL;
+                }
+                for(int i = 0; i < c - '0'; ++i)
+                {
+                    out_board[row * s_row_len + col++] = 0;
+                }
+                continue;
+            }
+
+            enum mt_chess_color color;
+            int const type = get_type(c, &color);
+
+            if(type == -1)
+            {
+                return NULL;
+            }
+            out_board[row * s_row_len + col++] = (int8_t)(
+                color == mt_chess_color_black ? -(type + 1) : type + 1);
+        }
+    }
+    return str;
+}
+
+/**
+ * - Reads a decimal number of at most given count of digits.
+ * - Returns a pointer to the first character after the number or NULL, if
+ *   there is no number or it is too long.
+ */
+static char const * read_number(
+    char const * str, int const max_digits, int * const out_number)
+{
+    int digits = 0;
+
+    *out_number = 0;
+    while('0' <= *str && *str <= '9')
+    {
+        if(digits == max_digits)
+        {
+            return NULL;
+        }
+        *out_number = 10 * *out_number + (*str - '0');
+        ++digits;
+        ++str;
+    }
+    return digits == 0 ? NULL : str;
+}
+
+/**
+ * - Returns, if a pawn of the player having the turn could catch "en
+ *   passant" at given square (in the row the opponent's pawn skipped).
+ */
+static bool is_en_passant_possible(
+    struct mt_chess_data const * const data, int const index)
+{
+    enum mt_chess_color const turn = (enum mt_chess_color)data->turn;
+    enum mt_chess_color const opp = turn == mt_chess_color_white
+        ? mt_chess_color_black : mt_chess_color_white;
+    int const row = index / s_row_len;
+    int const col = index % s_row_len;
+
+    // The row of the skipped square and where the pawn came from and went to:
+    //
+    int const skipped_row = turn == mt_chess_color_white
+        ? (int)mt_chess_row_6 : (int)mt_chess_row_3;
+    int const from_row = turn == mt_chess_color_white
+        ? (int)mt_chess_row_7 : (int)mt_chess_row_2;
+    int const to_row = turn == mt_chess_color_white
+        ? (int)mt_chess_row_5 : (int)mt_chess_row_4;
+    int const to_index = to_row * s_row_len + col;
+
+    if(row != skipped_row
+        || data->board[index] != 0
+        || data->board[from_row * s_row_len + col] != 0
+        || get_type_at(data, to_index, opp) != (int)mt_chess_type_pawn)
+    {
+        return false;
+    }
+    for(int add = -1; add <= 1; add += 2)
+    {
+        if(0 <= col + add && col + add < s_row_len
+            && get_type_at(data, to_index + add, turn)
+                == (int)mt_chess_type_pawn)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool mt_chess_fen_read(
+    char const * const str, struct mt_chess_data * const out_data)
+{
+    assert(str != NULL);
+    assert(out_data != NULL);
+
+    int8_t board[8 * 8];
+    char const * p = read_board(skip_space(str), board);
+
+    if(p == NULL || !is_space(*p) || !mt_chess_data_set_pieces(out_data, board))
+    {
+        return false;
+    }
+
+    // Turn:
+
+    p = skip_space(p);
+    if(*p == 'w')
+    {
+        out_data->turn = (uint8_t)mt_chess_color_white;
+    }
+    else if(*p == 'b')
+    {
+        out_data->turn = (uint8_t)mt_chess_color_black;
+    }
+    else
+    {
+        return false;
+    }
+    ++p;
+    if(!is_space(*p))
+    {
+        return false;
+    }
+
+    // Castling rights:
+
+    p = skip_space(p);
+    out_data->castling = 0;
+    if(*p == '-')
+    {
+        ++p;
+    }
+    else
+    {
+        char const * const begin = p;
+
+        for(int i = 0; i < 4; ++i)
+        {
+            if(*p != s_castlings[i].letter)
+            {
+                continue; // (in the order of s_castlings)
+            }
+            ++p;
+            if(get_type_at(
+                    out_data,
+                    s_castlings[i].king_index,
+                    (enum mt_chess_color)s_castlings[i].color)
+                    == (int)mt_chess_type_king
+                && get_type_at(
+                    out_data,
+                    s_castlings[i].rook_index,
+                    (enum mt_chess_color)s_castlings[i].color)
+                    == (int)mt_chess_type_rook)
+            {
+                out_data->castling |= s_castlings[i].right;
+            }
+        }
+        if(p == begin)
+        {
+            return false;
+        }
+    }
+    if(!is_space(*p))
+    {
+        return false;
+    }
+
+    // "En passant" square:
+
+    p = skip_space(p);
+    out_data->en_passant = MT_CHESS_DATA_NO_EN_PASSANT;
+    if(*p == '-')
+    {
+        ++p;
+    }
+    else
+    {
+        if(p[0] < 'a' || 'h' < p[0] || p[1] < '1' || '8' < p[1])
+        {
+            return false;
+        }
+
+        int const index = ('8' - p[1]) * s_row_len + (p[0] - 'a');
+
+        if(is_en_passant_possible(out_data, index))
+        {
+            out_data->en_passant = (uint8_t)index;
+        }
+        p += 2;
+    }
+
+    // Optional half-move clock and full-move number:
+
+    int halfmove_clock = 0;
+    int fullmove = 1;
+
+    if(is_space(*p))
+    {
+        p = skip_space(p);
+        if(*p != '\0')
+        {
+            p = read_number(p, 5, &halfmove_clock);
+            if(p == NULL || UINT16_MAX < halfmove_clock || !is_space(*p))
+            {
+                return false;
+            }
+            p = read_number(skip_space(p), 5, &fullmove);
+            if(p == NULL || fullmove < 1)
+            {
+                return false;
+            }
+        }
+    }
+    if(*skip_space(p) != '\0')
+    {
+        return false;
+    }
+
+    int const ply = 2 * (fullmove - 1) + (int)out_data->turn;
+
+    if(UINT16_MAX < ply)
+    {
+        return false;
+    }
+    out_data->halfmove_clock = (uint16_t)halfmove_clock;
+    out_data->ply = (uint16_t)ply;
+
+    // The player not having the turn must not be in check:
+
+    out_data->turn ^= 1;
+    mt_chess_data_update_check(out_data);
+    if(out_data->check.checkers != 0)
+    {
+        return false;
+    }
+    out_data->turn ^= 1;
+
+    out_data->hash = mt_chess_zobrist_get(out_data);
+    out_data->pawn_hash = mt_chess_zobrist_get_pawns(out_data);
+    mt_chess_data_update_check(out_data);
+    return true;
+}
+
+void mt_chess_fen_get_str(
+    struct mt_chess_data const * const data, char * const out_str)
+{
+    assert(data != NULL);
+    assert(out_str != NULL);
+
+    char * p = out_str;
+
+    for(int row = 0; row < s_row_len; ++row)
+    {
+        int empty = 0;
+
+        if(row != 0)
+        {
+            *p++ = '/';
+        }
+        for(int col = 0; col < s_row_len; ++col)
+        {
+            uint8_t const id = data->board[row * s_row_len + col];
+
+            if(id == 0)
+            {
+                ++empty;
+                continue;
+            }
+            if(empty != 0)
+            {
+                *p++ = (char)('0' + empty);
+                empty = 0;
+            }
+
+            struct mt_chess_piece const * const piece =
+                data->pieces + mt_chess_piece_get_index(data->pieces, id);
+            char const letter = s_letters[piece->type];
+
+            *p++ = piece->color == (uint8_t)mt_chess_color_black
+                ? (char)(letter - 'A' + 'a') : letter;
+        }
+        if(empty != 0)
+        {
+            *p++ = (char)('0' + empty);
+        }
+    }
+
+    *p++ = ' ';
+    *p++ = data->turn == (uint8_t)mt_chess_color_white ? 'w' : 'b';
+
+    *p++ = ' ';
+    if(data->castling == 0)
+    {
+        *p++ = '-';
+    }
+    for(int i = 0; i < 4; ++i)
+    {
+        if((data->castling & s_castlings[i].right) != 0)
+        {
+            *p++ = s_castlings[i].letter;
+        }
+    }
+
+    *p++ = ' ';
+    if(data->en_passant == MT_CHESS_DATA_NO_EN_PASSANT)
+    {
+        *p++ = '-';
+    }
+    else
+    {
+        *p++ = (char)('a' + data->en_passant % s_row_len);
+        *p++ = (char)('8' - data->en_passant / s_row_len);
+    }
+
+    int const numbers[2] = { data->halfmove_clock, data->ply / 2 + 1 };
+
+    for(int i = 0; i < 2; ++i)
+    {
+        char digits[5];
+        int count = 0;
+        int n = numbers[i];
+
+        do
+        {
+            digits[count++] = (char)('0' + n % 10);
+            n /= 10;
+        }while(n != 0);
+
+        *p++ = ' ';
+        while(0 < count)
+        {
+            *p++ = digits[--count];
+        }
+    }
+    *p = '\0';
+
+    assert(p < out_str + MT_CHESS_FEN_STR_SIZE);
+}
@@ -0,0 +1,56 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_FEN
+#define MT_CHESS_FEN
+
+#ifdef __cplusplus
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_data.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Forsyth-Edwards Notation (FEN) of a position, e.g. the start position:
+//
+// "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"
+//
+// Neither function allocates memory.
+
+// Size of the longest FEN written, plus terminator.
+//
+#define MT_CHESS_FEN_STR_SIZE 96
+
+/**
+ * - Writes the FEN of given position to given buffer, which must hold
+ *   MT_CHESS_FEN_STR_SIZE characters.
+ * - The full-move number is derived from the position's ply.
+ */
+void mt_chess_fen_get_str(
+    struct mt_chess_data const * const data, char * const out_str);
+
+/**
+ * - Sets given position to the one given as FEN by given string (leading and
+ *   trailing white-space is ignored, the half-move clock and full-move number
+ *   may be missing).
+ * - Drops castling rights without the king and rook on their start squares
+ *   and an "en passant" square without a pawn able to catch "en passant"
+ *   (like mt_chess_data_apply_move() does).
+ * - Returns false, if the string is invalid or the position is not a
+ *   possible one for this library (e.g. not exactly one king per side, more
+ *   than 16 pieces of a side, more pieces than promotions could give, pawns
+ *   on the first or last row or the player not having the turn in check).
+ *   Given position is undefined, then.
+ */
+bool mt_chess_fen_read(
+    char const * const str, struct mt_chess_data * const out_data);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_FEN
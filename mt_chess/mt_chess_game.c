@@ -0,0 +1,319 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cstddef>
+    #include <cstdint>
+    #include <cassert>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stddef.h>
+    #include <stdint.h>
+    #include <assert.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_game.h"
+#include "mt_chess_data.h"
+#include "mt_chess_log_node.h"
+#include "mt_chess_log_pool.h"
+#include "mt_chess_mem.h"
+#include "mt_chess_movegen.h"
+#include "mt_chess_piece.h"
+#include "mt_chess_type.h"
+#include "mt_chess_col.h"
+#include "mt_chess_stats.h"
+
+void mt_chess_game_free(struct mt_chess_game * const game)
+{
+    if(game == NULL)
+    {
+        assert(false); // Although no problem (here).
+        return;
+    }
+
+    mt_chess_log_pool_free(&game->pool); // (invalidates all log nodes)
+    mt_chess_mem_free(game);
+}
+
+struct mt_chess_game * mt_chess_game_create(void)
+{
+    struct mt_chess_game * const ret_val =
+        (struct mt_chess_game *)mt_chess_mem_alloc(sizeof *ret_val);
+
+    mt_chess_log_pool_init(&ret_val->pool);
+    mt_chess_game_reset(ret_val);
+    return ret_val;
+}
+
+void mt_chess_game_reset(struct mt_chess_game * const game)
+{
+    assert(game != NULL);
+
+    mt_chess_data_init(&game->data);
+
+    mt_chess_log_pool_reset(&game->pool); // (invalidates all log nodes)
+    game->log = NULL;
+    game->latest = NULL;
+    game->current = NULL;
+    game->spare = NULL;
+    game->ply_count = 0;
+    game->ply = 0;
+}
+
+/**
+ * - Moves the logged moves after the current one to the spare nodes.
+ */
+static void drop_after_current(struct mt_chess_game * const game)
+{
+    struct mt_chess_log_node * const first_dropped =
+        game->current == NULL ? game->log : game->current->next;
+
+    if(first_dropped == NULL)
+    {
+        return; // Nothing to drop.
+    }
+
+    assert(game->latest != NULL);
+    assert(game->latest->next == NULL);
+
+    game->latest->next = game->spare;
+    game->spare = first_dropped;
+    first_dropped->last = NULL;
+
+    game->latest = game->current;
+    if(game->current == NULL)
+    {
+        game->log = NULL;
+    }
+    else
+    {
+        game->current->next = NULL;
+    }
+    game->ply_count = game->ply;
+}
+
+static struct mt_chess_log_node * get_node(struct mt_chess_game * const game)
+{
+    if(game->spare == NULL)
+    {
+        return mt_chess_log_pool_get(&game->pool);
+    }
+
+    struct mt_chess_log_node * const ret_val = game->spare;
+
+    game->spare = ret_val->next;
+
+    ret_val->last = NULL;
+    ret_val->move = 0; // Invalid move.
+    ret_val->next = NULL;
+
+    return ret_val;
+}
+
+void mt_chess_game_do_move(
+    struct mt_chess_game * const game, uint16_t const move)
+{
+    assert(game != NULL);
+
+    MT_CHESS_STATS_BEGIN(stats_begin);
+
+    drop_after_current(game);
+
+    struct mt_chess_log_node * const node = get_node(game);
+
+    mt_chess_data_apply_move(&game->data, move, &node->undo);
+
+    // Log:
+    //
+    node->move = move;
+
+    if(game->log == NULL)
+    {
+        assert(game->latest == NULL);
+
+        game->log = node; // First move to be logged.
+    }
+    else
+    {
+        assert(game->latest != NULL);
+        assert(game->latest->next == NULL);
+
+        game->latest->next = node;
+        node->last = game->latest;
+    }
+    game->latest = node;
+    game->current = node;
+    ++game->ply_count;
+    ++game->ply;
+
+    MT_CHESS_STATS_END(mt_chess_stats_id_log_do_move, stats_begin);
+}
+
+bool mt_chess_game_undo(struct mt_chess_game * const game)
+{
+    assert(game != NULL);
+
+    if(game->current == NULL)
+    {
+        return false; // At the start.
+    }
+
+    MT_CHESS_STATS_BEGIN(stats_begin);
+
+    mt_chess_data_undo_move(
+        &game->data, game->current->move, &game->current->undo);
+
+    game->current = game->current->last;
+    --game->ply;
+
+    MT_CHESS_STATS_END(mt_chess_stats_id_log_undo, stats_begin);
+    return true;
+}
+
+bool mt_chess_game_redo(struct mt_chess_game * const game)
+{
+    assert(game != NULL);
+
+    struct mt_chess_log_node * const next =
+        game->current == NULL ? game->log : game->current->next;
+
+    if(next == NULL)
+    {
+        return false; // At the latest logged move.
+    }
+
+    MT_CHESS_STATS_BEGIN(stats_begin);
+
+    mt_chess_data_apply_move(&game->data, next->move, &next->undo);
+
+    game->current = next;
+    ++game->ply;
+
+    MT_CHESS_STATS_END(mt_chess_stats_id_log_redo, stats_begin);
+    return true;
+}
+
+bool mt_chess_game_jump_to_ply(
+    struct mt_chess_game * const game, int const ply)
+{
+    assert(game != NULL);
+
+    if(ply < 0 || game->ply_count < ply)
+    {
+        return false;
+    }
+
+    MT_CHESS_STATS_BEGIN(stats_begin);
+
+    while(ply < game->ply)
+    {
+        mt_chess_game_undo(game);
+    }
+    while(game->ply < ply)
+    {
+        mt_chess_game_redo(game);
+    }
+
+    MT_CHESS_STATS_END(mt_chess_stats_id_log_jump, stats_begin);
+    return true;
+}
+
+int mt_chess_game_get_repetition_count(struct mt_chess_game const * const game)
+{
+    assert(game != NULL);
+
+    int ret_val = 0;
+    int plies = (int)game->data.halfmove_clock;
+    struct mt_chess_log_node const * node = game->current;
+
+    // Each log node holds the hash of the position before its move.
+
+    while(node != NULL && 0 < plies)
+    {
+        if(node->undo.hash == game->data.hash)
+        {
+            ++ret_val;
+        }
+        node = node->last;
+        --plies;
+    }
+    return ret_val;
+}
+
+static bool is_insufficient_material(struct mt_chess_data const * const data)
+{
+    int minors = 0;
+    int bishop_square_colors = 0; // Bit 0 for light, bit 1 for dark squares.
+    bool knight = false;
+
+    for(int index = 0; index < 8 * 8; ++index)
+    {
+        uint8_t const piece_id = data->board[index];
+
+        if(piece_id == 0)
+        {
+            continue;
+        }
+
+        struct mt_chess_piece const * const piece =
+            data->pieces + mt_chess_piece_get_index(data->pieces, piece_id);
+
+        switch(piece->type)
+        {
+            case mt_chess_type_king:
+            {
+                break;
+            }
+            case mt_chess_type_knight:
+            {
+                knight = true;
+                ++minors;
+                break;
+            }
+            case mt_chess_type_bishop:
+            {
+                int const row = index / ((int)mt_chess_col_h + 1);
+                int const col = index % ((int)mt_chess_col_h + 1);
+
+                // (a8 is a light square)
+                bishop_square_colors |= (row + col) % 2 == 0 ? 1 : 2;
+                ++minors;
+                break;
+            }
+
+            default:
+            {
+                return false; // Pawn, rook or queen.
+            }
+        }
+    }
+    return minors <= 1 || (!knight && bishop_square_colors != 3);
+}
+
+enum mt_chess_game_state mt_chess_game_get_state(
+    struct mt_chess_game const * const game)
+{
+    assert(game != NULL);
+
+    struct mt_chess_move_list list;
+
+    mt_chess_movegen_get_legal(&game->data, &list);
+    if(list.count == 0)
+    {
+        return game->data.check.checkers != 0
+            ? mt_chess_game_state_checkmate : mt_chess_game_state_stalemate;
+    }
+    if(2 * 50 <= game->data.halfmove_clock)
+    {
+        return mt_chess_game_state_fifty_moves;
+    }
+    if(2 <= mt_chess_game_get_repetition_count(game))
+    {
+        return mt_chess_game_state_repetition;
+    }
+    if(is_insufficient_material(&game->data))
+    {
+        return mt_chess_game_state_insufficient_material;
+    }
+    return mt_chess_game_state_ongoing;
+}
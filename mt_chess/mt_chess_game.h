@@ -0,0 +1,125 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_GAME
+#define MT_CHESS_GAME
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_data.h"
+#include "mt_chess_log_node.h"
+#include "mt_chess_log_pool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+enum mt_chess_game_state
+{
+    mt_chess_game_state_ongoing = 0,
+    mt_chess_game_state_checkmate = 1, // Player having the turn lost.
+    mt_chess_game_state_stalemate = 2,
+    mt_chess_game_state_fifty_moves = 3, // (50 moves without catch or pawn)
+    mt_chess_game_state_repetition = 4, // (same position for the third time)
+    mt_chess_game_state_insufficient_material = 5
+};
+
+/**
+ * - A game: The current position plus the log of the moves leading to it.
+ */
+struct mt_chess_game
+{
+    struct mt_chess_data data;
+
+    struct mt_chess_log_node * log; // First logged move or NULL.
+    struct mt_chess_log_node * latest; // Last logged move or NULL.
+
+    // Last logged move applied to the position or NULL (at the start). Differs
+    // from latest, after taking back moves.
+    struct mt_chess_log_node * current;
+
+    // Nodes of moves taken back and then replaced by another move. They are
+    // reused before taking new nodes from the pool.
+    struct mt_chess_log_node * spare;
+
+    struct mt_chess_log_pool pool; // Owns the log nodes.
+
+    int ply_count; // Count of logged moves.
+    int ply; // Count of logged moves applied to the position.
+};
+
+/**
+ * - Will take ownership of given object (pointer will be invalid after call).
+ */
+void mt_chess_game_free(struct mt_chess_game * const game);
+
+/**
+ * - Free via mt_chess_game_free() after usage.
+ */
+struct mt_chess_game * mt_chess_game_create(void);
+
+/**
+ * - Starts a new game, reusing the memory of the log (O(1), no allocations
+ *   or frees).
+ */
+void mt_chess_game_reset(struct mt_chess_game * const game);
+
+/**
+ * - Applies given legal packed move (see mt_chess_move.h) to the position and
+ *   logs it.
+ * - Drops the logged moves after the current one, if moves were taken back.
+ * - O(1), allocates for every MT_CHESS_LOG_POOL_CHUNK_LEN-th logged move
+ *   only, if there is no chunk to be reused.
+ */
+void mt_chess_game_do_move(
+    struct mt_chess_game * const game, uint16_t const move);
+
+/**
+ * - Takes back the current move, keeping it in the log (see
+ *   mt_chess_game_redo()).
+ * - Returns false, if at the start of the game (nothing to take back).
+ * - O(1).
+ */
+bool mt_chess_game_undo(struct mt_chess_game * const game);
+
+/**
+ * - Applies the next logged move that was taken back.
+ * - Returns false, if at the latest logged move (nothing to redo).
+ * - O(1).
+ */
+bool mt_chess_game_redo(struct mt_chess_game * const game);
+
+/**
+ * - Goes to the position after given count of logged moves (0 is the start
+ *   position) by taking back or re-applying moves.
+ * - Returns false and does nothing, if given ply is not in the log.
+ * - O(1) per move taken back or re-applied.
+ */
+bool mt_chess_game_jump_to_ply(
+    struct mt_chess_game * const game, int const ply);
+
+/**
+ * - Returns how often the current position occurred before in the game (by
+ *   hash), looking back to the last catch or pawn move, only.
+ */
+int mt_chess_game_get_repetition_count(struct mt_chess_game const * const game);
+
+/**
+ * - Returns, if the game is over (and why) by the rules. Draws by 50-move rule
+ *   and threefold repetition are applied automatically (not on claim).
+ * - Insufficient material: King versus king, with at most one knight or
+ *   bishop or with bishops on squares of the same color only.
+ */
+enum mt_chess_game_state mt_chess_game_get_state(
+    struct mt_chess_game const * const game);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_GAME
@@ -0,0 +1,162 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstddef>
+    #include <cassert>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <assert.h>
+#endif //__cplusplus
+
+#include "mt_chess_hist.h"
+#include "mt_chess_bit.h"
+
+static int get_bucket(uint64_t const value)
+{
+    if(value < (uint64_t)MT_CHESS_HIST_SUB_COUNT)
+    {
+        return (int)value;
+    }
+
+    int const last = mt_chess_bit_get_last(value);
+
+    if(MT_CHESS_HIST_MAX_BITS <= last)
+    {
+        return MT_CHESS_HIST_BUCKETS - 1;
+    }
+
+    // The top MT_CHESS_HIST_SUB_BITS + 1 bits select the bucket:
+
+    int const shift = last - MT_CHESS_HIST_SUB_BITS;
+    int const sub = (int)(value >> shift) - MT_CHESS_HIST_SUB_COUNT;
+
+    return (shift + 1) * MT_CHESS_HIST_SUB_COUNT + sub;
+}
+
+/**
+ * - Returns the highest value counted in given bucket.
+ */
+static uint64_t get_bucket_max(int const bucket)
+{
+    assert(0 <= bucket && bucket < MT_CHESS_HIST_BUCKETS);
+
+    if(bucket < MT_CHESS_HIST_SUB_COUNT)
+    {
+        return (uint64_t)bucket;
+    }
+
+    int const shift = bucket / MT_CHESS_HIST_SUB_COUNT - 1;
+    uint64_t const sub = (uint64_t)(
+        MT_CHESS_HIST_SUB_COUNT + bucket % MT_CHESS_HIST_SUB_COUNT);
+
+    return ((sub + 1) << shift) - 1;
+}
+
+void mt_chess_hist_reset(struct mt_chess_hist * const hist)
+{
+    assert(hist != NULL);
+
+    hist->count = 0;
+    hist->min = 0;
+    hist->max = 0;
+    hist->sum = 0;
+    for(int i = 0; i < MT_CHESS_HIST_BUCKETS; ++i)
+    {
+        hist->buckets[i] = 0;
+    }
+}
+
+void mt_chess_hist_record(
+    struct mt_chess_hist * const hist, uint64_t const value)
+{
+    assert(hist != NULL);
+
+    if(hist->count == 0 || value < hist->min)
+    {
+        hist->min = value;
+    }
+    if(hist->max < value)
+    {
+        hist->max = value;
+    }
+    ++hist->count;
+    hist->sum += value;
+    ++hist->buckets[get_bucket(value)];
+}
+
+void mt_chess_hist_merge(
+    struct mt_chess_hist * const dest, struct mt_chess_hist const * const src)
+{
+    assert(dest != NULL);
+    assert(src != NULL);
+
+    if(src->count == 0)
+    {
+        return;
+    }
+    if(dest->count == 0 || src->min < dest->min)
+    {
+        dest->min = src->min;
+    }
+    if(dest->max < src->max)
+    {
+        dest->max = src->max;
+    }
+    dest->count += src->count;
+    dest->sum += src->sum;
+    for(int i = 0; i < MT_CHESS_HIST_BUCKETS; ++i)
+    {
+        dest->buckets[i] += src->buckets[i];
+    }
+}
+
+uint64_t mt_chess_hist_get_percentile(
+    struct mt_chess_hist const * const hist, double const percentile)
+{
+    assert(hist != NULL);
+    assert(0.0 <= percentile && percentile <= 100.0);
+
+    if(hist->count == 0)
+    {
+        return 0;
+    }
+
+    // Nearest rank: Count of values at or below the percentile, rounded up
+    // (e.g. 999 of 999 values for 99.9 %) and at least one. The tolerance
+    // keeps floating-point error from rounding up exact ranks (e.g. 99.9 % of
+    // 1000 values):
+    double const exact = percentile / 100.0 * (double)hist->count;
+    uint64_t rank = (uint64_t)exact;
+    uint64_t seen = 0;
+
+    if((double)rank < exact - exact * 1e-12)
+    {
+        ++rank;
+    }
+    if(rank == 0)
+    {
+        rank = 1;
+    }
+    if(hist->count < rank)
+    {
+        rank = hist->count;
+    }
+    for(int i = 0; i < MT_CHESS_HIST_BUCKETS; ++i)
+    {
+        seen += hist->buckets[i];
+        if(rank <= seen)
+        {
+            if(i == MT_CHESS_HIST_BUCKETS - 1)
+            {
+                return hist->max; // (last bucket is open-ended)
+            }
+
+            uint64_t const ret_val = get_bucket_max(i);
+
+            return ret_val < hist->max ? ret_val : hist->max;
+        }
+    }
+    return hist->max; // (rounding)
+}
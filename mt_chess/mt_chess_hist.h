@@ -0,0 +1,70 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_HIST
+#define MT_CHESS_HIST
+
+#ifdef __cplusplus
+    #include <cstdint>
+#else //__cplusplus
+    #include <stdint.h>
+#endif //__cplusplus
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Log-bucketed histogram (HDR-style) of non-negative integer values, e.g.
+// latencies in nanoseconds:
+//
+// - Values below 2 * MT_CHESS_HIST_SUB_COUNT get exact buckets.
+// - Above, each power of two is split into MT_CHESS_HIST_SUB_COUNT buckets,
+//   so the relative error of a percentile is at most 1 / 32 (about 3 %).
+// - Values of 2^MT_CHESS_HIST_MAX_BITS (about 18 minutes in nanoseconds) and
+//   above are counted in the last bucket (but min., max. and sum are exact).
+// - Fixed size, recording does no allocation and no locking. Histograms of
+//   different threads can be merged via mt_chess_hist_merge().
+
+#define MT_CHESS_HIST_SUB_BITS 5
+#define MT_CHESS_HIST_SUB_COUNT (1 << MT_CHESS_HIST_SUB_BITS)
+#define MT_CHESS_HIST_MAX_BITS 40
+#define MT_CHESS_HIST_BUCKETS \
+    ((MT_CHESS_HIST_MAX_BITS - MT_CHESS_HIST_SUB_BITS + 1) \
+        * MT_CHESS_HIST_SUB_COUNT)
+
+/**
+ * - All zero is an empty histogram.
+ */
+struct mt_chess_hist
+{
+    uint64_t count;
+    uint64_t min; // Just valid, if count is not zero.
+    uint64_t max;
+    uint64_t sum;
+
+    uint64_t buckets[MT_CHESS_HIST_BUCKETS];
+};
+
+void mt_chess_hist_reset(struct mt_chess_hist * const hist);
+
+void mt_chess_hist_record(
+    struct mt_chess_hist * const hist, uint64_t const value);
+
+/**
+ * - Adds the values of given source histogram to given destination histogram.
+ */
+void mt_chess_hist_merge(
+    struct mt_chess_hist * const dest, struct mt_chess_hist const * const src);
+
+/**
+ * - Returns the value at given percentile (0.0 to 100.0, e.g. 99.9), which
+ *   is the highest value of the bucket holding it, but not above the max.
+ * - Returns 0, if the histogram is empty.
+ */
+uint64_t mt_chess_hist_get_percentile(
+    struct mt_chess_hist const * const hist, double const percentile);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_HIST
@@ -0,0 +1,885 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdbool>
+    #include <cstdlib>
+    #include <cstdio>
+    #include <cstring>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+    #include <stdlib.h>
+    #include <stdio.h>
+    #include <string.h>
+#endif //__cplusplus
+
+#include "mt_chess_index.h"
+#include "mt_chess_record.h"
+#include "mt_chess_data.h"
+#include "mt_chess_movegen.h"
+#include "mt_chess_map.h"
+#include "mt_chess_thread.h"
+#include "mt_chess_le.h"
+#include "mt_chess_mem.h"
+
+#define MT_INDEX_BLOCK_ENTRIES 256
+
+// A variable-length integer takes up to 10 bytes (hash), an entry up to
+// 10 + 5 + 3 bytes:
+//
+#define MT_INDEX_BLOCK_MAX_SIZE (MT_INDEX_BLOCK_ENTRIES * 18)
+
+static uint8_t const s_magic[4] = { 'M', 'T', 'C', 'I' };
+
+static int const s_directory_entry_size = 8 + 8;
+
+// Maximum count of entries sorted in memory at once (16 bytes each):
+//
+static size_t const s_run_entries = (size_t)1 << 24;
+
+// Count of entries buffered per temporary file, while merging:
+//
+static size_t const s_read_entries = (size_t)1 << 14;
+
+struct entry
+{
+    uint64_t hash;
+    uint32_t game;
+    uint16_t ply;
+};
+
+// Replays a range of games of a run and sorts their entries.
+//
+struct replay_task
+{
+    struct mt_chess_thread thread;
+
+    uint8_t const * records;
+    size_t const * offsets; // Of the records, indexed by game.
+    uint32_t first_game;
+    uint32_t end_game;
+
+    struct entry * entries; // Holds one entry per position of the games.
+    size_t count;
+
+    bool ok; // False, if a record holds an invalid move.
+};
+
+// Sorted entries to be merged, in memory or in a temporary file.
+//
+struct source
+{
+    struct entry * buf;
+    size_t pos;
+    size_t count;
+    FILE * file; // NULL, if all entries are in the buffer.
+};
+
+// Writes the index file.
+//
+struct writer
+{
+    FILE * file;
+    uint64_t offset; // Of the next byte to write.
+
+    uint8_t * directory;
+    uint32_t block_count; // Count of blocks written or started.
+
+    uint8_t block[MT_INDEX_BLOCK_MAX_SIZE];
+    size_t block_size;
+    int block_entries;
+    uint64_t last_hash;
+    uint32_t last_game;
+
+    bool ok;
+};
+
+static int compare(void const * const a, void const * const b)
+{
+    struct entry const * const x = (struct entry const *)a;
+    struct entry const * const y = (struct entry const *)b;
+
+    if(x->hash != y->hash)
+    {
+        return x->hash < y->hash ? -1 : 1;
+    }
+    if(x->game != y->game)
+    {
+        return x->game < y->game ? -1 : 1;
+    }
+    return (int)x->ply - (int)y->ply;
+}
+
+static bool is_less(struct entry const * const a, struct entry const * const b)
+{
+    return compare(a, b) < 0;
+}
+
+static size_t get_entry_count(uint8_t const * const record)
+{
+    return 1 + (size_t)mt_chess_le_read_u16(record + 4); // (+ start position)
+}
+
+static void replay(void * const arg)
+{
+    struct replay_task * const task = (struct replay_task *)arg;
+    struct entry * e = task->entries;
+    struct mt_chess_data data;
+    struct mt_chess_move_list list;
+
+    task->ok = true;
+    for(uint32_t game = task->first_game; game < task->end_game; ++game)
+    {
+        uint8_t const * const record = task->records + task->offsets[game];
+        int const ply_count = (int)mt_chess_le_read_u16(record + 4);
+        uint8_t const * const moves = record + MT_CHESS_RECORD_HEADER_SIZE;
+
+        mt_chess_data_init(&data);
+        for(int ply = 0;; ++ply)
+        {
+            e->hash = data.hash;
+            e->game = game;
+            e->ply = (uint16_t)ply;
+            ++e;
+
+            if(ply == ply_count)
+            {
+                break;
+            }
+
+            mt_chess_movegen_get_legal(&data, &list);
+            if(list.count <= (int)moves[ply])
+            {
+                task->ok = false;
+                return;
+            }
+            mt_chess_data_apply_move(&data, list.moves[moves[ply]], NULL);
+        }
+    }
+    assert(e == task->entries + task->count);
+
+    qsort(task->entries, task->count, sizeof *task->entries, compare);
+}
+
+/**
+ * - Returns the next entry of given source or NULL, if there is none.
+ */
+static struct entry const * get_next(struct source * const source)
+{
+    if(source->pos == source->count)
+    {
+        if(source->file == NULL)
+        {
+            return NULL;
+        }
+        source->count = fread(
+            source->buf, sizeof *source->buf, s_read_entries, source->file);
+        source->pos = 0;
+        if(source->count == 0)
+        {
+            return NULL;
+        }
+    }
+    return source->buf + source->pos++;
+}
+
+static void put_varint(struct writer * const writer, uint64_t value)
+{
+    while(0x7F < value)
+    {
+        writer->block[writer->block_size++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    writer->block[writer->block_size++] = (uint8_t)value;
+}
+
+static void write_bytes(
+    struct writer * const writer, uint8_t const * const buf, size_t const size)
+{
+    writer->ok = writer->ok && fwrite(buf, 1, size, writer->file) == size;
+    writer->offset += size;
+}
+
+static void flush_block(struct writer * const writer)
+{
+    write_bytes(writer, writer->block, writer->block_size);
+    writer->block_size = 0;
+    writer->block_entries = 0;
+}
+
+static void write_entry(
+    struct writer * const writer, struct entry const * const e)
+{
+    if(writer->block_entries == 0)
+    {
+        uint8_t * const dir = writer->directory
+            + (size_t)writer->block_count * (size_t)s_directory_entry_size;
+
+        mt_chess_le_write_u64(dir, e->hash);
+        mt_chess_le_write_u64(dir + 8, writer->offset);
+        ++writer->block_count;
+
+        writer->last_hash = e->hash;
+        writer->last_game = 0;
+    }
+    if(e->hash != writer->last_hash)
+    {
+        writer->last_game = 0;
+    }
+
+    put_varint(writer, e->hash - writer->last_hash);
+    put_varint(writer, (uint64_t)(e->game - writer->last_game));
+    put_varint(writer, e->ply);
+
+    writer->last_hash = e->hash;
+    writer->last_game = e->game;
+
+    ++writer->block_entries;
+    if(writer->block_entries == MT_INDEX_BLOCK_ENTRIES)
+    {
+        flush_block(writer);
+    }
+}
+
+/**
+ * - Merges given sorted sources into given index writer (if not NULL) or
+ *   temporary file (raw entries), otherwise.
+ * - Uses a binary min-heap of the sources' next entries.
+ * - Returns false on error.
+ */
+static bool merge(
+    struct source * const sources,
+    int const source_count,
+    struct writer * const writer,
+    FILE * const run_file)
+{
+    struct entry const * * const next = (struct entry const * *)
+        mt_chess_mem_alloc((size_t)source_count * sizeof *next);
+    int * const heap = (int *)mt_chess_mem_alloc(
+        (size_t)source_count * sizeof *heap);
+    int heap_size = 0;
+    bool ret_val = true;
+
+    for(int i = 0; i < source_count; ++i)
+    {
+        next[i] = get_next(sources + i);
+        if(next[i] == NULL)
+        {
+            continue;
+        }
+
+        int pos = heap_size++;
+
+        while(0 < pos && is_less(next[i], next[heap[(pos - 1) / 2]]))
+        {
+            heap[pos] = heap[(pos - 1) / 2];
+            pos = (pos - 1) / 2;
+        }
+        heap[pos] = i;
+    }
+
+    while(0 < heap_size && ret_val)
+    {
+        int const top = heap[0];
+
+        if(writer != NULL)
+        {
+            write_entry(writer, next[top]);
+        }
+        else
+        {
+            ret_val = fwrite(next[top], sizeof **next, 1, run_file) == 1;
+        }
+
+        next[top] = get_next(sources + top);
+        if(next[top] == NULL)
+        {
+            heap[0] = heap[--heap_size];
+        }
+
+        // Sift down:
+        //
+        int pos = 0;
+
+        while(true)
+        {
+            int const left = 2 * pos + 1;
+            int smallest = pos;
+
+            if(heap_size <= left)
+            {
+                break;
+            }
+            if(is_less(next[heap[left]], next[heap[smallest]]))
+            {
+                smallest = left;
+            }
+            if(left + 1 < heap_size
+                && is_less(next[heap[left + 1]], next[heap[smallest]]))
+            {
+                smallest = left + 1;
+            }
+            if(smallest == pos)
+            {
+                break;
+            }
+
+            int const swap = heap[pos];
+
+            heap[pos] = heap[smallest];
+            heap[smallest] = swap;
+            pos = smallest;
+        }
+    }
+
+    mt_chess_mem_free(heap);
+    mt_chess_mem_free(next);
+    return ret_val && (writer == NULL || writer->ok);
+}
+
+/**
+ * - Replays and sorts the games from given first to (excluding) given end
+ *   game with given count of entries in parallel and merges the results into
+ *   given index writer or temporary file.
+ */
+static bool build_run(
+    uint8_t const * const records,
+    size_t const * const offsets,
+    uint32_t const first_game,
+    uint32_t const end_game,
+    size_t const entry_count,
+    int const thread_count,
+    struct entry * const entries,
+    struct writer * const writer,
+    FILE * const run_file)
+{
+    struct replay_task * const tasks = (struct replay_task *)
+        mt_chess_mem_alloc((size_t)thread_count * sizeof *tasks);
+    struct source * const sources = (struct source *)
+        mt_chess_mem_alloc((size_t)thread_count * sizeof *sources);
+    uint32_t game = first_game;
+    size_t entry_offset = 0;
+    bool ret_val = true;
+
+    // Split by count of entries (not games), for equal work per thread:
+    //
+    for(int i = 0; i < thread_count; ++i)
+    {
+        struct replay_task * const task = tasks + i;
+        size_t const end_offset =
+            entry_count * (size_t)(i + 1) / (size_t)thread_count;
+
+        task->records = records;
+        task->offsets = offsets;
+        task->first_game = game;
+        task->entries = entries + entry_offset;
+        while(game < end_game && entry_offset < end_offset)
+        {
+            entry_offset += get_entry_count(records + offsets[game]);
+            ++game;
+        }
+        task->end_game = game;
+        task->count = (size_t)(entries + entry_offset - task->entries);
+    }
+    assert(game == end_game && entry_offset == entry_count);
+
+    for(int i = 1; i < thread_count; ++i)
+    {
+        if(!mt_chess_thread_start(&tasks[i].thread, replay, tasks + i))
+        {
+            replay(tasks + i); // (continues single-threaded)
+            tasks[i].thread.func = NULL;
+        }
+    }
+    replay(tasks);
+    for(int i = 1; i < thread_count; ++i)
+    {
+        if(tasks[i].thread.func != NULL)
+        {
+            mt_chess_thread_join(&tasks[i].thread);
+        }
+    }
+
+    for(int i = 0; i < thread_count; ++i)
+    {
+        ret_val = ret_val && tasks[i].ok;
+
+        sources[i].buf = tasks[i].entries;
+        sources[i].pos = 0;
+        sources[i].count = tasks[i].count;
+        sources[i].file = NULL;
+    }
+    ret_val = ret_val && merge(sources, thread_count, writer, run_file);
+
+    mt_chess_mem_free(sources);
+    mt_chess_mem_free(tasks);
+    return ret_val;
+}
+
+/**
+ * - Returns the offsets of all records in given buffer (to be freed by the
+ *   caller) or NULL, if the buffer does not hold valid records only.
+ */
+static size_t * create_offsets(
+    uint8_t const * const records,
+    size_t const size,
+    uint32_t * const out_game_count,
+    uint64_t * const out_entry_count)
+{
+    uint64_t game_count = 0;
+    size_t pos = 0;
+
+    while(pos < size)
+    {
+        if(size - pos < MT_CHESS_RECORD_HEADER_SIZE
+            || records[pos] != MT_CHESS_RECORD_VERSION)
+        {
+            return NULL;
+        }
+        pos += get_entry_count(records + pos)
+            - 1 + MT_CHESS_RECORD_HEADER_SIZE;
+        if(size < pos)
+        {
+            return NULL; // Truncated.
+        }
+        ++game_count;
+    }
+    if(UINT32_MAX < game_count)
+    {
+        return NULL;
+    }
+
+    size_t * const ret_val = (size_t *)mt_chess_mem_alloc(
+        (size_t)(game_count + 1) * sizeof *ret_val);
+
+    *out_entry_count = 0;
+    pos = 0;
+    for(uint64_t game = 0; game < game_count; ++game)
+    {
+        ret_val[game] = pos;
+        *out_entry_count += get_entry_count(records + pos);
+        pos += get_entry_count(records + pos)
+            - 1 + MT_CHESS_RECORD_HEADER_SIZE;
+    }
+    *out_game_count = (uint32_t)game_count;
+    return ret_val;
+}
+
+static void get_run_path(
+    char const * const index_path,
+    int const run,
+    char * const out_path,
+    size_t const size)
+{
+    int const len = snprintf(out_path, size, "%s.%d.tmp", index_path, run);
+
+    assert(0 < len && (size_t)len < size);
+    (void)len;
+}
+
+static bool build(
+    uint8_t const * const records,
+    size_t const * const offsets,
+    uint32_t const game_count,
+    uint64_t const entry_count,
+    int const thread_count,
+    char const * const index_path,
+    struct writer * const writer)
+{
+    struct entry * const entries = (struct entry *)mt_chess_mem_alloc(
+        (entry_count < s_run_entries ? (size_t)entry_count : s_run_entries)
+            * sizeof *entries + 1);
+
+    if(entry_count <= s_run_entries)
+    {
+        // Fits into memory, no temporary files needed.
+
+        bool const ret_val = build_run(
+            records,
+            offsets,
+            0,
+            game_count,
+            (size_t)entry_count,
+            thread_count,
+            entries,
+            writer,
+            NULL);
+
+        mt_chess_mem_free(entries);
+        return ret_val;
+    }
+
+    // Sort runs fitting into memory to temporary files, then merge these:
+
+    size_t const path_size = strlen(index_path) + 32;
+    char * const path = (char *)mt_chess_mem_alloc(path_size);
+    int run_count = 0;
+    uint32_t game = 0;
+    bool ret_val = true;
+
+    while(game < game_count && ret_val)
+    {
+        uint32_t const first_game = game;
+        size_t count = 0;
+
+        while(game < game_count
+            && count + get_entry_count(records + offsets[game])
+                <= s_run_entries)
+        {
+            count += get_entry_count(records + offsets[game]);
+            ++game;
+        }
+
+        get_run_path(index_path, run_count, path, path_size);
+
+        FILE * const file = fopen(path, "wb");
+
+        if(file == NULL)
+        {
+            ret_val = false;
+            break;
+        }
+        ++run_count;
+        ret_val = build_run(
+            records,
+            offsets,
+            first_game,
+            game,
+            count,
+            thread_count,
+            entries,
+            NULL,
+            file);
+        ret_val = fclose(file) == 0 && ret_val;
+    }
+    mt_chess_mem_free(entries);
+
+    struct source * const sources = (struct source *)mt_chess_mem_alloc(
+        (size_t)run_count * sizeof *sources + 1);
+
+    for(int i = 0; i < run_count; ++i)
+    {
+        get_run_path(index_path, i, path, path_size);
+        sources[i].buf = (struct entry *)mt_chess_mem_alloc(
+            s_read_entries * sizeof *sources[i].buf);
+        sources[i].pos = 0;
+        sources[i].count = 0;
+        sources[i].file = ret_val ? fopen(path, "rb") : NULL;
+        ret_val = ret_val && sources[i].file != NULL;
+    }
+
+    ret_val = ret_val && merge(sources, run_count, writer, NULL);
+
+    for(int i = 0; i < run_count; ++i)
+    {
+        if(sources[i].file != NULL)
+        {
+            fclose(sources[i].file);
+        }
+        mt_chess_mem_free(sources[i].buf);
+
+        get_run_path(index_path, i, path, path_size);
+        remove(path);
+    }
+    mt_chess_mem_free(sources);
+    mt_chess_mem_free(path);
+    return ret_val;
+}
+
+static void write_header(
+    struct writer * const writer,
+    uint32_t const game_count,
+    uint64_t const entry_count,
+    uint64_t const directory)
+{
+    uint8_t header[MT_CHESS_INDEX_HEADER_SIZE] = { 0 };
+
+    memcpy(header, s_magic, sizeof s_magic);
+    mt_chess_le_write_u16(header + 4, MT_CHESS_INDEX_VERSION);
+    mt_chess_le_write_u32(header + 8, MT_INDEX_BLOCK_ENTRIES);
+    mt_chess_le_write_u32(header + 12, writer->block_count);
+    mt_chess_le_write_u32(header + 16, game_count);
+    mt_chess_le_write_u64(header + 24, entry_count);
+    mt_chess_le_write_u64(header + 32, directory);
+    write_bytes(writer, header, sizeof header);
+}
+
+bool mt_chess_index_build(
+    char const * const record_path,
+    char const * const index_path,
+    int const thread_count)
+{
+    assert(record_path != NULL);
+    assert(index_path != NULL);
+    assert(0 <= thread_count);
+
+    struct mt_chess_map map;
+    uint32_t game_count = 0;
+    uint64_t entry_count = 0;
+
+    if(!mt_chess_map_open(&map, record_path))
+    {
+        return false;
+    }
+
+    size_t * const offsets =
+        create_offsets(map.buf, map.size, &game_count, &entry_count);
+
+    if(offsets == NULL)
+    {
+        mt_chess_map_close(&map);
+        return false;
+    }
+
+    uint64_t const block_count =
+        (entry_count + MT_INDEX_BLOCK_ENTRIES - 1) / MT_INDEX_BLOCK_ENTRIES;
+
+    if(UINT32_MAX < block_count)
+    {
+        mt_chess_mem_free(offsets);
+        mt_chess_map_close(&map);
+        return false;
+    }
+
+    struct writer * const writer =
+        (struct writer *)mt_chess_mem_alloc(sizeof *writer);
+
+    writer->file = fopen(index_path, "wb");
+    writer->offset = 0;
+    writer->directory = (uint8_t *)mt_chess_mem_alloc(
+        (size_t)block_count * (size_t)s_directory_entry_size + 1);
+    writer->block_count = 0;
+    writer->block_size = 0;
+    writer->block_entries = 0;
+    writer->ok = writer->file != NULL;
+
+    if(writer->ok)
+    {
+        write_header(writer, 0, 0, 0); // (placeholder)
+        writer->ok = build(
+            map.buf,
+            offsets,
+            game_count,
+            entry_count,
+            thread_count == 0 ? mt_chess_thread_get_cpu_count() : thread_count,
+            index_path,
+            writer);
+    }
+    if(writer->ok)
+    {
+        if(0 < writer->block_entries)
+        {
+            flush_block(writer);
+        }
+        assert(writer->block_count == block_count);
+
+        uint64_t const directory = writer->offset;
+
+        write_bytes(
+            writer,
+            writer->directory,
+            (size_t)block_count * (size_t)s_directory_entry_size);
+
+        writer->ok = writer->ok && fseek(writer->file, 0, SEEK_SET) == 0;
+        write_header(writer, game_count, entry_count, directory);
+    }
+
+    bool ret_val = writer->ok;
+
+    if(writer->file != NULL)
+    {
+        ret_val = fclose(writer->file) == 0 && ret_val;
+    }
+    mt_chess_mem_free(writer->directory);
+    mt_chess_mem_free(writer);
+    mt_chess_mem_free(offsets);
+    mt_chess_map_close(&map);
+    return ret_val;
+}
+
+bool mt_chess_index_open(
+    struct mt_chess_index * const index, char const * const path)
+{
+    assert(index != NULL);
+    assert(path != NULL);
+
+    if(!mt_chess_map_open(&index->map, path))
+    {
+        return false;
+    }
+
+    uint8_t const * const buf = index->map.buf;
+
+    if(index->map.size < MT_CHESS_INDEX_HEADER_SIZE
+        || memcmp(buf, s_magic, sizeof s_magic) != 0
+        || mt_chess_le_read_u16(buf + 4) != MT_CHESS_INDEX_VERSION
+        || mt_chess_le_read_u32(buf + 8) != MT_INDEX_BLOCK_ENTRIES)
+    {
+        mt_chess_map_close(&index->map);
+        return false;
+    }
+
+    index->block_count = mt_chess_le_read_u32(buf + 12);
+    index->game_count = mt_chess_le_read_u32(buf + 16);
+    index->entry_count = mt_chess_le_read_u64(buf + 24);
+    index->directory = mt_chess_le_read_u64(buf + 32);
+
+    if(index->directory < MT_CHESS_INDEX_HEADER_SIZE
+        || index->map.size < index->directory
+        || (index->map.size - index->directory) / s_directory_entry_size
+            < index->block_count
+        || (uint64_t)index->block_count * MT_INDEX_BLOCK_ENTRIES
+            < index->entry_count)
+    {
+        mt_chess_map_close(&index->map);
+        return false;
+    }
+    return true;
+}
+
+void mt_chess_index_close(struct mt_chess_index * const index)
+{
+    assert(index != NULL);
+
+    mt_chess_map_close(&index->map);
+}
+
+static uint64_t get_first_hash(
+    struct mt_chess_index const * const index, uint32_t const block)
+{
+    return mt_chess_le_read_u64(
+        index->map.buf
+            + index->directory
+            + (size_t)block * (size_t)s_directory_entry_size);
+}
+
+static uint64_t get_offset(
+    struct mt_chess_index const * const index, uint32_t const block)
+{
+    if(block == index->block_count)
+    {
+        return index->directory; // (end of the last block)
+    }
+    return mt_chess_le_read_u64(
+        index->map.buf
+            + index->directory
+            + (size_t)block * (size_t)s_directory_entry_size
+            + 8);
+}
+
+/**
+ * - Returns false, if given buffer ends before the integer does.
+ */
+static bool get_varint(
+    uint8_t const * * const pos,
+    uint8_t const * const end,
+    uint64_t * const out_value)
+{
+    *out_value = 0;
+    for(int shift = 0; shift < 64; shift += 7)
+    {
+        if(*pos == end)
+        {
+            return false;
+        }
+
+        uint8_t const byte = *(*pos)++;
+
+        *out_value |= (uint64_t)(byte & 0x7F) << shift;
+        if((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t mt_chess_index_find(
+    struct mt_chess_index const * const index,
+    uint64_t const hash,
+    struct mt_chess_index_match * const out_matches,
+    uint64_t const max_count)
+{
+    assert(index != NULL);
+    assert(out_matches != NULL || max_count == 0);
+
+    // Find the first block starting with an equal or greater hash:
+
+    uint32_t low = 0;
+    uint32_t high = index->block_count;
+
+    while(low < high)
+    {
+        uint32_t const mid = low + (high - low) / 2;
+
+        if(get_first_hash(index, mid) < hash)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    // Matches may start in the block before:
+
+    uint64_t ret_val = 0;
+
+    for(uint32_t block = low == 0 ? 0 : low - 1;
+        block < index->block_count;
+        ++block)
+    {
+        uint64_t const begin = get_offset(index, block);
+        uint64_t const end = get_offset(index, block + 1);
+
+        if(end < begin || index->directory < end)
+        {
+            break; // Corrupted.
+        }
+
+        uint8_t const * pos = index->map.buf + begin;
+        uint64_t last_hash = get_first_hash(index, block);
+        uint64_t last_game = 0;
+
+        while(pos < index->map.buf + end)
+        {
+            uint64_t delta = 0;
+            uint64_t game = 0;
+            uint64_t ply = 0;
+
+            if(!get_varint(&pos, index->map.buf + end, &delta)
+                || !get_varint(&pos, index->map.buf + end, &game)
+                || !get_varint(&pos, index->map.buf + end, &ply))
+            {
+                return ret_val; // Corrupted.
+            }
+            if(delta != 0)
+            {
+                last_game = 0;
+            }
+            last_hash += delta;
+            last_game += game;
+
+            if(hash < last_hash)
+            {
+                return ret_val; // Passed all matches.
+            }
+            if(hash == last_hash)
+            {
+                if(ret_val < max_count)
+                {
+                    out_matches[ret_val].game = (uint32_t)last_game;
+                    out_matches[ret_val].ply = (uint16_t)ply;
+                }
+                ++ret_val;
+            }
+        }
+    }
+    return ret_val;
+}
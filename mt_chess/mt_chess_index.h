@@ -0,0 +1,112 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_INDEX
+#define MT_CHESS_INDEX
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_map.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Index of all positions reached by the games of a game record file (see
+// mt_chess_record.h), sorted by position hash, to find all games that reached
+// a position (all values little-endian):
+//
+// - Header (MT_CHESS_INDEX_HEADER_SIZE bytes):
+//
+//   - Bytes  0 -  3: "MTCI".
+//   - Bytes  4 -  5: Format version (MT_CHESS_INDEX_VERSION).
+//   - Bytes  6 -  7: Reserved (0).
+//   - Bytes  8 - 11: Count of entries per block (the last may hold less).
+//   - Bytes 12 - 15: Count of blocks.
+//   - Bytes 16 - 19: Count of games.
+//   - Bytes 20 - 23: Reserved (0).
+//   - Bytes 24 - 31: Count of entries.
+//   - Bytes 32 - 39: Offset of the directory.
+//
+// - Blocks of entries sorted by hash, game and ply. Each entry is stored as
+//   three variable-length integers (7 bits per byte, least significant
+//   first, high bit set, if more bytes follow):
+//
+//   - Hash minus the hash of the entry before (0 for the first in the block).
+//   - Game minus the game of the entry before, if the hashes are equal (the
+//     game itself, otherwise or for the first entry in the block).
+//   - Ply (0 is the start position).
+//
+// - Directory with the first hash (8 bytes) and the offset (8 bytes) of each
+//   block.
+//
+// Games are numbered by their order in the record file, starting at 0.
+// Different positions with equal hash are not told apart (unlikely).
+
+#define MT_CHESS_INDEX_VERSION 1
+#define MT_CHESS_INDEX_HEADER_SIZE 40
+
+struct mt_chess_index_match
+{
+    uint32_t game;
+    uint16_t ply;
+};
+
+// An opened index (to be used read-only by any count of threads).
+//
+struct mt_chess_index
+{
+    struct mt_chess_map map;
+    uint32_t block_count;
+    uint32_t game_count;
+    uint64_t entry_count;
+    uint64_t directory; // Offset.
+};
+
+/**
+ * - Builds the index of the games in the record file with given path and
+ *   writes it to the file with given index path.
+ * - Replays and sorts runs of the games in parallel by given count of threads
+ *   (0 for one per logical processor), runs not fitting into memory at once
+ *   get merged via temporary files next to the index file.
+ * - Returns false on error (e.g. invalid record).
+ */
+bool mt_chess_index_build(
+    char const * const record_path,
+    char const * const index_path,
+    int const thread_count);
+
+/**
+ * - Opens the index file with given path by mapping it into memory.
+ * - Returns false on error (e.g. not an index file of this version).
+ */
+bool mt_chess_index_open(
+    struct mt_chess_index * const index, char const * const path);
+
+void mt_chess_index_close(struct mt_chess_index * const index);
+
+/**
+ * - Finds all entries with given position hash (see mt_chess_zobrist.h) by
+ *   binary search of the directory, decoding just the blocks that may hold
+ *   matches.
+ * - Stores up to given maximum count of matches to given array.
+ * - Returns the count of matches found (may be more than stored).
+ */
+uint64_t mt_chess_index_find(
+    struct mt_chess_index const * const index,
+    uint64_t const hash,
+    struct mt_chess_index_match * const out_matches,
+    uint64_t const max_count);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_INDEX
@@ -0,0 +1,65 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstddef>
+    #include <cassert>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <assert.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_latency.h"
+#include "mt_chess_hist.h"
+#include "mt_chess_clock.h"
+#include "mt_chess_thread.h"
+
+static MT_CHESS_THREAD_LOCAL bool s_enabled = false;
+static MT_CHESS_THREAD_LOCAL struct mt_chess_hist
+    s_hists[mt_chess_latency_id_count];
+
+void mt_chess_latency_set_enabled(bool const enabled)
+{
+    s_enabled = enabled;
+}
+
+uint64_t mt_chess_latency_begin(void)
+{
+    if(!s_enabled)
+    {
+        return 0;
+    }
+    return mt_chess_clock_get_ns();
+}
+
+void mt_chess_latency_end(
+    enum mt_chess_latency_id const id, uint64_t const begin)
+{
+    assert(0 <= (int)id && (int)id < (int)mt_chess_latency_id_count);
+
+    if(begin == 0)
+    {
+        return;
+    }
+    mt_chess_hist_record(s_hists + id, mt_chess_clock_get_ns() - begin);
+}
+
+void mt_chess_latency_get(
+    enum mt_chess_latency_id const id, struct mt_chess_hist * const out_hist)
+{
+    assert(0 <= (int)id && (int)id < (int)mt_chess_latency_id_count);
+    assert(out_hist != NULL);
+
+    *out_hist = s_hists[id];
+}
+
+void mt_chess_latency_reset(void)
+{
+    for(int i = 0; i < (int)mt_chess_latency_id_count; ++i)
+    {
+        mt_chess_hist_reset(s_hists + i);
+    }
+}
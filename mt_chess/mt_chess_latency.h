@@ -0,0 +1,70 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_LATENCY
+#define MT_CHESS_LATENCY
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_hist.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Latency recording (in nanoseconds) of the calls to be measured against a
+// service level, into per-thread histograms:
+//
+// - Disabled by default, per thread (see mt_chess_latency_set_enabled()). If
+//   disabled, measuring costs a branch, only.
+// - No locking: Each thread records into its own histograms. Get a copy of
+//   them via mt_chess_latency_get() and merge via mt_chess_hist_merge().
+
+enum mt_chess_latency_id
+{
+    mt_chess_latency_id_try_move = 0, // mt_chess_try_move_in_game().
+    mt_chess_latency_id_bot_move = 1, // mt_chess_search_get_best().
+
+    mt_chess_latency_id_count = 2 // (not an ID)
+};
+
+/**
+ * - Enables or disables recording for the calling thread.
+ */
+void mt_chess_latency_set_enabled(bool const enabled);
+
+/**
+ * - Returns the start time to be given to mt_chess_latency_end() or 0, if
+ *   recording is disabled for the calling thread.
+ */
+uint64_t mt_chess_latency_begin(void);
+
+/**
+ * - Records the time since given start time (see mt_chess_latency_begin())
+ *   into the calling thread's histogram of given ID.
+ * - Does nothing, if given start time is 0.
+ */
+void mt_chess_latency_end(
+    enum mt_chess_latency_id const id, uint64_t const begin);
+
+/**
+ * - Copies the calling thread's histogram of given ID.
+ */
+void mt_chess_latency_get(
+    enum mt_chess_latency_id const id, struct mt_chess_hist * const out_hist);
+
+/**
+ * - Empties all histograms of the calling thread.
+ */
+void mt_chess_latency_reset(void);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_LATENCY
@@ -0,0 +1,61 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_LE
+#define MT_CHESS_LE
+
+#ifdef __cplusplus
+    #include <cstdint>
+#else //__cplusplus
+    #include <stdint.h>
+#endif //__cplusplus
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Little-endian integers in byte buffers (for file formats, independent of
+// the host's byte order and alignment):
+
+static inline void mt_chess_le_write_u16(
+    uint8_t * const out_buf, uint16_t const value)
+{
+    out_buf[0] = (uint8_t)value;
+    out_buf[1] = (uint8_t)(value >> 8);
+}
+
+static inline void mt_chess_le_write_u32(
+    uint8_t * const out_buf, uint32_t const value)
+{
+    mt_chess_le_write_u16(out_buf, (uint16_t)value);
+    mt_chess_le_write_u16(out_buf + 2, (uint16_t)(value >> 16));
+}
+
+static inline void mt_chess_le_write_u64(
+    uint8_t * const out_buf, uint64_t const value)
+{
+    mt_chess_le_write_u32(out_buf, (uint32_t)value);
+    mt_chess_le_write_u32(out_buf + 4, (uint32_t)(value >> 32));
+}
+
+static inline uint16_t mt_chess_le_read_u16(uint8_t const * const buf)
+{
+    return (uint16_t)(buf[0] | (buf[1] << 8));
+}
+
+static inline uint32_t mt_chess_le_read_u32(uint8_t const * const buf)
+{
+    return (uint32_t)mt_chess_le_read_u16(buf)
+        | ((uint32_t)mt_chess_le_read_u16(buf + 2) << 16);
+}
+
+static inline uint64_t mt_chess_le_read_u64(uint8_t const * const buf)
+{
+    return (uint64_t)mt_chess_le_read_u32(buf)
+        | ((uint64_t)mt_chess_le_read_u32(buf + 4) << 32);
+}
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_LE
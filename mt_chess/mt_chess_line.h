@@ -0,0 +1,53 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_LINE
+#define MT_CHESS_LINE
+
+#ifdef __cplusplus
+    #include <cstdint>
+#else //__cplusplus
+    #include <stdint.h>
+#endif //__cplusplus
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Lookup tables for all pairs of squares (indexed by the board indices of
+// the two squares), generated by "mt_chess_tool gentables" into
+// mt_chess_line_tables.c (do not edit that file).
+
+// Value of mt_chess_line_dir, if two squares are not on a common rank, file or
+// diagonal (or are equal).
+//
+#define MT_CHESS_LINE_NO_DIR 0xFF
+
+// Directions are (first four diagonal, last four orthogonal, steps as rows
+// and columns):
+//
+// 0: (-1, -1), 1: (-1, +1), 2: (+1, -1), 3: (+1, +1),
+// 4: (-1,  0), 5: ( 0, -1), 6: ( 0, +1), 7: (+1,  0)
+
+// Squares between (excluding) the two squares, if on a common rank, file or
+// diagonal. Zero, otherwise.
+//
+extern uint64_t const mt_chess_line_between[8 * 8][8 * 8];
+
+// The whole rank, file or diagonal (from edge to edge) both squares are on.
+// Zero, if there is none (or the squares are equal).
+//
+extern uint64_t const mt_chess_line_through[8 * 8][8 * 8];
+
+// Direction from the first to the second square or MT_CHESS_LINE_NO_DIR.
+//
+extern uint8_t const mt_chess_line_dir[8 * 8][8 * 8];
+
+// Chebyshev distance (count of king moves from one square to the other).
+//
+extern uint8_t const mt_chess_line_distance[8 * 8][8 * 8];
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_LINE
@@ -0,0 +1,4377 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cstdint>
+#else //__cplusplus
+    #include <stdint.h>
+#endif //__cplusplus
+
+#include "mt_chess_line.h"
+
+// Generated by "mt_chess_tool gentables", do not edit (see
+// mt_chess_line.h). Indexed by the board indices of both squares,
+// with a comment naming the first square.
+
+uint64_t const mt_chess_line_between[8 * 8][8 * 8] = {
+    { // a8
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000002ULL,
+        0x0000000000000006ULL, 0x000000000000000EULL, 0x000000000000001EULL,
+        0x000000000000003EULL, 0x000000000000007EULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000100ULL, 0x0000000000000000ULL,
+        0x0000000000000200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000001010100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000008040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000101010100ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000001008040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010101010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000201008040200ULL, 0x0000000000000000ULL, 0x0001010101010100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040201008040200ULL
+    },
+    { // b8
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000004ULL, 0x000000000000000CULL, 0x000000000000001CULL,
+        0x000000000000003CULL, 0x000000000000007CULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000200ULL,
+        0x0000000000000000ULL, 0x0000000000000400ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000020200ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000080400ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000002020200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000010080400ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000202020200ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000002010080400ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000020202020200ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000402010080400ULL, 0x0000000000000000ULL,
+        0x0002020202020200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // c8
+        0x0000000000000002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000008ULL, 0x0000000000000018ULL,
+        0x0000000000000038ULL, 0x0000000000000078ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000200ULL, 0x0000000000000000ULL,
+        0x0000000000000400ULL, 0x0000000000000000ULL, 0x0000000000000800ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000040400ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000100800ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000004040400ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000020100800ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000404040400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004020100800ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040404040400ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0004040404040400ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // d8
+        0x0000000000000006ULL, 0x0000000000000004ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000010ULL,
+        0x0000000000000030ULL, 0x0000000000000070ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000400ULL,
+        0x0000000000000000ULL, 0x0000000000000800ULL, 0x0000000000000000ULL,
+        0x0000000000001000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000020400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000080800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000201000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000008080800ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000040201000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000808080800ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000080808080800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080808080800ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // e8
+        0x000000000000000EULL, 0x000000000000000CULL, 0x0000000000000008ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000020ULL, 0x0000000000000060ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000800ULL, 0x0000000000000000ULL, 0x0000000000001000ULL,
+        0x0000000000000000ULL, 0x0000000000002000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000040800ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000101000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000402000ULL, 0x0000000002040800ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000010101000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001010101000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000101010101000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0010101010101000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // f8
+        0x000000000000001EULL, 0x000000000000001CULL, 0x0000000000000018ULL,
+        0x0000000000000010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000001000ULL, 0x0000000000000000ULL,
+        0x0000000000002000ULL, 0x0000000000000000ULL, 0x0000000000004000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000081000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000202000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000004081000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000020202000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000204081000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000002020202000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000202020202000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0020202020202000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // g8
+        0x000000000000003EULL, 0x000000000000003CULL, 0x0000000000000038ULL,
+        0x0000000000000030ULL, 0x0000000000000020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000002000ULL,
+        0x0000000000000000ULL, 0x0000000000004000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000102000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000404000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000008102000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000040404000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000408102000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000004040404000ULL, 0x0000000000000000ULL,
+        0x0000020408102000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000404040404000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040404040404000ULL,
+        0x0000000000000000ULL
+    },
+    { // h8
+        0x000000000000007EULL, 0x000000000000007CULL, 0x0000000000000078ULL,
+        0x0000000000000070ULL, 0x0000000000000060ULL, 0x0000000000000040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000004000ULL, 0x0000000000000000ULL, 0x0000000000008000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000204000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000808000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000010204000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000080808000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000810204000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008080808000ULL,
+        0x0000000000000000ULL, 0x0000040810204000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000808080808000ULL, 0x0002040810204000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0080808080808000ULL
+    },
+    { // a7
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000200ULL, 0x0000000000000600ULL,
+        0x0000000000000E00ULL, 0x0000000000001E00ULL, 0x0000000000003E00ULL,
+        0x0000000000007E00ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000010000ULL, 0x0000000000000000ULL, 0x0000000000020000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000001010000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000004020000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000101010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000804020000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010101010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000100804020000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001010101010000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020100804020000ULL,
+        0x0000000000000000ULL
+    },
+    { // b7
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000400ULL,
+        0x0000000000000C00ULL, 0x0000000000001C00ULL, 0x0000000000003C00ULL,
+        0x0000000000007C00ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000020000ULL, 0x0000000000000000ULL,
+        0x0000000000040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000002020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000008040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000202020000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000001008040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000020202020000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000201008040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0002020202020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040201008040000ULL
+    },
+    { // c7
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000200ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000800ULL, 0x0000000000001800ULL, 0x0000000000003800ULL,
+        0x0000000000007800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000020000ULL, 0x0000000000000000ULL, 0x0000000000040000ULL,
+        0x0000000000000000ULL, 0x0000000000080000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000004040000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000010080000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000404040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000002010080000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040404040000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000402010080000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0004040404040000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // d7
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000600ULL,
+        0x0000000000000400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000001000ULL, 0x0000000000003000ULL,
+        0x0000000000007000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000040000ULL, 0x0000000000000000ULL,
+        0x0000000000080000ULL, 0x0000000000000000ULL, 0x0000000000100000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000002040000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000008080000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000020100000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000808080000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004020100000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000080808080000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080808080000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // e7
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000E00ULL,
+        0x0000000000000C00ULL, 0x0000000000000800ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000002000ULL,
+        0x0000000000006000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000080000ULL,
+        0x0000000000000000ULL, 0x0000000000100000ULL, 0x0000000000000000ULL,
+        0x0000000000200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000004080000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000010100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000040200000ULL, 0x0000000204080000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001010100000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000101010100000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0010101010100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // f7
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000001E00ULL,
+        0x0000000000001C00ULL, 0x0000000000001800ULL, 0x0000000000001000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000004000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000100000ULL, 0x0000000000000000ULL, 0x0000000000200000ULL,
+        0x0000000000000000ULL, 0x0000000000400000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000008100000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000020200000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000408100000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000002020200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000020408100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000202020200000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0020202020200000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // g7
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000003E00ULL,
+        0x0000000000003C00ULL, 0x0000000000003800ULL, 0x0000000000003000ULL,
+        0x0000000000002000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000200000ULL, 0x0000000000000000ULL,
+        0x0000000000400000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000010200000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000040400000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000810200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000004040400000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000040810200000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000404040400000ULL, 0x0000000000000000ULL, 0x0002040810200000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040404040400000ULL,
+        0x0000000000000000ULL
+    },
+    { // h7
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000007E00ULL,
+        0x0000000000007C00ULL, 0x0000000000007800ULL, 0x0000000000007000ULL,
+        0x0000000000006000ULL, 0x0000000000004000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000400000ULL,
+        0x0000000000000000ULL, 0x0000000000800000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000020400000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000080800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000001020400000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008080800000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000081020400000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000808080800000ULL, 0x0000000000000000ULL,
+        0x0004081020400000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0080808080800000ULL
+    },
+    { // a6
+        0x0000000000000100ULL, 0x0000000000000000ULL, 0x0000000000000200ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000020000ULL, 0x0000000000060000ULL, 0x00000000000E0000ULL,
+        0x00000000001E0000ULL, 0x00000000003E0000ULL, 0x00000000007E0000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000001000000ULL,
+        0x0000000000000000ULL, 0x0000000002000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000101000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000402000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010101000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000080402000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001010101000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0010080402000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // b6
+        0x0000000000000000ULL, 0x0000000000000200ULL, 0x0000000000000000ULL,
+        0x0000000000000400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000040000ULL, 0x00000000000C0000ULL,
+        0x00000000001C0000ULL, 0x00000000003C0000ULL, 0x00000000007C0000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000002000000ULL, 0x0000000000000000ULL, 0x0000000004000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000202000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000804000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000020202000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000100804000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0002020202000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020100804000000ULL,
+        0x0000000000000000ULL
+    },
+    { // c6
+        0x0000000000000200ULL, 0x0000000000000000ULL, 0x0000000000000400ULL,
+        0x0000000000000000ULL, 0x0000000000000800ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000020000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000080000ULL,
+        0x0000000000180000ULL, 0x0000000000380000ULL, 0x0000000000780000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000002000000ULL,
+        0x0000000000000000ULL, 0x0000000004000000ULL, 0x0000000000000000ULL,
+        0x0000000008000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000404000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000001008000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040404000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000201008000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0004040404000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040201008000000ULL
+    },
+    { // d6
+        0x0000000000000000ULL, 0x0000000000000400ULL, 0x0000000000000000ULL,
+        0x0000000000000800ULL, 0x0000000000000000ULL, 0x0000000000001000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000060000ULL, 0x0000000000040000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000100000ULL, 0x0000000000300000ULL, 0x0000000000700000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000004000000ULL, 0x0000000000000000ULL, 0x0000000008000000ULL,
+        0x0000000000000000ULL, 0x0000000010000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000204000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000808000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000002010000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000080808000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000402010000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080808000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // e6
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000800ULL,
+        0x0000000000000000ULL, 0x0000000000001000ULL, 0x0000000000000000ULL,
+        0x0000000000002000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x00000000000E0000ULL, 0x00000000000C0000ULL,
+        0x0000000000080000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000200000ULL, 0x0000000000600000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000008000000ULL, 0x0000000000000000ULL,
+        0x0000000010000000ULL, 0x0000000000000000ULL, 0x0000000020000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000408000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001010000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004020000000ULL,
+        0x0000020408000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000101010000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0010101010000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // f6
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000001000ULL, 0x0000000000000000ULL, 0x0000000000002000ULL,
+        0x0000000000000000ULL, 0x0000000000004000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x00000000001E0000ULL, 0x00000000001C0000ULL,
+        0x0000000000180000ULL, 0x0000000000100000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000400000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000010000000ULL,
+        0x0000000000000000ULL, 0x0000000020000000ULL, 0x0000000000000000ULL,
+        0x0000000040000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000810000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000002020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000040810000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000202020000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002040810000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0020202020000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // g6
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000002000ULL, 0x0000000000000000ULL,
+        0x0000000000004000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x00000000003E0000ULL, 0x00000000003C0000ULL,
+        0x0000000000380000ULL, 0x0000000000300000ULL, 0x0000000000200000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000020000000ULL, 0x0000000000000000ULL, 0x0000000040000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000001020000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000004040000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000081020000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000404040000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0004081020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040404040000000ULL,
+        0x0000000000000000ULL
+    },
+    { // h6
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000004000ULL,
+        0x0000000000000000ULL, 0x0000000000008000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x00000000007E0000ULL, 0x00000000007C0000ULL,
+        0x0000000000780000ULL, 0x0000000000700000ULL, 0x0000000000600000ULL,
+        0x0000000000400000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000040000000ULL, 0x0000000000000000ULL,
+        0x0000000080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002040000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008080000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000102040000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000808080000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0008102040000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0080808080000000ULL
+    },
+    { // a5
+        0x0000000000010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000020400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000010000ULL,
+        0x0000000000000000ULL, 0x0000000000020000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000002000000ULL,
+        0x0000000006000000ULL, 0x000000000E000000ULL, 0x000000001E000000ULL,
+        0x000000003E000000ULL, 0x000000007E000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000100000000ULL, 0x0000000000000000ULL,
+        0x0000000200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010100000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000040200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001010100000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0008040200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // b5
+        0x0000000000000000ULL, 0x0000000000020200ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000040800ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000020000ULL, 0x0000000000000000ULL, 0x0000000000040000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000004000000ULL, 0x000000000C000000ULL, 0x000000001C000000ULL,
+        0x000000003C000000ULL, 0x000000007C000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000200000000ULL,
+        0x0000000000000000ULL, 0x0000000400000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000020200000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000080400000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0002020200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0010080400000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // c5
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000040400ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000081000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000020000ULL,
+        0x0000000000000000ULL, 0x0000000000040000ULL, 0x0000000000000000ULL,
+        0x0000000000080000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000002000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000008000000ULL, 0x0000000018000000ULL,
+        0x0000000038000000ULL, 0x0000000078000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000200000000ULL, 0x0000000000000000ULL,
+        0x0000000400000000ULL, 0x0000000000000000ULL, 0x0000000800000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040400000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000100800000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0004040400000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020100800000000ULL,
+        0x0000000000000000ULL
+    },
+    { // d5
+        0x0000000000040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000080800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000102000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000040000ULL, 0x0000000000000000ULL, 0x0000000000080000ULL,
+        0x0000000000000000ULL, 0x0000000000100000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000006000000ULL, 0x0000000004000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000010000000ULL,
+        0x0000000030000000ULL, 0x0000000070000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000400000000ULL,
+        0x0000000000000000ULL, 0x0000000800000000ULL, 0x0000000000000000ULL,
+        0x0000001000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000020400000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000080800000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000201000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080800000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040201000000000ULL
+    },
+    { // e5
+        0x0000000000000000ULL, 0x0000000000080400ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000101000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000204000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000080000ULL, 0x0000000000000000ULL,
+        0x0000000000100000ULL, 0x0000000000000000ULL, 0x0000000000200000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x000000000E000000ULL, 0x000000000C000000ULL, 0x0000000008000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000020000000ULL, 0x0000000060000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000800000000ULL, 0x0000000000000000ULL, 0x0000001000000000ULL,
+        0x0000000000000000ULL, 0x0000002000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000040800000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000101000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000402000000000ULL, 0x0002040800000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0010101000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // f5
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000100800ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000202000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000100000ULL,
+        0x0000000000000000ULL, 0x0000000000200000ULL, 0x0000000000000000ULL,
+        0x0000000000400000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x000000001E000000ULL, 0x000000001C000000ULL, 0x0000000018000000ULL,
+        0x0000000010000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000040000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000001000000000ULL, 0x0000000000000000ULL,
+        0x0000002000000000ULL, 0x0000000000000000ULL, 0x0000004000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000081000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000202000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0004081000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0020202000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // g5
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000201000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000404000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000200000ULL, 0x0000000000000000ULL, 0x0000000000400000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x000000003E000000ULL, 0x000000003C000000ULL, 0x0000000038000000ULL,
+        0x0000000030000000ULL, 0x0000000020000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002000000000ULL,
+        0x0000000000000000ULL, 0x0000004000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000102000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000404000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0008102000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040404000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // h5
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000402000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000808000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000400000ULL, 0x0000000000000000ULL,
+        0x0000000000800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x000000007E000000ULL, 0x000000007C000000ULL, 0x0000000078000000ULL,
+        0x0000000070000000ULL, 0x0000000060000000ULL, 0x0000000040000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000004000000000ULL, 0x0000000000000000ULL, 0x0000008000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000204000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000808000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010204000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0080808000000000ULL
+    },
+    { // a4
+        0x0000000001010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000002040800ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000001010000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000002040000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000001000000ULL, 0x0000000000000000ULL,
+        0x0000000002000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000200000000ULL, 0x0000000600000000ULL,
+        0x0000000E00000000ULL, 0x0000001E00000000ULL, 0x0000003E00000000ULL,
+        0x0000007E00000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010000000000ULL, 0x0000000000000000ULL, 0x0000020000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001010000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004020000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // b4
+        0x0000000000000000ULL, 0x0000000002020200ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000004081000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000002020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000004080000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000002000000ULL,
+        0x0000000000000000ULL, 0x0000000004000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000400000000ULL,
+        0x0000000C00000000ULL, 0x0000001C00000000ULL, 0x0000003C00000000ULL,
+        0x0000007C00000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000020000000000ULL, 0x0000000000000000ULL,
+        0x0000040000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0002020000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0008040000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // c4
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000004040400ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000008102000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000004040000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000008100000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000002000000ULL, 0x0000000000000000ULL,
+        0x0000000004000000ULL, 0x0000000000000000ULL, 0x0000000008000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000200000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000800000000ULL, 0x0000001800000000ULL, 0x0000003800000000ULL,
+        0x0000007800000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000020000000000ULL, 0x0000000000000000ULL, 0x0000040000000000ULL,
+        0x0000000000000000ULL, 0x0000080000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0004040000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0010080000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // d4
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000008080800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000010204000ULL, 0x0000000004020000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000008080000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000010200000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000004000000ULL,
+        0x0000000000000000ULL, 0x0000000008000000ULL, 0x0000000000000000ULL,
+        0x0000000010000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000600000000ULL,
+        0x0000000400000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000001000000000ULL, 0x0000003000000000ULL,
+        0x0000007000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000040000000000ULL, 0x0000000000000000ULL,
+        0x0000080000000000ULL, 0x0000000000000000ULL, 0x0000100000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002040000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020100000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // e4
+        0x0000000008040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000010101000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000008040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000010100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000020400000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000008000000ULL, 0x0000000000000000ULL, 0x0000000010000000ULL,
+        0x0000000000000000ULL, 0x0000000020000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000E00000000ULL,
+        0x0000000C00000000ULL, 0x0000000800000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002000000000ULL,
+        0x0000006000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000080000000000ULL,
+        0x0000000000000000ULL, 0x0000100000000000ULL, 0x0000000000000000ULL,
+        0x0000200000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0004080000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0010100000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040200000000000ULL
+    },
+    { // f4
+        0x0000000000000000ULL, 0x0000000010080400ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000020202000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000010080000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000020200000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000010000000ULL, 0x0000000000000000ULL,
+        0x0000000020000000ULL, 0x0000000000000000ULL, 0x0000000040000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001E00000000ULL,
+        0x0000001C00000000ULL, 0x0000001800000000ULL, 0x0000001000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000004000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000100000000000ULL, 0x0000000000000000ULL, 0x0000200000000000ULL,
+        0x0000000000000000ULL, 0x0000400000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0008100000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0020200000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // g4
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000020100800ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000040404000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000020100000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000040400000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000020000000ULL,
+        0x0000000000000000ULL, 0x0000000040000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003E00000000ULL,
+        0x0000003C00000000ULL, 0x0000003800000000ULL, 0x0000003000000000ULL,
+        0x0000002000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000200000000000ULL, 0x0000000000000000ULL,
+        0x0000400000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010200000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040400000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // h4
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000040201000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000080808000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000040200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000080800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000040000000ULL, 0x0000000000000000ULL, 0x0000000080000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000007E00000000ULL,
+        0x0000007C00000000ULL, 0x0000007800000000ULL, 0x0000007000000000ULL,
+        0x0000006000000000ULL, 0x0000004000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000400000000000ULL,
+        0x0000000000000000ULL, 0x0000800000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0020400000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0080800000000000ULL
+    },
+    { // a3
+        0x0000000101010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000204081000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000101010000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000204080000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000101000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000204000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000100000000ULL, 0x0000000000000000ULL, 0x0000000200000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000020000000000ULL, 0x0000060000000000ULL, 0x00000E0000000000ULL,
+        0x00001E0000000000ULL, 0x00003E0000000000ULL, 0x00007E0000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001000000000000ULL,
+        0x0000000000000000ULL, 0x0002000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // b3
+        0x0000000000000000ULL, 0x0000000202020200ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000408102000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000202020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000408100000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000202000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000408000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000200000000ULL, 0x0000000000000000ULL,
+        0x0000000400000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000040000000000ULL, 0x00000C0000000000ULL,
+        0x00001C0000000000ULL, 0x00003C0000000000ULL, 0x00007C0000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0002000000000000ULL, 0x0000000000000000ULL, 0x0004000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // c3
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000404040400ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000810204000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000404040000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000810200000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000404000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000810000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000200000000ULL, 0x0000000000000000ULL, 0x0000000400000000ULL,
+        0x0000000000000000ULL, 0x0000000800000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000020000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000080000000000ULL,
+        0x0000180000000000ULL, 0x0000380000000000ULL, 0x0000780000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002000000000000ULL,
+        0x0000000000000000ULL, 0x0004000000000000ULL, 0x0000000000000000ULL,
+        0x0008000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // d3
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000808080800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000808080000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000001020400000ULL, 0x0000000402000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000808000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000001020000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000400000000ULL, 0x0000000000000000ULL,
+        0x0000000800000000ULL, 0x0000000000000000ULL, 0x0000001000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000060000000000ULL, 0x0000040000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000100000000000ULL, 0x0000300000000000ULL, 0x0000700000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0004000000000000ULL, 0x0000000000000000ULL, 0x0008000000000000ULL,
+        0x0000000000000000ULL, 0x0010000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // e3
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000001010101000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000804020000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000001010100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000804000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001010000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002040000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000800000000ULL,
+        0x0000000000000000ULL, 0x0000001000000000ULL, 0x0000000000000000ULL,
+        0x0000002000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x00000E0000000000ULL, 0x00000C0000000000ULL,
+        0x0000080000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000200000000000ULL, 0x0000600000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0008000000000000ULL, 0x0000000000000000ULL,
+        0x0010000000000000ULL, 0x0000000000000000ULL, 0x0020000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // f3
+        0x0000001008040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002020202000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000001008040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000002020200000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000001008000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000002020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000001000000000ULL, 0x0000000000000000ULL, 0x0000002000000000ULL,
+        0x0000000000000000ULL, 0x0000004000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x00001E0000000000ULL, 0x00001C0000000000ULL,
+        0x0000180000000000ULL, 0x0000100000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000400000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010000000000000ULL,
+        0x0000000000000000ULL, 0x0020000000000000ULL, 0x0000000000000000ULL,
+        0x0040000000000000ULL
+    },
+    { // g3
+        0x0000000000000000ULL, 0x0000002010080400ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000004040404000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000002010080000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004040400000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000002010000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000004040000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000002000000000ULL, 0x0000000000000000ULL,
+        0x0000004000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x00003E0000000000ULL, 0x00003C0000000000ULL,
+        0x0000380000000000ULL, 0x0000300000000000ULL, 0x0000200000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0020000000000000ULL, 0x0000000000000000ULL, 0x0040000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // h3
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004020100800ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000008080808000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004020100000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008080800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004020000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008080000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004000000000ULL,
+        0x0000000000000000ULL, 0x0000008000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x00007E0000000000ULL, 0x00007C0000000000ULL,
+        0x0000780000000000ULL, 0x0000700000000000ULL, 0x0000600000000000ULL,
+        0x0000400000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0040000000000000ULL, 0x0000000000000000ULL,
+        0x0080000000000000ULL
+    },
+    { // a2
+        0x0000010101010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000020408102000ULL, 0x0000000000000000ULL, 0x0000010101010000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000020408100000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000010101000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000020408000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010100000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000020400000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010000000000ULL,
+        0x0000000000000000ULL, 0x0000020000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002000000000000ULL,
+        0x0006000000000000ULL, 0x000E000000000000ULL, 0x001E000000000000ULL,
+        0x003E000000000000ULL, 0x007E000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // b2
+        0x0000000000000000ULL, 0x0000020202020200ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000040810204000ULL, 0x0000000000000000ULL,
+        0x0000020202020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040810200000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000020202000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000040810000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000020200000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000040800000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000020000000000ULL, 0x0000000000000000ULL, 0x0000040000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0004000000000000ULL, 0x000C000000000000ULL, 0x001C000000000000ULL,
+        0x003C000000000000ULL, 0x007C000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // c2
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040404040400ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000040404040000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000081020400000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000040404000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000081020000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040400000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000081000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000020000000000ULL,
+        0x0000000000000000ULL, 0x0000040000000000ULL, 0x0000000000000000ULL,
+        0x0000080000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0002000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0008000000000000ULL, 0x0018000000000000ULL,
+        0x0038000000000000ULL, 0x0078000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // d2
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000080808080800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000080808080000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000080808000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000102040000000ULL,
+        0x0000040200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000080800000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000102000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000040000000000ULL, 0x0000000000000000ULL, 0x0000080000000000ULL,
+        0x0000000000000000ULL, 0x0000100000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0006000000000000ULL, 0x0004000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010000000000000ULL,
+        0x0030000000000000ULL, 0x0070000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // e2
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000101010101000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000101010100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000080402000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000101010000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000080400000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000101000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000204000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000080000000000ULL, 0x0000000000000000ULL,
+        0x0000100000000000ULL, 0x0000000000000000ULL, 0x0000200000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x000E000000000000ULL, 0x000C000000000000ULL, 0x0008000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0020000000000000ULL, 0x0060000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // f2
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000202020202000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000100804020000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000202020200000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000100804000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000202020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000100800000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000202000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000100000000000ULL,
+        0x0000000000000000ULL, 0x0000200000000000ULL, 0x0000000000000000ULL,
+        0x0000400000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x001E000000000000ULL, 0x001C000000000000ULL, 0x0018000000000000ULL,
+        0x0010000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0040000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // g2
+        0x0000201008040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000404040404000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000201008040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000404040400000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000201008000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000404040000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000201000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000404000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000200000000000ULL, 0x0000000000000000ULL, 0x0000400000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x003E000000000000ULL, 0x003C000000000000ULL, 0x0038000000000000ULL,
+        0x0030000000000000ULL, 0x0020000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // h2
+        0x0000000000000000ULL, 0x0000402010080400ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000808080808000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000402010080000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000808080800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000402010000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000808080000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000402000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000808000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000400000000000ULL, 0x0000000000000000ULL,
+        0x0000800000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x007E000000000000ULL, 0x007C000000000000ULL, 0x0078000000000000ULL,
+        0x0070000000000000ULL, 0x0060000000000000ULL, 0x0040000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // a1
+        0x0001010101010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0002040810204000ULL, 0x0001010101010000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002040810200000ULL,
+        0x0000000000000000ULL, 0x0001010101000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0002040810000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001010100000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0002040800000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001010000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002040000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0001000000000000ULL, 0x0000000000000000ULL,
+        0x0002000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0200000000000000ULL, 0x0600000000000000ULL,
+        0x0E00000000000000ULL, 0x1E00000000000000ULL, 0x3E00000000000000ULL,
+        0x7E00000000000000ULL
+    },
+    { // b1
+        0x0000000000000000ULL, 0x0002020202020200ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0002020202020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0004081020400000ULL, 0x0000000000000000ULL, 0x0002020202000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0004081020000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0002020200000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004081000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0002020000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0004080000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002000000000000ULL,
+        0x0000000000000000ULL, 0x0004000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0400000000000000ULL,
+        0x0C00000000000000ULL, 0x1C00000000000000ULL, 0x3C00000000000000ULL,
+        0x7C00000000000000ULL
+    },
+    { // c1
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004040404040400ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0004040404040000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0004040404000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008102040000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004040400000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0008102000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0004040000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0008100000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0002000000000000ULL, 0x0000000000000000ULL,
+        0x0004000000000000ULL, 0x0000000000000000ULL, 0x0008000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0200000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0800000000000000ULL, 0x1800000000000000ULL, 0x3800000000000000ULL,
+        0x7800000000000000ULL
+    },
+    { // d1
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0008080808080800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080808080000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0008080808000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0008080800000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0010204000000000ULL, 0x0004020000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010200000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004000000000000ULL,
+        0x0000000000000000ULL, 0x0008000000000000ULL, 0x0000000000000000ULL,
+        0x0010000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0600000000000000ULL,
+        0x0400000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1000000000000000ULL, 0x3000000000000000ULL,
+        0x7000000000000000ULL
+    },
+    { // e1
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0010101010101000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0010101010100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010101010000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0008040200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0010101000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0008040000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0010100000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0020400000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0008000000000000ULL, 0x0000000000000000ULL, 0x0010000000000000ULL,
+        0x0000000000000000ULL, 0x0020000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0E00000000000000ULL,
+        0x0C00000000000000ULL, 0x0800000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2000000000000000ULL,
+        0x6000000000000000ULL
+    },
+    { // f1
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020202020202000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0020202020200000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0010080402000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0020202020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0010080400000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020202000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0010080000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0020200000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0010000000000000ULL, 0x0000000000000000ULL,
+        0x0020000000000000ULL, 0x0000000000000000ULL, 0x0040000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x1E00000000000000ULL,
+        0x1C00000000000000ULL, 0x1800000000000000ULL, 0x1000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4000000000000000ULL
+    },
+    { // g1
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040404040404000ULL, 0x0000000000000000ULL, 0x0020100804020000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040404040400000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020100804000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0040404040000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020100800000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040404000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020100000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040400000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020000000000000ULL,
+        0x0000000000000000ULL, 0x0040000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x3E00000000000000ULL,
+        0x3C00000000000000ULL, 0x3800000000000000ULL, 0x3000000000000000ULL,
+        0x2000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // h1
+        0x0040201008040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080808080808000ULL, 0x0000000000000000ULL,
+        0x0040201008040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0080808080800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040201008000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080808080000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040201000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080808000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040200000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0080800000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040000000000000ULL, 0x0000000000000000ULL, 0x0080000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x7E00000000000000ULL,
+        0x7C00000000000000ULL, 0x7800000000000000ULL, 0x7000000000000000ULL,
+        0x6000000000000000ULL, 0x4000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    }
+};
+
+uint64_t const mt_chess_line_through[8 * 8][8 * 8] = {
+    { // a8
+        0x0000000000000000ULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x0101010101010101ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL
+    },
+    { // b8
+        0x00000000000000FFULL, 0x0000000000000000ULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x0000000000000102ULL,
+        0x0202020202020202ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0202020202020202ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0202020202020202ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // c8
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x0000000000000000ULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x0000000000000000ULL,
+        0x0000000000010204ULL, 0x0404040404040404ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000010204ULL, 0x0000000000000000ULL,
+        0x0404040404040404ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0404040404040404ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // d8
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x0000000000000000ULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000001020408ULL, 0x0808080808080808ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000001020408ULL,
+        0x0000000000000000ULL, 0x0808080808080808ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000001020408ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0808080808080808ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // e8
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x0000000000000000ULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000102040810ULL,
+        0x1010101010101010ULL, 0x0000000080402010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000102040810ULL, 0x0000000000000000ULL, 0x1010101010101010ULL,
+        0x0000000000000000ULL, 0x0000000080402010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000102040810ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000080402010ULL, 0x0000000102040810ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x1010101010101010ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // f8
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x0000000000000000ULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010204081020ULL, 0x2020202020202020ULL, 0x0000000000804020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL,
+        0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000804020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010204081020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // g8
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x0000000000000000ULL, 0x00000000000000FFULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0001020408102040ULL, 0x4040404040404040ULL,
+        0x0000000000008040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+        0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL
+    },
+    { // h8
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL
+    },
+    { // a7
+        0x0101010101010101ULL, 0x0000000000000102ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x0101010101010101ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL
+    },
+    { // b7
+        0x8040201008040201ULL, 0x0202020202020202ULL, 0x0000000000010204ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000000000FF00ULL,
+        0x0000000000000000ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x0000000000010204ULL, 0x0202020202020202ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0202020202020202ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL
+    },
+    { // c7
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0404040404040404ULL,
+        0x0000000001020408ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x0000000000000000ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x0000000000000000ULL, 0x0000000001020408ULL,
+        0x0404040404040404ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000001020408ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0404040404040404ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // d7
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0808080808080808ULL, 0x0000000102040810ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x0000000000000000ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000102040810ULL, 0x0808080808080808ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000102040810ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000102040810ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0808080808080808ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // e7
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x1010101010101010ULL, 0x0000010204081020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x0000000000000000ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000010204081020ULL, 0x1010101010101010ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010204081020ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000010204081020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x1010101010101010ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // f7
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000080402010ULL, 0x2020202020202020ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x0000000000000000ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+        0x2020202020202020ULL, 0x0000000080402010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000080402010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // g7
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000804020ULL,
+        0x4040404040404040ULL, 0x0102040810204080ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x0000000000000000ULL,
+        0x000000000000FF00ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x4040404040404040ULL, 0x0000000000804020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL
+    },
+    { // h7
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000008040ULL, 0x8080808080808080ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0204081020408000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL
+    },
+    { // a6
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000010204ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000010204ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0101010101010101ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // b6
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000001020408ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0202020202020202ULL, 0x0000000001020408ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000FF0000ULL, 0x0000000000000000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000001020408ULL, 0x0202020202020202ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0202020202020202ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL
+    },
+    { // c6
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000102040810ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0404040404040404ULL, 0x0000000102040810ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000000000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000000000ULL, 0x0000000102040810ULL, 0x0404040404040404ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000102040810ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0404040404040404ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL
+    },
+    { // d6
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000010204081020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0808080808080808ULL,
+        0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000000000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010204081020ULL,
+        0x0808080808080808ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010204081020ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0808080808080808ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // e6
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x1010101010101010ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000000000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x1010101010101010ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x1010101010101010ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // f6
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x2020202020202020ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000000000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x2020202020202020ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // g6
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000080402010ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000080402010ULL, 0x4040404040404040ULL,
+        0x0204081020408000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000000000ULL, 0x0000000000FF0000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+        0x4040404040404040ULL, 0x0000000080402010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL
+    },
+    { // h6
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000804020ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000804020ULL,
+        0x8080808080808080ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0408102040800000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0408102040800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL
+    },
+    { // a5
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000001020408ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000001020408ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000001020408ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x0101010101010101ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // b5
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000102040810ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000102040810ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0202020202020202ULL,
+        0x0000000102040810ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x00000000FF000000ULL, 0x0000000000000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x0000000102040810ULL,
+        0x0202020202020202ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0202020202020202ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // c5
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010204081020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0404040404040404ULL, 0x0000010204081020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x0000000000000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x0000000000000000ULL,
+        0x0000010204081020ULL, 0x0404040404040404ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL,
+        0x0404040404040404ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL
+    },
+    { // d5
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0808080808080808ULL, 0x0001020408102040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x0000000000000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0001020408102040ULL, 0x0808080808080808ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+        0x0000000000000000ULL, 0x0808080808080808ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL
+    },
+    { // e5
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x1010101010101010ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x0000000000000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x1010101010101010ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x1010101010101010ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // f5
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x2020202020202020ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x0000000000000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x2020202020202020ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+        0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // g5
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x4040404040404040ULL, 0x0408102040800000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x0000000000000000ULL, 0x00000000FF000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0408102040800000ULL, 0x4040404040404040ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+        0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0408102040800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL
+    },
+    { // h5
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000080402010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000080402010ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000080402010ULL, 0x8080808080808080ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0810204080000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0810204080000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0810204080000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0810204080000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL
+    },
+    { // a4
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000102040810ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000102040810ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000000000000ULL,
+        0x0000000102040810ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000102040810ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x0101010101010101ULL, 0x0804020100000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0804020100000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0804020100000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // b4
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010204081020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0202020202020202ULL,
+        0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0202020202020202ULL, 0x0000010204081020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000FF00000000ULL,
+        0x0000000000000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x0000010204081020ULL, 0x0202020202020202ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // c4
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0404040404040404ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0404040404040404ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x0000000000000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+        0x0404040404040404ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // d4
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0808080808080808ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0808080808080808ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x0000000000000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0808080808080808ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL
+    },
+    { // e4
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x1010101010101010ULL,
+        0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x1010101010101010ULL, 0x0204081020408000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x0000000000000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0204081020408000ULL, 0x1010101010101010ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL
+    },
+    { // f4
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x2020202020202020ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x2020202020202020ULL,
+        0x0408102040800000ULL, 0x0000000000000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x0000000000000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+        0x2020202020202020ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0408102040800000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // g4
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x4040404040404040ULL, 0x0810204080000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x0000000000000000ULL,
+        0x000000FF00000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0810204080000000ULL, 0x4040404040404040ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0810204080000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0810204080000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL
+    },
+    { // h4
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x8080808080808080ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1020408000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x1020408000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1020408000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL
+    },
+    { // a3
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010204081020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000010204081020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0101010101010101ULL, 0x0402010000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0402010000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // b3
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0202020202020202ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0804020100000000ULL,
+        0x0202020202020202ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000FF0000000000ULL, 0x0000000000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0001020408102040ULL, 0x0202020202020202ULL, 0x0804020100000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0804020100000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // c3
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0404040404040404ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0404040404040404ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000000000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0404040404040404ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // d3
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0808080808080808ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0808080808080808ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000000000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+        0x0808080808080808ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // e3
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x1010101010101010ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0408102040800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x1010101010101010ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000000000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0408102040800000ULL, 0x1010101010101010ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL
+    },
+    { // f3
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0810204080000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x2020202020202020ULL, 0x0810204080000000ULL,
+        0x0000000000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000000000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0810204080000000ULL, 0x2020202020202020ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0810204080000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL
+    },
+    { // g3
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x4040404040404040ULL,
+        0x1020408000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000000000000000ULL, 0x0000FF0000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x1020408000000000ULL,
+        0x4040404040404040ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1020408000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL
+    },
+    { // h3
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x8080808080808080ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x2040800000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2040800000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL
+    },
+    { // a2
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0001020408102040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x0101010101010101ULL,
+        0x0201000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // b2
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0202020202020202ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0402010000000000ULL, 0x0202020202020202ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x00FF000000000000ULL, 0x0000000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x0102040810204080ULL,
+        0x0202020202020202ULL, 0x0402010000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // c2
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0404040404040404ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0804020100000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0804020100000000ULL,
+        0x0404040404040404ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x0000000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0404040404040404ULL, 0x0804020100000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // d2
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0808080808080808ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0408102040800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0808080808080808ULL, 0x0408102040800000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x0000000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0408102040800000ULL, 0x0808080808080808ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // e2
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x1010101010101010ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0810204080000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0810204080000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x1010101010101010ULL,
+        0x0810204080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x0000000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0810204080000000ULL,
+        0x1010101010101010ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL
+    },
+    { // f2
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x1020408000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x2020202020202020ULL, 0x1020408000000000ULL, 0x0000000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x0000000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1020408000000000ULL, 0x2020202020202020ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL
+    },
+    { // g2
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x4040404040404040ULL, 0x2040800000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x0000000000000000ULL, 0x00FF000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2040800000000000ULL, 0x4040404040404040ULL,
+        0x8040201008040201ULL
+    },
+    { // h2
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x8080808080808080ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4080000000000000ULL,
+        0x8080808080808080ULL
+    },
+    { // a1
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL
+    },
+    { // b1
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0202020202020202ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0202020202020202ULL,
+        0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0201000000000000ULL, 0x0202020202020202ULL, 0x0204081020408000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0xFF00000000000000ULL,
+        0x0000000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL
+    },
+    { // c1
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0404040404040404ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0408102040800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0402010000000000ULL, 0x0000000000000000ULL,
+        0x0404040404040404ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0402010000000000ULL, 0x0404040404040404ULL,
+        0x0408102040800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0x0000000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL
+    },
+    { // d1
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0808080808080808ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0810204080000000ULL, 0x0804020100000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0810204080000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0804020100000000ULL,
+        0x0000000000000000ULL, 0x0808080808080808ULL, 0x0000000000000000ULL,
+        0x0810204080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0804020100000000ULL,
+        0x0808080808080808ULL, 0x0810204080000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0x0000000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL
+    },
+    { // e1
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x1010101010101010ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1020408000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x1010101010101010ULL,
+        0x0000000000000000ULL, 0x1020408000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x1010101010101010ULL, 0x1020408000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0x0000000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL
+    },
+    { // f1
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x2020202020202020ULL, 0x0000000000000000ULL, 0x2040800000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x2020202020202020ULL,
+        0x2040800000000000ULL, 0x0000000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0x0000000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL
+    },
+    { // g1
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x4040404040404040ULL, 0x4080000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0x0000000000000000ULL,
+        0xFF00000000000000ULL
+    },
+    { // h1
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x8080808080808080ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0x0000000000000000ULL
+    }
+};
+
+uint8_t const mt_chess_line_dir[8 * 8][8 * 8] = {
+    { // a8
+        255,   6,   6,   6,   6,   6,   6,   6,
+          7,   3, 255, 255, 255, 255, 255, 255,
+          7, 255,   3, 255, 255, 255, 255, 255,
+          7, 255, 255,   3, 255, 255, 255, 255,
+          7, 255, 255, 255,   3, 255, 255, 255,
+          7, 255, 255, 255, 255,   3, 255, 255,
+          7, 255, 255, 255, 255, 255,   3, 255,
+          7, 255, 255, 255, 255, 255, 255,   3
+    },
+    { // b8
+          5, 255,   6,   6,   6,   6,   6,   6,
+          2,   7,   3, 255, 255, 255, 255, 255,
+        255,   7, 255,   3, 255, 255, 255, 255,
+        255,   7, 255, 255,   3, 255, 255, 255,
+        255,   7, 255, 255, 255,   3, 255, 255,
+        255,   7, 255, 255, 255, 255,   3, 255,
+        255,   7, 255, 255, 255, 255, 255,   3,
+        255,   7, 255, 255, 255, 255, 255, 255
+    },
+    { // c8
+          5,   5, 255,   6,   6,   6,   6,   6,
+        255,   2,   7,   3, 255, 255, 255, 255,
+          2, 255,   7, 255,   3, 255, 255, 255,
+        255, 255,   7, 255, 255,   3, 255, 255,
+        255, 255,   7, 255, 255, 255,   3, 255,
+        255, 255,   7, 255, 255, 255, 255,   3,
+        255, 255,   7, 255, 255, 255, 255, 255,
+        255, 255,   7, 255, 255, 255, 255, 255
+    },
+    { // d8
+          5,   5,   5, 255,   6,   6,   6,   6,
+        255, 255,   2,   7,   3, 255, 255, 255,
+        255,   2, 255,   7, 255,   3, 255, 255,
+          2, 255, 255,   7, 255, 255,   3, 255,
+        255, 255, 255,   7, 255, 255, 255,   3,
+        255, 255, 255,   7, 255, 255, 255, 255,
+        255, 255, 255,   7, 255, 255, 255, 255,
+        255, 255, 255,   7, 255, 255, 255, 255
+    },
+    { // e8
+          5,   5,   5,   5, 255,   6,   6,   6,
+        255, 255, 255,   2,   7,   3, 255, 255,
+        255, 255,   2, 255,   7, 255,   3, 255,
+        255,   2, 255, 255,   7, 255, 255,   3,
+          2, 255, 255, 255,   7, 255, 255, 255,
+        255, 255, 255, 255,   7, 255, 255, 255,
+        255, 255, 255, 255,   7, 255, 255, 255,
+        255, 255, 255, 255,   7, 255, 255, 255
+    },
+    { // f8
+          5,   5,   5,   5,   5, 255,   6,   6,
+        255, 255, 255, 255,   2,   7,   3, 255,
+        255, 255, 255,   2, 255,   7, 255,   3,
+        255, 255,   2, 255, 255,   7, 255, 255,
+        255,   2, 255, 255, 255,   7, 255, 255,
+          2, 255, 255, 255, 255,   7, 255, 255,
+        255, 255, 255, 255, 255,   7, 255, 255,
+        255, 255, 255, 255, 255,   7, 255, 255
+    },
+    { // g8
+          5,   5,   5,   5,   5,   5, 255,   6,
+        255, 255, 255, 255, 255,   2,   7,   3,
+        255, 255, 255, 255,   2, 255,   7, 255,
+        255, 255, 255,   2, 255, 255,   7, 255,
+        255, 255,   2, 255, 255, 255,   7, 255,
+        255,   2, 255, 255, 255, 255,   7, 255,
+          2, 255, 255, 255, 255, 255,   7, 255,
+        255, 255, 255, 255, 255, 255,   7, 255
+    },
+    { // h8
+          5,   5,   5,   5,   5,   5,   5, 255,
+        255, 255, 255, 255, 255, 255,   2,   7,
+        255, 255, 255, 255, 255,   2, 255,   7,
+        255, 255, 255, 255,   2, 255, 255,   7,
+        255, 255, 255,   2, 255, 255, 255,   7,
+        255, 255,   2, 255, 255, 255, 255,   7,
+        255,   2, 255, 255, 255, 255, 255,   7,
+          2, 255, 255, 255, 255, 255, 255,   7
+    },
+    { // a7
+          4,   1, 255, 255, 255, 255, 255, 255,
+        255,   6,   6,   6,   6,   6,   6,   6,
+          7,   3, 255, 255, 255, 255, 255, 255,
+          7, 255,   3, 255, 255, 255, 255, 255,
+          7, 255, 255,   3, 255, 255, 255, 255,
+          7, 255, 255, 255,   3, 255, 255, 255,
+          7, 255, 255, 255, 255,   3, 255, 255,
+          7, 255, 255, 255, 255, 255,   3, 255
+    },
+    { // b7
+          0,   4,   1, 255, 255, 255, 255, 255,
+          5, 255,   6,   6,   6,   6,   6,   6,
+          2,   7,   3, 255, 255, 255, 255, 255,
+        255,   7, 255,   3, 255, 255, 255, 255,
+        255,   7, 255, 255,   3, 255, 255, 255,
+        255,   7, 255, 255, 255,   3, 255, 255,
+        255,   7, 255, 255, 255, 255,   3, 255,
+        255,   7, 255, 255, 255, 255, 255,   3
+    },
+    { // c7
+        255,   0,   4,   1, 255, 255, 255, 255,
+          5,   5, 255,   6,   6,   6,   6,   6,
+        255,   2,   7,   3, 255, 255, 255, 255,
+          2, 255,   7, 255,   3, 255, 255, 255,
+        255, 255,   7, 255, 255,   3, 255, 255,
+        255, 255,   7, 255, 255, 255,   3, 255,
+        255, 255,   7, 255, 255, 255, 255,   3,
+        255, 255,   7, 255, 255, 255, 255, 255
+    },
+    { // d7
+        255, 255,   0,   4,   1, 255, 255, 255,
+          5,   5,   5, 255,   6,   6,   6,   6,
+        255, 255,   2,   7,   3, 255, 255, 255,
+        255,   2, 255,   7, 255,   3, 255, 255,
+          2, 255, 255,   7, 255, 255,   3, 255,
+        255, 255, 255,   7, 255, 255, 255,   3,
+        255, 255, 255,   7, 255, 255, 255, 255,
+        255, 255, 255,   7, 255, 255, 255, 255
+    },
+    { // e7
+        255, 255, 255,   0,   4,   1, 255, 255,
+          5,   5,   5,   5, 255,   6,   6,   6,
+        255, 255, 255,   2,   7,   3, 255, 255,
+        255, 255,   2, 255,   7, 255,   3, 255,
+        255,   2, 255, 255,   7, 255, 255,   3,
+          2, 255, 255, 255,   7, 255, 255, 255,
+        255, 255, 255, 255,   7, 255, 255, 255,
+        255, 255, 255, 255,   7, 255, 255, 255
+    },
+    { // f7
+        255, 255, 255, 255,   0,   4,   1, 255,
+          5,   5,   5,   5,   5, 255,   6,   6,
+        255, 255, 255, 255,   2,   7,   3, 255,
+        255, 255, 255,   2, 255,   7, 255,   3,
+        255, 255,   2, 255, 255,   7, 255, 255,
+        255,   2, 255, 255, 255,   7, 255, 255,
+          2, 255, 255, 255, 255,   7, 255, 255,
+        255, 255, 255, 255, 255,   7, 255, 255
+    },
+    { // g7
+        255, 255, 255, 255, 255,   0,   4,   1,
+          5,   5,   5,   5,   5,   5, 255,   6,
+        255, 255, 255, 255, 255,   2,   7,   3,
+        255, 255, 255, 255,   2, 255,   7, 255,
+        255, 255, 255,   2, 255, 255,   7, 255,
+        255, 255,   2, 255, 255, 255,   7, 255,
+        255,   2, 255, 255, 255, 255,   7, 255,
+          2, 255, 255, 255, 255, 255,   7, 255
+    },
+    { // h7
+        255, 255, 255, 255, 255, 255,   0,   4,
+          5,   5,   5,   5,   5,   5,   5, 255,
+        255, 255, 255, 255, 255, 255,   2,   7,
+        255, 255, 255, 255, 255,   2, 255,   7,
+        255, 255, 255, 255,   2, 255, 255,   7,
+        255, 255, 255,   2, 255, 255, 255,   7,
+        255, 255,   2, 255, 255, 255, 255,   7,
+        255,   2, 255, 255, 255, 255, 255,   7
+    },
+    { // a6
+          4, 255,   1, 255, 255, 255, 255, 255,
+          4,   1, 255, 255, 255, 255, 255, 255,
+        255,   6,   6,   6,   6,   6,   6,   6,
+          7,   3, 255, 255, 255, 255, 255, 255,
+          7, 255,   3, 255, 255, 255, 255, 255,
+          7, 255, 255,   3, 255, 255, 255, 255,
+          7, 255, 255, 255,   3, 255, 255, 255,
+          7, 255, 255, 255, 255,   3, 255, 255
+    },
+    { // b6
+        255,   4, 255,   1, 255, 255, 255, 255,
+          0,   4,   1, 255, 255, 255, 255, 255,
+          5, 255,   6,   6,   6,   6,   6,   6,
+          2,   7,   3, 255, 255, 255, 255, 255,
+        255,   7, 255,   3, 255, 255, 255, 255,
+        255,   7, 255, 255,   3, 255, 255, 255,
+        255,   7, 255, 255, 255,   3, 255, 255,
+        255,   7, 255, 255, 255, 255,   3, 255
+    },
+    { // c6
+          0, 255,   4, 255,   1, 255, 255, 255,
+        255,   0,   4,   1, 255, 255, 255, 255,
+          5,   5, 255,   6,   6,   6,   6,   6,
+        255,   2,   7,   3, 255, 255, 255, 255,
+          2, 255,   7, 255,   3, 255, 255, 255,
+        255, 255,   7, 255, 255,   3, 255, 255,
+        255, 255,   7, 255, 255, 255,   3, 255,
+        255, 255,   7, 255, 255, 255, 255,   3
+    },
+    { // d6
+        255,   0, 255,   4, 255,   1, 255, 255,
+        255, 255,   0,   4,   1, 255, 255, 255,
+          5,   5,   5, 255,   6,   6,   6,   6,
+        255, 255,   2,   7,   3, 255, 255, 255,
+        255,   2, 255,   7, 255,   3, 255, 255,
+          2, 255, 255,   7, 255, 255,   3, 255,
+        255, 255, 255,   7, 255, 255, 255,   3,
+        255, 255, 255,   7, 255, 255, 255, 255
+    },
+    { // e6
+        255, 255,   0, 255,   4, 255,   1, 255,
+        255, 255, 255,   0,   4,   1, 255, 255,
+          5,   5,   5,   5, 255,   6,   6,   6,
+        255, 255, 255,   2,   7,   3, 255, 255,
+        255, 255,   2, 255,   7, 255,   3, 255,
+        255,   2, 255, 255,   7, 255, 255,   3,
+          2, 255, 255, 255,   7, 255, 255, 255,
+        255, 255, 255, 255,   7, 255, 255, 255
+    },
+    { // f6
+        255, 255, 255,   0, 255,   4, 255,   1,
+        255, 255, 255, 255,   0,   4,   1, 255,
+          5,   5,   5,   5,   5, 255,   6,   6,
+        255, 255, 255, 255,   2,   7,   3, 255,
+        255, 255, 255,   2, 255,   7, 255,   3,
+        255, 255,   2, 255, 255,   7, 255, 255,
+        255,   2, 255, 255, 255,   7, 255, 255,
+          2, 255, 255, 255, 255,   7, 255, 255
+    },
+    { // g6
+        255, 255, 255, 255,   0, 255,   4, 255,
+        255, 255, 255, 255, 255,   0,   4,   1,
+          5,   5,   5,   5,   5,   5, 255,   6,
+        255, 255, 255, 255, 255,   2,   7,   3,
+        255, 255, 255, 255,   2, 255,   7, 255,
+        255, 255, 255,   2, 255, 255,   7, 255,
+        255, 255,   2, 255, 255, 255,   7, 255,
+        255,   2, 255, 255, 255, 255,   7, 255
+    },
+    { // h6
+        255, 255, 255, 255, 255,   0, 255,   4,
+        255, 255, 255, 255, 255, 255,   0,   4,
+          5,   5,   5,   5,   5,   5,   5, 255,
+        255, 255, 255, 255, 255, 255,   2,   7,
+        255, 255, 255, 255, 255,   2, 255,   7,
+        255, 255, 255, 255,   2, 255, 255,   7,
+        255, 255, 255,   2, 255, 255, 255,   7,
+        255, 255,   2, 255, 255, 255, 255,   7
+    },
+    { // a5
+          4, 255, 255,   1, 255, 255, 255, 255,
+          4, 255,   1, 255, 255, 255, 255, 255,
+          4,   1, 255, 255, 255, 255, 255, 255,
+        255,   6,   6,   6,   6,   6,   6,   6,
+          7,   3, 255, 255, 255, 255, 255, 255,
+          7, 255,   3, 255, 255, 255, 255, 255,
+          7, 255, 255,   3, 255, 255, 255, 255,
+          7, 255, 255, 255,   3, 255, 255, 255
+    },
+    { // b5
+        255,   4, 255, 255,   1, 255, 255, 255,
+        255,   4, 255,   1, 255, 255, 255, 255,
+          0,   4,   1, 255, 255, 255, 255, 255,
+          5, 255,   6,   6,   6,   6,   6,   6,
+          2,   7,   3, 255, 255, 255, 255, 255,
+        255,   7, 255,   3, 255, 255, 255, 255,
+        255,   7, 255, 255,   3, 255, 255, 255,
+        255,   7, 255, 255, 255,   3, 255, 255
+    },
+    { // c5
+        255, 255,   4, 255, 255,   1, 255, 255,
+          0, 255,   4, 255,   1, 255, 255, 255,
+        255,   0,   4,   1, 255, 255, 255, 255,
+          5,   5, 255,   6,   6,   6,   6,   6,
+        255,   2,   7,   3, 255, 255, 255, 255,
+          2, 255,   7, 255,   3, 255, 255, 255,
+        255, 255,   7, 255, 255,   3, 255, 255,
+        255, 255,   7, 255, 255, 255,   3, 255
+    },
+    { // d5
+          0, 255, 255,   4, 255, 255,   1, 255,
+        255,   0, 255,   4, 255,   1, 255, 255,
+        255, 255,   0,   4,   1, 255, 255, 255,
+          5,   5,   5, 255,   6,   6,   6,   6,
+        255, 255,   2,   7,   3, 255, 255, 255,
+        255,   2, 255,   7, 255,   3, 255, 255,
+          2, 255, 255,   7, 255, 255,   3, 255,
+        255, 255, 255,   7, 255, 255, 255,   3
+    },
+    { // e5
+        255,   0, 255, 255,   4, 255, 255,   1,
+        255, 255,   0, 255,   4, 255,   1, 255,
+        255, 255, 255,   0,   4,   1, 255, 255,
+          5,   5,   5,   5, 255,   6,   6,   6,
+        255, 255, 255,   2,   7,   3, 255, 255,
+        255, 255,   2, 255,   7, 255,   3, 255,
+        255,   2, 255, 255,   7, 255, 255,   3,
+          2, 255, 255, 255,   7, 255, 255, 255
+    },
+    { // f5
+        255, 255,   0, 255, 255,   4, 255, 255,
+        255, 255, 255,   0, 255,   4, 255,   1,
+        255, 255, 255, 255,   0,   4,   1, 255,
+          5,   5,   5,   5,   5, 255,   6,   6,
+        255, 255, 255, 255,   2,   7,   3, 255,
+        255, 255, 255,   2, 255,   7, 255,   3,
+        255, 255,   2, 255, 255,   7, 255, 255,
+        255,   2, 255, 255, 255,   7, 255, 255
+    },
+    { // g5
+        255, 255, 255,   0, 255, 255,   4, 255,
+        255, 255, 255, 255,   0, 255,   4, 255,
+        255, 255, 255, 255, 255,   0,   4,   1,
+          5,   5,   5,   5,   5,   5, 255,   6,
+        255, 255, 255, 255, 255,   2,   7,   3,
+        255, 255, 255, 255,   2, 255,   7, 255,
+        255, 255, 255,   2, 255, 255,   7, 255,
+        255, 255,   2, 255, 255, 255,   7, 255
+    },
+    { // h5
+        255, 255, 255, 255,   0, 255, 255,   4,
+        255, 255, 255, 255, 255,   0, 255,   4,
+        255, 255, 255, 255, 255, 255,   0,   4,
+          5,   5,   5,   5,   5,   5,   5, 255,
+        255, 255, 255, 255, 255, 255,   2,   7,
+        255, 255, 255, 255, 255,   2, 255,   7,
+        255, 255, 255, 255,   2, 255, 255,   7,
+        255, 255, 255,   2, 255, 255, 255,   7
+    },
+    { // a4
+          4, 255, 255, 255,   1, 255, 255, 255,
+          4, 255, 255,   1, 255, 255, 255, 255,
+          4, 255,   1, 255, 255, 255, 255, 255,
+          4,   1, 255, 255, 255, 255, 255, 255,
+        255,   6,   6,   6,   6,   6,   6,   6,
+          7,   3, 255, 255, 255, 255, 255, 255,
+          7, 255,   3, 255, 255, 255, 255, 255,
+          7, 255, 255,   3, 255, 255, 255, 255
+    },
+    { // b4
+        255,   4, 255, 255, 255,   1, 255, 255,
+        255,   4, 255, 255,   1, 255, 255, 255,
+        255,   4, 255,   1, 255, 255, 255, 255,
+          0,   4,   1, 255, 255, 255, 255, 255,
+          5, 255,   6,   6,   6,   6,   6,   6,
+          2,   7,   3, 255, 255, 255, 255, 255,
+        255,   7, 255,   3, 255, 255, 255, 255,
+        255,   7, 255, 255,   3, 255, 255, 255
+    },
+    { // c4
+        255, 255,   4, 255, 255, 255,   1, 255,
+        255, 255,   4, 255, 255,   1, 255, 255,
+          0, 255,   4, 255,   1, 255, 255, 255,
+        255,   0,   4,   1, 255, 255, 255, 255,
+          5,   5, 255,   6,   6,   6,   6,   6,
+        255,   2,   7,   3, 255, 255, 255, 255,
+          2, 255,   7, 255,   3, 255, 255, 255,
+        255, 255,   7, 255, 255,   3, 255, 255
+    },
+    { // d4
+        255, 255, 255,   4, 255, 255, 255,   1,
+          0, 255, 255,   4, 255, 255,   1, 255,
+        255,   0, 255,   4, 255,   1, 255, 255,
+        255, 255,   0,   4,   1, 255, 255, 255,
+          5,   5,   5, 255,   6,   6,   6,   6,
+        255, 255,   2,   7,   3, 255, 255, 255,
+        255,   2, 255,   7, 255,   3, 255, 255,
+          2, 255, 255,   7, 255, 255,   3, 255
+    },
+    { // e4
+          0, 255, 255, 255,   4, 255, 255, 255,
+        255,   0, 255, 255,   4, 255, 255,   1,
+        255, 255,   0, 255,   4, 255,   1, 255,
+        255, 255, 255,   0,   4,   1, 255, 255,
+          5,   5,   5,   5, 255,   6,   6,   6,
+        255, 255, 255,   2,   7,   3, 255, 255,
+        255, 255,   2, 255,   7, 255,   3, 255,
+        255,   2, 255, 255,   7, 255, 255,   3
+    },
+    { // f4
+        255,   0, 255, 255, 255,   4, 255, 255,
+        255, 255,   0, 255, 255,   4, 255, 255,
+        255, 255, 255,   0, 255,   4, 255,   1,
+        255, 255, 255, 255,   0,   4,   1, 255,
+          5,   5,   5,   5,   5, 255,   6,   6,
+        255, 255, 255, 255,   2,   7,   3, 255,
+        255, 255, 255,   2, 255,   7, 255,   3,
+        255, 255,   2, 255, 255,   7, 255, 255
+    },
+    { // g4
+        255, 255,   0, 255, 255, 255,   4, 255,
+        255, 255, 255,   0, 255, 255,   4, 255,
+        255, 255, 255, 255,   0, 255,   4, 255,
+        255, 255, 255, 255, 255,   0,   4,   1,
+          5,   5,   5,   5,   5,   5, 255,   6,
+        255, 255, 255, 255, 255,   2,   7,   3,
+        255, 255, 255, 255,   2, 255,   7, 255,
+        255, 255, 255,   2, 255, 255,   7, 255
+    },
+    { // h4
+        255, 255, 255,   0, 255, 255, 255,   4,
+        255, 255, 255, 255,   0, 255, 255,   4,
+        255, 255, 255, 255, 255,   0, 255,   4,
+        255, 255, 255, 255, 255, 255,   0,   4,
+          5,   5,   5,   5,   5,   5,   5, 255,
+        255, 255, 255, 255, 255, 255,   2,   7,
+        255, 255, 255, 255, 255,   2, 255,   7,
+        255, 255, 255, 255,   2, 255, 255,   7
+    },
+    { // a3
+          4, 255, 255, 255, 255,   1, 255, 255,
+          4, 255, 255, 255,   1, 255, 255, 255,
+          4, 255, 255,   1, 255, 255, 255, 255,
+          4, 255,   1, 255, 255, 255, 255, 255,
+          4,   1, 255, 255, 255, 255, 255, 255,
+        255,   6,   6,   6,   6,   6,   6,   6,
+          7,   3, 255, 255, 255, 255, 255, 255,
+          7, 255,   3, 255, 255, 255, 255, 255
+    },
+    { // b3
+        255,   4, 255, 255, 255, 255,   1, 255,
+        255,   4, 255, 255, 255,   1, 255, 255,
+        255,   4, 255, 255,   1, 255, 255, 255,
+        255,   4, 255,   1, 255, 255, 255, 255,
+          0,   4,   1, 255, 255, 255, 255, 255,
+          5, 255,   6,   6,   6,   6,   6,   6,
+          2,   7,   3, 255, 255, 255, 255, 255,
+        255,   7, 255,   3, 255, 255, 255, 255
+    },
+    { // c3
+        255, 255,   4, 255, 255, 255, 255,   1,
+        255, 255,   4, 255, 255, 255,   1, 255,
+        255, 255,   4, 255, 255,   1, 255, 255,
+          0, 255,   4, 255,   1, 255, 255, 255,
+        255,   0,   4,   1, 255, 255, 255, 255,
+          5,   5, 255,   6,   6,   6,   6,   6,
+        255,   2,   7,   3, 255, 255, 255, 255,
+          2, 255,   7, 255,   3, 255, 255, 255
+    },
+    { // d3
+        255, 255, 255,   4, 255, 255, 255, 255,
+        255, 255, 255,   4, 255, 255, 255,   1,
+          0, 255, 255,   4, 255, 255,   1, 255,
+        255,   0, 255,   4, 255,   1, 255, 255,
+        255, 255,   0,   4,   1, 255, 255, 255,
+          5,   5,   5, 255,   6,   6,   6,   6,
+        255, 255,   2,   7,   3, 255, 255, 255,
+        255,   2, 255,   7, 255,   3, 255, 255
+    },
+    { // e3
+        255, 255, 255, 255,   4, 255, 255, 255,
+          0, 255, 255, 255,   4, 255, 255, 255,
+        255,   0, 255, 255,   4, 255, 255,   1,
+        255, 255,   0, 255,   4, 255,   1, 255,
+        255, 255, 255,   0,   4,   1, 255, 255,
+          5,   5,   5,   5, 255,   6,   6,   6,
+        255, 255, 255,   2,   7,   3, 255, 255,
+        255, 255,   2, 255,   7, 255,   3, 255
+    },
+    { // f3
+          0, 255, 255, 255, 255,   4, 255, 255,
+        255,   0, 255, 255, 255,   4, 255, 255,
+        255, 255,   0, 255, 255,   4, 255, 255,
+        255, 255, 255,   0, 255,   4, 255,   1,
+        255, 255, 255, 255,   0,   4,   1, 255,
+          5,   5,   5,   5,   5, 255,   6,   6,
+        255, 255, 255, 255,   2,   7,   3, 255,
+        255, 255, 255,   2, 255,   7, 255,   3
+    },
+    { // g3
+        255,   0, 255, 255, 255, 255,   4, 255,
+        255, 255,   0, 255, 255, 255,   4, 255,
+        255, 255, 255,   0, 255, 255,   4, 255,
+        255, 255, 255, 255,   0, 255,   4, 255,
+        255, 255, 255, 255, 255,   0,   4,   1,
+          5,   5,   5,   5,   5,   5, 255,   6,
+        255, 255, 255, 255, 255,   2,   7,   3,
+        255, 255, 255, 255,   2, 255,   7, 255
+    },
+    { // h3
+        255, 255,   0, 255, 255, 255, 255,   4,
+        255, 255, 255,   0, 255, 255, 255,   4,
+        255, 255, 255, 255,   0, 255, 255,   4,
+        255, 255, 255, 255, 255,   0, 255,   4,
+        255, 255, 255, 255, 255, 255,   0,   4,
+          5,   5,   5,   5,   5,   5,   5, 255,
+        255, 255, 255, 255, 255, 255,   2,   7,
+        255, 255, 255, 255, 255,   2, 255,   7
+    },
+    { // a2
+          4, 255, 255, 255, 255, 255,   1, 255,
+          4, 255, 255, 255, 255,   1, 255, 255,
+          4, 255, 255, 255,   1, 255, 255, 255,
+          4, 255, 255,   1, 255, 255, 255, 255,
+          4, 255,   1, 255, 255, 255, 255, 255,
+          4,   1, 255, 255, 255, 255, 255, 255,
+        255,   6,   6,   6,   6,   6,   6,   6,
+          7,   3, 255, 255, 255, 255, 255, 255
+    },
+    { // b2
+        255,   4, 255, 255, 255, 255, 255,   1,
+        255,   4, 255, 255, 255, 255,   1, 255,
+        255,   4, 255, 255, 255,   1, 255, 255,
+        255,   4, 255, 255,   1, 255, 255, 255,
+        255,   4, 255,   1, 255, 255, 255, 255,
+          0,   4,   1, 255, 255, 255, 255, 255,
+          5, 255,   6,   6,   6,   6,   6,   6,
+          2,   7,   3, 255, 255, 255, 255, 255
+    },
+    { // c2
+        255, 255,   4, 255, 255, 255, 255, 255,
+        255, 255,   4, 255, 255, 255, 255,   1,
+        255, 255,   4, 255, 255, 255,   1, 255,
+        255, 255,   4, 255, 255,   1, 255, 255,
+          0, 255,   4, 255,   1, 255, 255, 255,
+        255,   0,   4,   1, 255, 255, 255, 255,
+          5,   5, 255,   6,   6,   6,   6,   6,
+        255,   2,   7,   3, 255, 255, 255, 255
+    },
+    { // d2
+        255, 255, 255,   4, 255, 255, 255, 255,
+        255, 255, 255,   4, 255, 255, 255, 255,
+        255, 255, 255,   4, 255, 255, 255,   1,
+          0, 255, 255,   4, 255, 255,   1, 255,
+        255,   0, 255,   4, 255,   1, 255, 255,
+        255, 255,   0,   4,   1, 255, 255, 255,
+          5,   5,   5, 255,   6,   6,   6,   6,
+        255, 255,   2,   7,   3, 255, 255, 255
+    },
+    { // e2
+        255, 255, 255, 255,   4, 255, 255, 255,
+        255, 255, 255, 255,   4, 255, 255, 255,
+          0, 255, 255, 255,   4, 255, 255, 255,
+        255,   0, 255, 255,   4, 255, 255,   1,
+        255, 255,   0, 255,   4, 255,   1, 255,
+        255, 255, 255,   0,   4,   1, 255, 255,
+          5,   5,   5,   5, 255,   6,   6,   6,
+        255, 255, 255,   2,   7,   3, 255, 255
+    },
+    { // f2
+        255, 255, 255, 255, 255,   4, 255, 255,
+          0, 255, 255, 255, 255,   4, 255, 255,
+        255,   0, 255, 255, 255,   4, 255, 255,
+        255, 255,   0, 255, 255,   4, 255, 255,
+        255, 255, 255,   0, 255,   4, 255,   1,
+        255, 255, 255, 255,   0,   4,   1, 255,
+          5,   5,   5,   5,   5, 255,   6,   6,
+        255, 255, 255, 255,   2,   7,   3, 255
+    },
+    { // g2
+          0, 255, 255, 255, 255, 255,   4, 255,
+        255,   0, 255, 255, 255, 255,   4, 255,
+        255, 255,   0, 255, 255, 255,   4, 255,
+        255, 255, 255,   0, 255, 255,   4, 255,
+        255, 255, 255, 255,   0, 255,   4, 255,
+        255, 255, 255, 255, 255,   0,   4,   1,
+          5,   5,   5,   5,   5,   5, 255,   6,
+        255, 255, 255, 255, 255,   2,   7,   3
+    },
+    { // h2
+        255,   0, 255, 255, 255, 255, 255,   4,
+        255, 255,   0, 255, 255, 255, 255,   4,
+        255, 255, 255,   0, 255, 255, 255,   4,
+        255, 255, 255, 255,   0, 255, 255,   4,
+        255, 255, 255, 255, 255,   0, 255,   4,
+        255, 255, 255, 255, 255, 255,   0,   4,
+          5,   5,   5,   5,   5,   5,   5, 255,
+        255, 255, 255, 255, 255, 255,   2,   7
+    },
+    { // a1
+          4, 255, 255, 255, 255, 255, 255,   1,
+          4, 255, 255, 255, 255, 255,   1, 255,
+          4, 255, 255, 255, 255,   1, 255, 255,
+          4, 255, 255, 255,   1, 255, 255, 255,
+          4, 255, 255,   1, 255, 255, 255, 255,
+          4, 255,   1, 255, 255, 255, 255, 255,
+          4,   1, 255, 255, 255, 255, 255, 255,
+        255,   6,   6,   6,   6,   6,   6,   6
+    },
+    { // b1
+        255,   4, 255, 255, 255, 255, 255, 255,
+        255,   4, 255, 255, 255, 255, 255,   1,
+        255,   4, 255, 255, 255, 255,   1, 255,
+        255,   4, 255, 255, 255,   1, 255, 255,
+        255,   4, 255, 255,   1, 255, 255, 255,
+        255,   4, 255,   1, 255, 255, 255, 255,
+          0,   4,   1, 255, 255, 255, 255, 255,
+          5, 255,   6,   6,   6,   6,   6,   6
+    },
+    { // c1
+        255, 255,   4, 255, 255, 255, 255, 255,
+        255, 255,   4, 255, 255, 255, 255, 255,
+        255, 255,   4, 255, 255, 255, 255,   1,
+        255, 255,   4, 255, 255, 255,   1, 255,
+        255, 255,   4, 255, 255,   1, 255, 255,
+          0, 255,   4, 255,   1, 255, 255, 255,
+        255,   0,   4,   1, 255, 255, 255, 255,
+          5,   5, 255,   6,   6,   6,   6,   6
+    },
+    { // d1
+        255, 255, 255,   4, 255, 255, 255, 255,
+        255, 255, 255,   4, 255, 255, 255, 255,
+        255, 255, 255,   4, 255, 255, 255, 255,
+        255, 255, 255,   4, 255, 255, 255,   1,
+          0, 255, 255,   4, 255, 255,   1, 255,
+        255,   0, 255,   4, 255,   1, 255, 255,
+        255, 255,   0,   4,   1, 255, 255, 255,
+          5,   5,   5, 255,   6,   6,   6,   6
+    },
+    { // e1
+        255, 255, 255, 255,   4, 255, 255, 255,
+        255, 255, 255, 255,   4, 255, 255, 255,
+        255, 255, 255, 255,   4, 255, 255, 255,
+          0, 255, 255, 255,   4, 255, 255, 255,
+        255,   0, 255, 255,   4, 255, 255,   1,
+        255, 255,   0, 255,   4, 255,   1, 255,
+        255, 255, 255,   0,   4,   1, 255, 255,
+          5,   5,   5,   5, 255,   6,   6,   6
+    },
+    { // f1
+        255, 255, 255, 255, 255,   4, 255, 255,
+        255, 255, 255, 255, 255,   4, 255, 255,
+          0, 255, 255, 255, 255,   4, 255, 255,
+        255,   0, 255, 255, 255,   4, 255, 255,
+        255, 255,   0, 255, 255,   4, 255, 255,
+        255, 255, 255,   0, 255,   4, 255,   1,
+        255, 255, 255, 255,   0,   4,   1, 255,
+          5,   5,   5,   5,   5, 255,   6,   6
+    },
+    { // g1
+        255, 255, 255, 255, 255, 255,   4, 255,
+          0, 255, 255, 255, 255, 255,   4, 255,
+        255,   0, 255, 255, 255, 255,   4, 255,
+        255, 255,   0, 255, 255, 255,   4, 255,
+        255, 255, 255,   0, 255, 255,   4, 255,
+        255, 255, 255, 255,   0, 255,   4, 255,
+        255, 255, 255, 255, 255,   0,   4,   1,
+          5,   5,   5,   5,   5,   5, 255,   6
+    },
+    { // h1
+          0, 255, 255, 255, 255, 255, 255,   4,
+        255,   0, 255, 255, 255, 255, 255,   4,
+        255, 255,   0, 255, 255, 255, 255,   4,
+        255, 255, 255,   0, 255, 255, 255,   4,
+        255, 255, 255, 255,   0, 255, 255,   4,
+        255, 255, 255, 255, 255,   0, 255,   4,
+        255, 255, 255, 255, 255, 255,   0,   4,
+          5,   5,   5,   5,   5,   5,   5, 255
+    }
+};
+
+uint8_t const mt_chess_line_distance[8 * 8][8 * 8] = {
+    { // a8
+          0,   1,   2,   3,   4,   5,   6,   7,
+          1,   1,   2,   3,   4,   5,   6,   7,
+          2,   2,   2,   3,   4,   5,   6,   7,
+          3,   3,   3,   3,   4,   5,   6,   7,
+          4,   4,   4,   4,   4,   5,   6,   7,
+          5,   5,   5,   5,   5,   5,   6,   7,
+          6,   6,   6,   6,   6,   6,   6,   7,
+          7,   7,   7,   7,   7,   7,   7,   7
+    },
+    { // b8
+          1,   0,   1,   2,   3,   4,   5,   6,
+          1,   1,   1,   2,   3,   4,   5,   6,
+          2,   2,   2,   2,   3,   4,   5,   6,
+          3,   3,   3,   3,   3,   4,   5,   6,
+          4,   4,   4,   4,   4,   4,   5,   6,
+          5,   5,   5,   5,   5,   5,   5,   6,
+          6,   6,   6,   6,   6,   6,   6,   6,
+          7,   7,   7,   7,   7,   7,   7,   7
+    },
+    { // c8
+          2,   1,   0,   1,   2,   3,   4,   5,
+          2,   1,   1,   1,   2,   3,   4,   5,
+          2,   2,   2,   2,   2,   3,   4,   5,
+          3,   3,   3,   3,   3,   3,   4,   5,
+          4,   4,   4,   4,   4,   4,   4,   5,
+          5,   5,   5,   5,   5,   5,   5,   5,
+          6,   6,   6,   6,   6,   6,   6,   6,
+          7,   7,   7,   7,   7,   7,   7,   7
+    },
+    { // d8
+          3,   2,   1,   0,   1,   2,   3,   4,
+          3,   2,   1,   1,   1,   2,   3,   4,
+          3,   2,   2,   2,   2,   2,   3,   4,
+          3,   3,   3,   3,   3,   3,   3,   4,
+          4,   4,   4,   4,   4,   4,   4,   4,
+          5,   5,   5,   5,   5,   5,   5,   5,
+          6,   6,   6,   6,   6,   6,   6,   6,
+          7,   7,   7,   7,   7,   7,   7,   7
+    },
+    { // e8
+          4,   3,   2,   1,   0,   1,   2,   3,
+          4,   3,   2,   1,   1,   1,   2,   3,
+          4,   3,   2,   2,   2,   2,   2,   3,
+          4,   3,   3,   3,   3,   3,   3,   3,
+          4,   4,   4,   4,   4,   4,   4,   4,
+          5,   5,   5,   5,   5,   5,   5,   5,
+          6,   6,   6,   6,   6,   6,   6,   6,
+          7,   7,   7,   7,   7,   7,   7,   7
+    },
+    { // f8
+          5,   4,   3,   2,   1,   0,   1,   2,
+          5,   4,   3,   2,   1,   1,   1,   2,
+          5,   4,   3,   2,   2,   2,   2,   2,
+          5,   4,   3,   3,   3,   3,   3,   3,
+          5,   4,   4,   4,   4,   4,   4,   4,
+          5,   5,   5,   5,   5,   5,   5,   5,
+          6,   6,   6,   6,   6,   6,   6,   6,
+          7,   7,   7,   7,   7,   7,   7,   7
+    },
+    { // g8
+          6,   5,   4,   3,   2,   1,   0,   1,
+          6,   5,   4,   3,   2,   1,   1,   1,
+          6,   5,   4,   3,   2,   2,   2,   2,
+          6,   5,   4,   3,   3,   3,   3,   3,
+          6,   5,   4,   4,   4,   4,   4,   4,
+          6,   5,   5,   5,   5,   5,   5,   5,
+          6,   6,   6,   6,   6,   6,   6,   6,
+          7,   7,   7,   7,   7,   7,   7,   7
+    },
+    { // h8
+          7,   6,   5,   4,   3,   2,   1,   0,
+          7,   6,   5,   4,   3,   2,   1,   1,
+          7,   6,   5,   4,   3,   2,   2,   2,
+          7,   6,   5,   4,   3,   3,   3,   3,
+          7,   6,   5,   4,   4,   4,   4,   4,
+          7,   6,   5,   5,   5,   5,   5,   5,
+          7,   6,   6,   6,   6,   6,   6,   6,
+          7,   7,   7,   7,   7,   7,   7,   7
+    },
+    { // a7
+          1,   1,   2,   3,   4,   5,   6,   7,
+          0,   1,   2,   3,   4,   5,   6,   7,
+          1,   1,   2,   3,   4,   5,   6,   7,
+          2,   2,   2,   3,   4,   5,   6,   7,
+          3,   3,   3,   3,   4,   5,   6,   7,
+          4,   4,   4,   4,   4,   5,   6,   7,
+          5,   5,   5,   5,   5,   5,   6,   7,
+          6,   6,   6,   6,   6,   6,   6,   7
+    },
+    { // b7
+          1,   1,   1,   2,   3,   4,   5,   6,
+          1,   0,   1,   2,   3,   4,   5,   6,
+          1,   1,   1,   2,   3,   4,   5,   6,
+          2,   2,   2,   2,   3,   4,   5,   6,
+          3,   3,   3,   3,   3,   4,   5,   6,
+          4,   4,   4,   4,   4,   4,   5,   6,
+          5,   5,   5,   5,   5,   5,   5,   6,
+          6,   6,   6,   6,   6,   6,   6,   6
+    },
+    { // c7
+          2,   1,   1,   1,   2,   3,   4,   5,
+          2,   1,   0,   1,   2,   3,   4,   5,
+          2,   1,   1,   1,   2,   3,   4,   5,
+          2,   2,   2,   2,   2,   3,   4,   5,
+          3,   3,   3,   3,   3,   3,   4,   5,
+          4,   4,   4,   4,   4,   4,   4,   5,
+          5,   5,   5,   5,   5,   5,   5,   5,
+          6,   6,   6,   6,   6,   6,   6,   6
+    },
+    { // d7
+          3,   2,   1,   1,   1,   2,   3,   4,
+          3,   2,   1,   0,   1,   2,   3,   4,
+          3,   2,   1,   1,   1,   2,   3,   4,
+          3,   2,   2,   2,   2,   2,   3,   4,
+          3,   3,   3,   3,   3,   3,   3,   4,
+          4,   4,   4,   4,   4,   4,   4,   4,
+          5,   5,   5,   5,   5,   5,   5,   5,
+          6,   6,   6,   6,   6,   6,   6,   6
+    },
+    { // e7
+          4,   3,   2,   1,   1,   1,   2,   3,
+          4,   3,   2,   1,   0,   1,   2,   3,
+          4,   3,   2,   1,   1,   1,   2,   3,
+          4,   3,   2,   2,   2,   2,   2,   3,
+          4,   3,   3,   3,   3,   3,   3,   3,
+          4,   4,   4,   4,   4,   4,   4,   4,
+          5,   5,   5,   5,   5,   5,   5,   5,
+          6,   6,   6,   6,   6,   6,   6,   6
+    },
+    { // f7
+          5,   4,   3,   2,   1,   1,   1,   2,
+          5,   4,   3,   2,   1,   0,   1,   2,
+          5,   4,   3,   2,   1,   1,   1,   2,
+          5,   4,   3,   2,   2,   2,   2,   2,
+          5,   4,   3,   3,   3,   3,   3,   3,
+          5,   4,   4,   4,   4,   4,   4,   4,
+          5,   5,   5,   5,   5,   5,   5,   5,
+          6,   6,   6,   6,   6,   6,   6,   6
+    },
+    { // g7
+          6,   5,   4,   3,   2,   1,   1,   1,
+          6,   5,   4,   3,   2,   1,   0,   1,
+          6,   5,   4,   3,   2,   1,   1,   1,
+          6,   5,   4,   3,   2,   2,   2,   2,
+          6,   5,   4,   3,   3,   3,   3,   3,
+          6,   5,   4,   4,   4,   4,   4,   4,
+          6,   5,   5,   5,   5,   5,   5,   5,
+          6,   6,   6,   6,   6,   6,   6,   6
+    },
+    { // h7
+          7,   6,   5,   4,   3,   2,   1,   1,
+          7,   6,   5,   4,   3,   2,   1,   0,
+          7,   6,   5,   4,   3,   2,   1,   1,
+          7,   6,   5,   4,   3,   2,   2,   2,
+          7,   6,   5,   4,   3,   3,   3,   3,
+          7,   6,   5,   4,   4,   4,   4,   4,
+          7,   6,   5,   5,   5,   5,   5,   5,
+          7,   6,   6,   6,   6,   6,   6,   6
+    },
+    { // a6
+          2,   2,   2,   3,   4,   5,   6,   7,
+          1,   1,   2,   3,   4,   5,   6,   7,
+          0,   1,   2,   3,   4,   5,   6,   7,
+          1,   1,   2,   3,   4,   5,   6,   7,
+          2,   2,   2,   3,   4,   5,   6,   7,
+          3,   3,   3,   3,   4,   5,   6,   7,
+          4,   4,   4,   4,   4,   5,   6,   7,
+          5,   5,   5,   5,   5,   5,   6,   7
+    },
+    { // b6
+          2,   2,   2,   2,   3,   4,   5,   6,
+          1,   1,   1,   2,   3,   4,   5,   6,
+          1,   0,   1,   2,   3,   4,   5,   6,
+          1,   1,   1,   2,   3,   4,   5,   6,
+          2,   2,   2,   2,   3,   4,   5,   6,
+          3,   3,   3,   3,   3,   4,   5,   6,
+          4,   4,   4,   4,   4,   4,   5,   6,
+          5,   5,   5,   5,   5,   5,   5,   6
+    },
+    { // c6
+          2,   2,   2,   2,   2,   3,   4,   5,
+          2,   1,   1,   1,   2,   3,   4,   5,
+          2,   1,   0,   1,   2,   3,   4,   5,
+          2,   1,   1,   1,   2,   3,   4,   5,
+          2,   2,   2,   2,   2,   3,   4,   5,
+          3,   3,   3,   3,   3,   3,   4,   5,
+          4,   4,   4,   4,   4,   4,   4,   5,
+          5,   5,   5,   5,   5,   5,   5,   5
+    },
+    { // d6
+          3,   2,   2,   2,   2,   2,   3,   4,
+          3,   2,   1,   1,   1,   2,   3,   4,
+          3,   2,   1,   0,   1,   2,   3,   4,
+          3,   2,   1,   1,   1,   2,   3,   4,
+          3,   2,   2,   2,   2,   2,   3,   4,
+          3,   3,   3,   3,   3,   3,   3,   4,
+          4,   4,   4,   4,   4,   4,   4,   4,
+          5,   5,   5,   5,   5,   5,   5,   5
+    },
+    { // e6
+          4,   3,   2,   2,   2,   2,   2,   3,
+          4,   3,   2,   1,   1,   1,   2,   3,
+          4,   3,   2,   1,   0,   1,   2,   3,
+          4,   3,   2,   1,   1,   1,   2,   3,
+          4,   3,   2,   2,   2,   2,   2,   3,
+          4,   3,   3,   3,   3,   3,   3,   3,
+          4,   4,   4,   4,   4,   4,   4,   4,
+          5,   5,   5,   5,   5,   5,   5,   5
+    },
+    { // f6
+          5,   4,   3,   2,   2,   2,   2,   2,
+          5,   4,   3,   2,   1,   1,   1,   2,
+          5,   4,   3,   2,   1,   0,   1,   2,
+          5,   4,   3,   2,   1,   1,   1,   2,
+          5,   4,   3,   2,   2,   2,   2,   2,
+          5,   4,   3,   3,   3,   3,   3,   3,
+          5,   4,   4,   4,   4,   4,   4,   4,
+          5,   5,   5,   5,   5,   5,   5,   5
+    },
+    { // g6
+          6,   5,   4,   3,   2,   2,   2,   2,
+          6,   5,   4,   3,   2,   1,   1,   1,
+          6,   5,   4,   3,   2,   1,   0,   1,
+          6,   5,   4,   3,   2,   1,   1,   1,
+          6,   5,   4,   3,   2,   2,   2,   2,
+          6,   5,   4,   3,   3,   3,   3,   3,
+          6,   5,   4,   4,   4,   4,   4,   4,
+          6,   5,   5,   5,   5,   5,   5,   5
+    },
+    { // h6
+          7,   6,   5,   4,   3,   2,   2,   2,
+          7,   6,   5,   4,   3,   2,   1,   1,
+          7,   6,   5,   4,   3,   2,   1,   0,
+          7,   6,   5,   4,   3,   2,   1,   1,
+          7,   6,   5,   4,   3,   2,   2,   2,
+          7,   6,   5,   4,   3,   3,   3,   3,
+          7,   6,   5,   4,   4,   4,   4,   4,
+          7,   6,   5,   5,   5,   5,   5,   5
+    },
+    { // a5
+          3,   3,   3,   3,   4,   5,   6,   7,
+          2,   2,   2,   3,   4,   5,   6,   7,
+          1,   1,   2,   3,   4,   5,   6,   7,
+          0,   1,   2,   3,   4,   5,   6,   7,
+          1,   1,   2,   3,   4,   5,   6,   7,
+          2,   2,   2,   3,   4,   5,   6,   7,
+          3,   3,   3,   3,   4,   5,   6,   7,
+          4,   4,   4,   4,   4,   5,   6,   7
+    },
+    { // b5
+          3,   3,   3,   3,   3,   4,   5,   6,
+          2,   2,   2,   2,   3,   4,   5,   6,
+          1,   1,   1,   2,   3,   4,   5,   6,
+          1,   0,   1,   2,   3,   4,   5,   6,
+          1,   1,   1,   2,   3,   4,   5,   6,
+          2,   2,   2,   2,   3,   4,   5,   6,
+          3,   3,   3,   3,   3,   4,   5,   6,
+          4,   4,   4,   4,   4,   4,   5,   6
+    },
+    { // c5
+          3,   3,   3,   3,   3,   3,   4,   5,
+          2,   2,   2,   2,   2,   3,   4,   5,
+          2,   1,   1,   1,   2,   3,   4,   5,
+          2,   1,   0,   1,   2,   3,   4,   5,
+          2,   1,   1,   1,   2,   3,   4,   5,
+          2,   2,   2,   2,   2,   3,   4,   5,
+          3,   3,   3,   3,   3,   3,   4,   5,
+          4,   4,   4,   4,   4,   4,   4,   5
+    },
+    { // d5
+          3,   3,   3,   3,   3,   3,   3,   4,
+          3,   2,   2,   2,   2,   2,   3,   4,
+          3,   2,   1,   1,   1,   2,   3,   4,
+          3,   2,   1,   0,   1,   2,   3,   4,
+          3,   2,   1,   1,   1,   2,   3,   4,
+          3,   2,   2,   2,   2,   2,   3,   4,
+          3,   3,   3,   3,   3,   3,   3,   4,
+          4,   4,   4,   4,   4,   4,   4,   4
+    },
+    { // e5
+          4,   3,   3,   3,   3,   3,   3,   3,
+          4,   3,   2,   2,   2,   2,   2,   3,
+          4,   3,   2,   1,   1,   1,   2,   3,
+          4,   3,   2,   1,   0,   1,   2,   3,
+          4,   3,   2,   1,   1,   1,   2,   3,
+          4,   3,   2,   2,   2,   2,   2,   3,
+          4,   3,   3,   3,   3,   3,   3,   3,
+          4,   4,   4,   4,   4,   4,   4,   4
+    },
+    { // f5
+          5,   4,   3,   3,   3,   3,   3,   3,
+          5,   4,   3,   2,   2,   2,   2,   2,
+          5,   4,   3,   2,   1,   1,   1,   2,
+          5,   4,   3,   2,   1,   0,   1,   2,
+          5,   4,   3,   2,   1,   1,   1,   2,
+          5,   4,   3,   2,   2,   2,   2,   2,
+          5,   4,   3,   3,   3,   3,   3,   3,
+          5,   4,   4,   4,   4,   4,   4,   4
+    },
+    { // g5
+          6,   5,   4,   3,   3,   3,   3,   3,
+          6,   5,   4,   3,   2,   2,   2,   2,
+          6,   5,   4,   3,   2,   1,   1,   1,
+          6,   5,   4,   3,   2,   1,   0,   1,
+          6,   5,   4,   3,   2,   1,   1,   1,
+          6,   5,   4,   3,   2,   2,   2,   2,
+          6,   5,   4,   3,   3,   3,   3,   3,
+          6,   5,   4,   4,   4,   4,   4,   4
+    },
+    { // h5
+          7,   6,   5,   4,   3,   3,   3,   3,
+          7,   6,   5,   4,   3,   2,   2,   2,
+          7,   6,   5,   4,   3,   2,   1,   1,
+          7,   6,   5,   4,   3,   2,   1,   0,
+          7,   6,   5,   4,   3,   2,   1,   1,
+          7,   6,   5,   4,   3,   2,   2,   2,
+          7,   6,   5,   4,   3,   3,   3,   3,
+          7,   6,   5,   4,   4,   4,   4,   4
+    },
+    { // a4
+          4,   4,   4,   4,   4,   5,   6,   7,
+          3,   3,   3,   3,   4,   5,   6,   7,
+          2,   2,   2,   3,   4,   5,   6,   7,
+          1,   1,   2,   3,   4,   5,   6,   7,
+          0,   1,   2,   3,   4,   5,   6,   7,
+          1,   1,   2,   3,   4,   5,   6,   7,
+          2,   2,   2,   3,   4,   5,   6,   7,
+          3,   3,   3,   3,   4,   5,   6,   7
+    },
+    { // b4
+          4,   4,   4,   4,   4,   4,   5,   6,
+          3,   3,   3,   3,   3,   4,   5,   6,
+          2,   2,   2,   2,   3,   4,   5,   6,
+          1,   1,   1,   2,   3,   4,   5,   6,
+          1,   0,   1,   2,   3,   4,   5,   6,
+          1,   1,   1,   2,   3,   4,   5,   6,
+          2,   2,   2,   2,   3,   4,   5,   6,
+          3,   3,   3,   3,   3,   4,   5,   6
+    },
+    { // c4
+          4,   4,   4,   4,   4,   4,   4,   5,
+          3,   3,   3,   3,   3,   3,   4,   5,
+          2,   2,   2,   2,   2,   3,   4,   5,
+          2,   1,   1,   1,   2,   3,   4,   5,
+          2,   1,   0,   1,   2,   3,   4,   5,
+          2,   1,   1,   1,   2,   3,   4,   5,
+          2,   2,   2,   2,   2,   3,   4,   5,
+          3,   3,   3,   3,   3,   3,   4,   5
+    },
+    { // d4
+          4,   4,   4,   4,   4,   4,   4,   4,
+          3,   3,   3,   3,   3,   3,   3,   4,
+          3,   2,   2,   2,   2,   2,   3,   4,
+          3,   2,   1,   1,   1,   2,   3,   4,
+          3,   2,   1,   0,   1,   2,   3,   4,
+          3,   2,   1,   1,   1,   2,   3,   4,
+          3,   2,   2,   2,   2,   2,   3,   4,
+          3,   3,   3,   3,   3,   3,   3,   4
+    },
+    { // e4
+          4,   4,   4,   4,   4,   4,   4,   4,
+          4,   3,   3,   3,   3,   3,   3,   3,
+          4,   3,   2,   2,   2,   2,   2,   3,
+          4,   3,   2,   1,   1,   1,   2,   3,
+          4,   3,   2,   1,   0,   1,   2,   3,
+          4,   3,   2,   1,   1,   1,   2,   3,
+          4,   3,   2,   2,   2,   2,   2,   3,
+          4,   3,   3,   3,   3,   3,   3,   3
+    },
+    { // f4
+          5,   4,   4,   4,   4,   4,   4,   4,
+          5,   4,   3,   3,   3,   3,   3,   3,
+          5,   4,   3,   2,   2,   2,   2,   2,
+          5,   4,   3,   2,   1,   1,   1,   2,
+          5,   4,   3,   2,   1,   0,   1,   2,
+          5,   4,   3,   2,   1,   1,   1,   2,
+          5,   4,   3,   2,   2,   2,   2,   2,
+          5,   4,   3,   3,   3,   3,   3,   3
+    },
+    { // g4
+          6,   5,   4,   4,   4,   4,   4,   4,
+          6,   5,   4,   3,   3,   3,   3,   3,
+          6,   5,   4,   3,   2,   2,   2,   2,
+          6,   5,   4,   3,   2,   1,   1,   1,
+          6,   5,   4,   3,   2,   1,   0,   1,
+          6,   5,   4,   3,   2,   1,   1,   1,
+          6,   5,   4,   3,   2,   2,   2,   2,
+          6,   5,   4,   3,   3,   3,   3,   3
+    },
+    { // h4
+          7,   6,   5,   4,   4,   4,   4,   4,
+          7,   6,   5,   4,   3,   3,   3,   3,
+          7,   6,   5,   4,   3,   2,   2,   2,
+          7,   6,   5,   4,   3,   2,   1,   1,
+          7,   6,   5,   4,   3,   2,   1,   0,
+          7,   6,   5,   4,   3,   2,   1,   1,
+          7,   6,   5,   4,   3,   2,   2,   2,
+          7,   6,   5,   4,   3,   3,   3,   3
+    },
+    { // a3
+          5,   5,   5,   5,   5,   5,   6,   7,
+          4,   4,   4,   4,   4,   5,   6,   7,
+          3,   3,   3,   3,   4,   5,   6,   7,
+          2,   2,   2,   3,   4,   5,   6,   7,
+          1,   1,   2,   3,   4,   5,   6,   7,
+          0,   1,   2,   3,   4,   5,   6,   7,
+          1,   1,   2,   3,   4,   5,   6,   7,
+          2,   2,   2,   3,   4,   5,   6,   7
+    },
+    { // b3
+          5,   5,   5,   5,   5,   5,   5,   6,
+          4,   4,   4,   4,   4,   4,   5,   6,
+          3,   3,   3,   3,   3,   4,   5,   6,
+          2,   2,   2,   2,   3,   4,   5,   6,
+          1,   1,   1,   2,   3,   4,   5,   6,
+          1,   0,   1,   2,   3,   4,   5,   6,
+          1,   1,   1,   2,   3,   4,   5,   6,
+          2,   2,   2,   2,   3,   4,   5,   6
+    },
+    { // c3
+          5,   5,   5,   5,   5,   5,   5,   5,
+          4,   4,   4,   4,   4,   4,   4,   5,
+          3,   3,   3,   3,   3,   3,   4,   5,
+          2,   2,   2,   2,   2,   3,   4,   5,
+          2,   1,   1,   1,   2,   3,   4,   5,
+          2,   1,   0,   1,   2,   3,   4,   5,
+          2,   1,   1,   1,   2,   3,   4,   5,
+          2,   2,   2,   2,   2,   3,   4,   5
+    },
+    { // d3
+          5,   5,   5,   5,   5,   5,   5,   5,
+          4,   4,   4,   4,   4,   4,   4,   4,
+          3,   3,   3,   3,   3,   3,   3,   4,
+          3,   2,   2,   2,   2,   2,   3,   4,
+          3,   2,   1,   1,   1,   2,   3,   4,
+          3,   2,   1,   0,   1,   2,   3,   4,
+          3,   2,   1,   1,   1,   2,   3,   4,
+          3,   2,   2,   2,   2,   2,   3,   4
+    },
+    { // e3
+          5,   5,   5,   5,   5,   5,   5,   5,
+          4,   4,   4,   4,   4,   4,   4,   4,
+          4,   3,   3,   3,   3,   3,   3,   3,
+          4,   3,   2,   2,   2,   2,   2,   3,
+          4,   3,   2,   1,   1,   1,   2,   3,
+          4,   3,   2,   1,   0,   1,   2,   3,
+          4,   3,   2,   1,   1,   1,   2,   3,
+          4,   3,   2,   2,   2,   2,   2,   3
+    },
+    { // f3
+          5,   5,   5,   5,   5,   5,   5,   5,
+          5,   4,   4,   4,   4,   4,   4,   4,
+          5,   4,   3,   3,   3,   3,   3,   3,
+          5,   4,   3,   2,   2,   2,   2,   2,
+          5,   4,   3,   2,   1,   1,   1,   2,
+          5,   4,   3,   2,   1,   0,   1,   2,
+          5,   4,   3,   2,   1,   1,   1,   2,
+          5,   4,   3,   2,   2,   2,   2,   2
+    },
+    { // g3
+          6,   5,   5,   5,   5,   5,   5,   5,
+          6,   5,   4,   4,   4,   4,   4,   4,
+          6,   5,   4,   3,   3,   3,   3,   3,
+          6,   5,   4,   3,   2,   2,   2,   2,
+          6,   5,   4,   3,   2,   1,   1,   1,
+          6,   5,   4,   3,   2,   1,   0,   1,
+          6,   5,   4,   3,   2,   1,   1,   1,
+          6,   5,   4,   3,   2,   2,   2,   2
+    },
+    { // h3
+          7,   6,   5,   5,   5,   5,   5,   5,
+          7,   6,   5,   4,   4,   4,   4,   4,
+          7,   6,   5,   4,   3,   3,   3,   3,
+          7,   6,   5,   4,   3,   2,   2,   2,
+          7,   6,   5,   4,   3,   2,   1,   1,
+          7,   6,   5,   4,   3,   2,   1,   0,
+          7,   6,   5,   4,   3,   2,   1,   1,
+          7,   6,   5,   4,   3,   2,   2,   2
+    },
+    { // a2
+          6,   6,   6,   6,   6,   6,   6,   7,
+          5,   5,   5,   5,   5,   5,   6,   7,
+          4,   4,   4,   4,   4,   5,   6,   7,
+          3,   3,   3,   3,   4,   5,   6,   7,
+          2,   2,   2,   3,   4,   5,   6,   7,
+          1,   1,   2,   3,   4,   5,   6,   7,
+          0,   1,   2,   3,   4,   5,   6,   7,
+          1,   1,   2,   3,   4,   5,   6,   7
+    },
+    { // b2
+          6,   6,   6,   6,   6,   6,   6,   6,
+          5,   5,   5,   5,   5,   5,   5,   6,
+          4,   4,   4,   4,   4,   4,   5,   6,
+          3,   3,   3,   3,   3,   4,   5,   6,
+          2,   2,   2,   2,   3,   4,   5,   6,
+          1,   1,   1,   2,   3,   4,   5,   6,
+          1,   0,   1,   2,   3,   4,   5,   6,
+          1,   1,   1,   2,   3,   4,   5,   6
+    },
+    { // c2
+          6,   6,   6,   6,   6,   6,   6,   6,
+          5,   5,   5,   5,   5,   5,   5,   5,
+          4,   4,   4,   4,   4,   4,   4,   5,
+          3,   3,   3,   3,   3,   3,   4,   5,
+          2,   2,   2,   2,   2,   3,   4,   5,
+          2,   1,   1,   1,   2,   3,   4,   5,
+          2,   1,   0,   1,   2,   3,   4,   5,
+          2,   1,   1,   1,   2,   3,   4,   5
+    },
+    { // d2
+          6,   6,   6,   6,   6,   6,   6,   6,
+          5,   5,   5,   5,   5,   5,   5,   5,
+          4,   4,   4,   4,   4,   4,   4,   4,
+          3,   3,   3,   3,   3,   3,   3,   4,
+          3,   2,   2,   2,   2,   2,   3,   4,
+          3,   2,   1,   1,   1,   2,   3,   4,
+          3,   2,   1,   0,   1,   2,   3,   4,
+          3,   2,   1,   1,   1,   2,   3,   4
+    },
+    { // e2
+          6,   6,   6,   6,   6,   6,   6,   6,
+          5,   5,   5,   5,   5,   5,   5,   5,
+          4,   4,   4,   4,   4,   4,   4,   4,
+          4,   3,   3,   3,   3,   3,   3,   3,
+          4,   3,   2,   2,   2,   2,   2,   3,
+          4,   3,   2,   1,   1,   1,   2,   3,
+          4,   3,   2,   1,   0,   1,   2,   3,
+          4,   3,   2,   1,   1,   1,   2,   3
+    },
+    { // f2
+          6,   6,   6,   6,   6,   6,   6,   6,
+          5,   5,   5,   5,   5,   5,   5,   5,
+          5,   4,   4,   4,   4,   4,   4,   4,
+          5,   4,   3,   3,   3,   3,   3,   3,
+          5,   4,   3,   2,   2,   2,   2,   2,
+          5,   4,   3,   2,   1,   1,   1,   2,
+          5,   4,   3,   2,   1,   0,   1,   2,
+          5,   4,   3,   2,   1,   1,   1,   2
+    },
+    { // g2
+          6,   6,   6,   6,   6,   6,   6,   6,
+          6,   5,   5,   5,   5,   5,   5,   5,
+          6,   5,   4,   4,   4,   4,   4,   4,
+          6,   5,   4,   3,   3,   3,   3,   3,
+          6,   5,   4,   3,   2,   2,   2,   2,
+          6,   5,   4,   3,   2,   1,   1,   1,
+          6,   5,   4,   3,   2,   1,   0,   1,
+          6,   5,   4,   3,   2,   1,   1,   1
+    },
+    { // h2
+          7,   6,   6,   6,   6,   6,   6,   6,
+          7,   6,   5,   5,   5,   5,   5,   5,
+          7,   6,   5,   4,   4,   4,   4,   4,
+          7,   6,   5,   4,   3,   3,   3,   3,
+          7,   6,   5,   4,   3,   2,   2,   2,
+          7,   6,   5,   4,   3,   2,   1,   1,
+          7,   6,   5,   4,   3,   2,   1,   0,
+          7,   6,   5,   4,   3,   2,   1,   1
+    },
+    { // a1
+          7,   7,   7,   7,   7,   7,   7,   7,
+          6,   6,   6,   6,   6,   6,   6,   7,
+          5,   5,   5,   5,   5,   5,   6,   7,
+          4,   4,   4,   4,   4,   5,   6,   7,
+          3,   3,   3,   3,   4,   5,   6,   7,
+          2,   2,   2,   3,   4,   5,   6,   7,
+          1,   1,   2,   3,   4,   5,   6,   7,
+          0,   1,   2,   3,   4,   5,   6,   7
+    },
+    { // b1
+          7,   7,   7,   7,   7,   7,   7,   7,
+          6,   6,   6,   6,   6,   6,   6,   6,
+          5,   5,   5,   5,   5,   5,   5,   6,
+          4,   4,   4,   4,   4,   4,   5,   6,
+          3,   3,   3,   3,   3,   4,   5,   6,
+          2,   2,   2,   2,   3,   4,   5,   6,
+          1,   1,   1,   2,   3,   4,   5,   6,
+          1,   0,   1,   2,   3,   4,   5,   6
+    },
+    { // c1
+          7,   7,   7,   7,   7,   7,   7,   7,
+          6,   6,   6,   6,   6,   6,   6,   6,
+          5,   5,   5,   5,   5,   5,   5,   5,
+          4,   4,   4,   4,   4,   4,   4,   5,
+          3,   3,   3,   3,   3,   3,   4,   5,
+          2,   2,   2,   2,   2,   3,   4,   5,
+          2,   1,   1,   1,   2,   3,   4,   5,
+          2,   1,   0,   1,   2,   3,   4,   5
+    },
+    { // d1
+          7,   7,   7,   7,   7,   7,   7,   7,
+          6,   6,   6,   6,   6,   6,   6,   6,
+          5,   5,   5,   5,   5,   5,   5,   5,
+          4,   4,   4,   4,   4,   4,   4,   4,
+          3,   3,   3,   3,   3,   3,   3,   4,
+          3,   2,   2,   2,   2,   2,   3,   4,
+          3,   2,   1,   1,   1,   2,   3,   4,
+          3,   2,   1,   0,   1,   2,   3,   4
+    },
+    { // e1
+          7,   7,   7,   7,   7,   7,   7,   7,
+          6,   6,   6,   6,   6,   6,   6,   6,
+          5,   5,   5,   5,   5,   5,   5,   5,
+          4,   4,   4,   4,   4,   4,   4,   4,
+          4,   3,   3,   3,   3,   3,   3,   3,
+          4,   3,   2,   2,   2,   2,   2,   3,
+          4,   3,   2,   1,   1,   1,   2,   3,
+          4,   3,   2,   1,   0,   1,   2,   3
+    },
+    { // f1
+          7,   7,   7,   7,   7,   7,   7,   7,
+          6,   6,   6,   6,   6,   6,   6,   6,
+          5,   5,   5,   5,   5,   5,   5,   5,
+          5,   4,   4,   4,   4,   4,   4,   4,
+          5,   4,   3,   3,   3,   3,   3,   3,
+          5,   4,   3,   2,   2,   2,   2,   2,
+          5,   4,   3,   2,   1,   1,   1,   2,
+          5,   4,   3,   2,   1,   0,   1,   2
+    },
+    { // g1
+          7,   7,   7,   7,   7,   7,   7,   7,
+          6,   6,   6,   6,   6,   6,   6,   6,
+          6,   5,   5,   5,   5,   5,   5,   5,
+          6,   5,   4,   4,   4,   4,   4,   4,
+          6,   5,   4,   3,   3,   3,   3,   3,
+          6,   5,   4,   3,   2,   2,   2,   2,
+          6,   5,   4,   3,   2,   1,   1,   1,
+          6,   5,   4,   3,   2,   1,   0,   1
+    },
+    { // h1
+          7,   7,   7,   7,   7,   7,   7,   7,
+          7,   6,   6,   6,   6,   6,   6,   6,
+          7,   6,   5,   5,   5,   5,   5,   5,
+          7,   6,   5,   4,   4,   4,   4,   4,
+          7,   6,   5,   4,   3,   3,   3,   3,
+          7,   6,   5,   4,   3,   2,   2,   2,
+          7,   6,   5,   4,   3,   2,   1,   1,
+          7,   6,   5,   4,   3,   2,   1,   0
+    }
+};
@@ -2,51 +2,14 @@
 // Marcel Timm, RhinoDevel, 2025dec21
 
 #ifdef __cplusplus
-    #include <cstdlib>
-    #include <cassert>
-    #include <cstdbool>
+    #include <cstddef>
 #else //__cplusplus
-    #include <stdlib.h>
-    #include <assert.h>
-    #include <stdbool.h>
+    #include <stddef.h>
 #endif //__cplusplus
 
 #include "mt_chess_log_node.h"
 #include "mt_chess_move.h"
 
-void mt_chess_log_node_free(struct mt_chess_log_node * const node)
-{
-    if(node == NULL)
-    {
-        assert(false); // Although no problem (here).
-        return;
-    }
-    
-    //assert(node->last == NULL); // Although no problem (here).
-    
-    struct mt_chess_log_node * const next = node->next;
-    
-    free(node);
-    if(next != NULL)
-    {
-        mt_chess_log_node_free(next); // *** RECURSION ***
-    }
-}
-
-struct mt_chess_log_node * mt_chess_log_node_create(void)
-{
-    struct mt_chess_log_node * const ret_val =
-        (struct mt_chess_log_node *)malloc(sizeof *ret_val);
-        
-    assert(ret_val != NULL);
-    
-    ret_val->last = NULL;
-    mt_chess_move_invalidate(&ret_val->move);
-    ret_val->next = NULL;
-    
-    return ret_val;
-}
-
 struct mt_chess_log_node * mt_chess_log_node_get_latest(
     struct mt_chess_log_node * const node)
 {
@@ -63,25 +26,3 @@ struct mt_chess_log_node * mt_chess_log_node_get_latest(
     }
     return ret_val;
 }
-
-struct mt_chess_log_node * mt_chess_log_node_get_latest_of_piece(
-    struct mt_chess_log_node * const node, uint8_t const piece_id)
-{
-    assert(0 <= piece_id && piece_id < 2 * 2 * 8);
-
-    struct mt_chess_log_node * const latest =
-        mt_chess_log_node_get_latest(node);
-
-    struct mt_chess_log_node * ret_val = NULL;
-
-    ret_val = latest;
-    while(ret_val != NULL)
-    {
-        if(ret_val->move.piece.id == piece_id)
-        {
-            break; // Found
-        }
-        ret_val = ret_val->last;
-    }
-    return ret_val;
-}
@@ -11,33 +11,24 @@
 #endif //__cplusplus
 
 #include "mt_chess_move.h"
+#include "mt_chess_data.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif //__cplusplus
 
+/**
+ * - Nodes are owned by the log pool of the game (see mt_chess_log_pool.h).
+ */
 struct mt_chess_log_node
 {
     struct mt_chess_log_node * last;
-    
-    struct mt_chess_move move;
-    
     struct mt_chess_log_node * next;
-};
 
-/**
- * - Will take ownership of given object (pointer will be invalid after call)
- *   and all following(!) nodes.
- * - Does NOT care about eventually referenced last node.
- * - (Currently) recursive.
- */
-void mt_chess_log_node_free(struct mt_chess_log_node * const node);
+    struct mt_chess_data_undo undo; // To take back the move.
 
-/**
- * - Caller takes ownership of returned node.
- * - Return value must be freed after use with mt_chess_log_node_free().
- */
-struct mt_chess_log_node * mt_chess_log_node_create(void);
+    uint16_t move; // Packed (see mt_chess_move.h).
+};
 
 /**
  * - Returns NULL, if NULL given.
@@ -45,13 +36,6 @@ struct mt_chess_log_node * mt_chess_log_node_create(void);
 struct mt_chess_log_node * mt_chess_log_node_get_latest(
     struct mt_chess_log_node * const node);
 
-/**
- * - Returns NULL, if NULL given.
- * - Returns NULL, if piece with given ID did not move, yet.
- */
-struct mt_chess_log_node * mt_chess_log_node_get_latest_of_piece(
-    struct mt_chess_log_node * const node, uint8_t const piece_id);
-
 #ifdef __cplusplus
 }
 #endif //__cplusplus
@@ -0,0 +1,93 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstddef>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stddef.h>
+#endif //__cplusplus
+
+#include "mt_chess_log_pool.h"
+#include "mt_chess_log_node.h"
+#include "mt_chess_mem.h"
+
+static struct mt_chess_log_pool_chunk * create_chunk(void)
+{
+    struct mt_chess_log_pool_chunk * const ret_val =
+        (struct mt_chess_log_pool_chunk *)mt_chess_mem_alloc(
+            sizeof *ret_val);
+
+    ret_val->next = NULL;
+    return ret_val;
+}
+
+void mt_chess_log_pool_init(struct mt_chess_log_pool * const pool)
+{
+    assert(pool != NULL);
+
+    pool->first = NULL;
+    pool->cur = NULL;
+    pool->used = 0;
+}
+
+void mt_chess_log_pool_free(struct mt_chess_log_pool * const pool)
+{
+    assert(pool != NULL);
+
+    struct mt_chess_log_pool_chunk * chunk = pool->first;
+
+    while(chunk != NULL)
+    {
+        struct mt_chess_log_pool_chunk * const next = chunk->next;
+
+        mt_chess_mem_free(chunk);
+        chunk = next;
+    }
+    mt_chess_log_pool_init(pool);
+}
+
+void mt_chess_log_pool_reset(struct mt_chess_log_pool * const pool)
+{
+    assert(pool != NULL);
+
+    pool->cur = pool->first;
+    pool->used = 0;
+}
+
+struct mt_chess_log_node * mt_chess_log_pool_get(
+    struct mt_chess_log_pool * const pool)
+{
+    assert(pool != NULL);
+
+    if(pool->cur == NULL)
+    {
+        assert(pool->first == NULL);
+
+        pool->first = create_chunk();
+        pool->cur = pool->first;
+        pool->used = 0;
+    }
+    else
+    {
+        if(pool->used == MT_CHESS_LOG_POOL_CHUNK_LEN)
+        {
+            if(pool->cur->next == NULL)
+            {
+                pool->cur->next = create_chunk();
+            }
+            pool->cur = pool->cur->next;
+            pool->used = 0;
+        }
+    }
+
+    struct mt_chess_log_node * const ret_val = pool->cur->nodes + pool->used;
+
+    ++pool->used;
+
+    ret_val->last = NULL;
+    ret_val->move = 0; // Invalid move.
+    ret_val->next = NULL;
+
+    return ret_val;
+}
@@ -0,0 +1,63 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_LOG_POOL
+#define MT_CHESS_LOG_POOL
+
+#include "mt_chess_log_node.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Count of log nodes per chunk (a chunk holds 128 full moves).
+//
+#define MT_CHESS_LOG_POOL_CHUNK_LEN 256
+
+struct mt_chess_log_pool_chunk
+{
+    struct mt_chess_log_pool_chunk * next;
+
+    struct mt_chess_log_node nodes[MT_CHESS_LOG_POOL_CHUNK_LEN];
+};
+
+/**
+ * - Per-game pool of log nodes, allocated in chunks.
+ * - Chunks are never given back before mt_chess_log_pool_free(), they are
+ *   reused after mt_chess_log_pool_reset(), instead.
+ */
+struct mt_chess_log_pool
+{
+    struct mt_chess_log_pool_chunk * first; // NULL, if nothing allocated, yet.
+    struct mt_chess_log_pool_chunk * cur; // Chunk to take next node from.
+    int used; // Count of nodes taken from current chunk.
+};
+
+void mt_chess_log_pool_init(struct mt_chess_log_pool * const pool);
+
+/**
+ * - Frees all chunks (iteratively) and re-initializes the pool.
+ * - All nodes taken from the pool are invalid after call.
+ */
+void mt_chess_log_pool_free(struct mt_chess_log_pool * const pool);
+
+/**
+ * - O(1), nothing gets freed.
+ * - All nodes taken from the pool are invalid after call (memory will be
+ *   reused).
+ */
+void mt_chess_log_pool_reset(struct mt_chess_log_pool * const pool);
+
+/**
+ * - Returns an initialized node (no links, invalid move).
+ * - Allocates, if there is no unused node left in the chunks already
+ *   allocated, only.
+ * - Node is owned by the pool (do NOT free it).
+ */
+struct mt_chess_log_node * mt_chess_log_pool_get(
+    struct mt_chess_log_pool * const pool);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_LOG_POOL
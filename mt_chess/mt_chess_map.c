@@ -0,0 +1,136 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200112L // For mmap() and fstat().
+#endif //_WIN32
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#ifdef _WIN32
+    #include <windows.h>
+#else //_WIN32
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif //_WIN32
+
+#include "mt_chess_map.h"
+
+bool mt_chess_map_open(
+    struct mt_chess_map * const map, char const * const path)
+{
+    assert(map != NULL);
+    assert(path != NULL);
+
+    map->buf = NULL;
+    map->size = 0;
+
+#ifdef _WIN32
+    LARGE_INTEGER size;
+
+    map->mapping = NULL;
+    map->file = CreateFileA(
+        path,
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        NULL,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        NULL);
+    if(map->file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+    if(!GetFileSizeEx(map->file, &size)
+        || (uint64_t)size.QuadPart != (uint64_t)(size_t)size.QuadPart)
+    {
+        CloseHandle(map->file);
+        return false;
+    }
+    map->size = (size_t)size.QuadPart;
+    if(map->size == 0)
+    {
+        return true; // (mapping an empty file is not possible)
+    }
+
+    map->mapping = CreateFileMappingA(
+        map->file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if(map->mapping == NULL)
+    {
+        CloseHandle(map->file);
+        return false;
+    }
+    map->buf = (uint8_t const *)MapViewOfFile(
+        map->mapping, FILE_MAP_READ, 0, 0, 0);
+    if(map->buf == NULL)
+    {
+        CloseHandle(map->mapping);
+        CloseHandle(map->file);
+        return false;
+    }
+    return true;
+#else //_WIN32
+    int const fd = open(path, O_RDONLY);
+    struct stat st;
+
+    if(fd == -1)
+    {
+        return false;
+    }
+    if(fstat(fd, &st) != 0
+        || (uint64_t)st.st_size != (uint64_t)(size_t)st.st_size)
+    {
+        close(fd);
+        return false;
+    }
+    map->size = (size_t)st.st_size;
+    if(map->size == 0)
+    {
+        close(fd);
+        return true; // (mapping an empty file is not possible)
+    }
+
+    void * const buf = mmap(NULL, map->size, PROT_READ, MAP_SHARED, fd, 0);
+
+    close(fd); // (the mapping stays valid)
+    if(buf == MAP_FAILED)
+    {
+        return false;
+    }
+    map->buf = (uint8_t const *)buf;
+    return true;
+#endif //_WIN32
+}
+
+void mt_chess_map_close(struct mt_chess_map * const map)
+{
+    assert(map != NULL);
+
+#ifdef _WIN32
+    if(map->buf != NULL)
+    {
+        UnmapViewOfFile(map->buf);
+        CloseHandle(map->mapping);
+    }
+    CloseHandle(map->file);
+#else //_WIN32
+    if(map->buf != NULL)
+    {
+        munmap((void *)map->buf, map->size);
+    }
+#endif //_WIN32
+
+    map->buf = NULL;
+    map->size = 0;
+}
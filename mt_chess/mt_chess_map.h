@@ -0,0 +1,54 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_MAP
+#define MT_CHESS_MAP
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#ifdef _WIN32
+    #include <windows.h>
+#endif //_WIN32
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Thin wrapper around read-only memory mapping of whole files (Win32 or
+// POSIX), to let the OS page in just the parts of (large) files accessed.
+
+struct mt_chess_map
+{
+    uint8_t const * buf; // NULL, if the file is empty.
+    size_t size;
+
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE mapping;
+#endif //_WIN32
+};
+
+/**
+ * - Maps the whole file with given path read-only into memory.
+ * - Returns false on error.
+ */
+bool mt_chess_map_open(
+    struct mt_chess_map * const map, char const * const path);
+
+/**
+ * - Unmaps the file (all pointers into it become invalid).
+ */
+void mt_chess_map_close(struct mt_chess_map * const map);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_MAP
@@ -0,0 +1,49 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cstdlib>
+    #include <cstddef>
+    #include <cstdint>
+    #include <cassert>
+#else //__cplusplus
+    #include <stdlib.h>
+    #include <stddef.h>
+    #include <stdint.h>
+    #include <assert.h>
+#endif //__cplusplus
+
+#include "mt_chess_mem.h"
+#include "mt_chess_thread.h"
+
+static MT_CHESS_THREAD_LOCAL uint64_t s_alloc_count = 0;
+static MT_CHESS_THREAD_LOCAL uint64_t s_free_count = 0;
+
+void * mt_chess_mem_alloc(size_t const size)
+{
+    void * const ret_val = malloc(size);
+
+    assert(ret_val != NULL);
+
+    ++s_alloc_count;
+    return ret_val;
+}
+
+void mt_chess_mem_free(void * const ptr)
+{
+    if(ptr == NULL)
+    {
+        return;
+    }
+    ++s_free_count;
+    free(ptr);
+}
+
+uint64_t mt_chess_mem_get_alloc_count(void)
+{
+    return s_alloc_count;
+}
+
+uint64_t mt_chess_mem_get_free_count(void)
+{
+    return s_free_count;
+}
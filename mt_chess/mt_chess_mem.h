@@ -0,0 +1,44 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_MEM
+#define MT_CHESS_MEM
+
+#ifdef __cplusplus
+    #include <cstddef>
+    #include <cstdint>
+#else //__cplusplus
+    #include <stddef.h>
+    #include <stdint.h>
+#endif //__cplusplus
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+/**
+ * - All heap allocations of the library go through here, to be able to count
+ *   them (per thread, see mt_chess_mem_get_alloc_count()).
+ * - Free return value via mt_chess_mem_free().
+ */
+void * mt_chess_mem_alloc(size_t const size);
+
+/**
+ * - Just does nothing, if NULL given.
+ */
+void mt_chess_mem_free(void * const ptr);
+
+/**
+ * - Returns the count of allocations done by the calling thread so far.
+ */
+uint64_t mt_chess_mem_get_alloc_count(void);
+
+/**
+ * - Returns the count of (non-NULL) frees done by the calling thread so far.
+ */
+uint64_t mt_chess_mem_get_free_count(void);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_MEM
@@ -1,4 +1,3 @@
-
 // Marcel Timm, RhinoDevel, 2025dec21
 
 #ifdef __cplusplus
@@ -18,63 +17,229 @@
 #include "mt_chess_col.h"
 #include "mt_chess_row.h"
 
+static int const s_row_len = (int)mt_chess_col_h + 1;
+
+// Knight, bishop, rook and queen (see mt_chess_move_get_promotion()):
+static char const s_promotion_letters[4] = { 'n', 'b', 'r', 'q' };
+
 void mt_chess_move_invalidate(struct mt_chess_move * const move)
 {
     assert(move != NULL);
-    
+
     mt_chess_piece_invalidate(&move->piece);
-    
+
     mt_chess_pos_invalidate(&move->from);
     mt_chess_pos_invalidate(&move->to);
 }
 
-void mt_chess_move_apply(
-    struct mt_chess_move const * const move, uint8_t * const board)
+void mt_chess_move_get_str(uint16_t const move, char * const out_str)
+{
+    assert(out_str != NULL);
+
+    int const from_index = mt_chess_move_get_from(move);
+    int const to_index = mt_chess_move_get_to(move);
+    int i = 0;
+
+    // (row 0 is rank 8)
+    out_str[i++] = (char)('a' + from_index % s_row_len);
+    out_str[i++] = (char)('8' - from_index / s_row_len);
+    out_str[i++] = (char)('a' + to_index % s_row_len);
+    out_str[i++] = (char)('8' - to_index / s_row_len);
+
+    if(mt_chess_move_get_special(move) == mt_chess_move_special_promotion)
+    {
+        out_str[i++] = s_promotion_letters[
+            (int)mt_chess_move_get_promotion(move)
+                - (int)mt_chess_type_knight];
+    }
+    out_str[i] = '\0';
+}
+
+/**
+ * - Returns -1, if given characters do not name a square.
+ */
+static int get_index(char const file, char const rank)
+{
+    if(file < 'a' || 'h' < file || rank < '1' || '8' < rank)
+    {
+        return -1;
+    }
+    return ('8' - rank) * s_row_len + (file - 'a'); // (row 0 is rank 8)
+}
+
+uint16_t mt_chess_move_find_str(
+    char const * const str,
+    uint16_t const * const moves,
+    int const count)
+{
+    assert(str != NULL);
+    assert(moves != NULL);
+
+    for(int i = 0; i < 4; ++i)
+    {
+        if(str[i] == '\0')
+        {
+            return 0; // Too short.
+        }
+    }
+
+    int const from_index = get_index(str[0], str[1]);
+    int const to_index = get_index(str[2], str[3]);
+    enum mt_chess_type promotion = mt_chess_type_queen;
+
+    if(from_index == -1 || to_index == -1)
+    {
+        return 0;
+    }
+    if(str[4] != '\0')
+    {
+        int p = 0;
+
+        while(p < 4 && s_promotion_letters[p] != str[4])
+        {
+            ++p;
+        }
+        if(p == 4 || str[5] != '\0')
+        {
+            return 0;
+        }
+        promotion = (enum mt_chess_type)((int)mt_chess_type_knight + p);
+    }
+
+    for(int i = 0; i < count; ++i)
+    {
+        uint16_t const move = moves[i];
+
+        if(mt_chess_move_get_from(move) != from_index
+            || mt_chess_move_get_to(move) != to_index)
+        {
+            continue;
+        }
+        if(mt_chess_move_get_special(move) == mt_chess_move_special_promotion
+            && mt_chess_move_get_promotion(move) != promotion)
+        {
+            continue;
+        }
+        return move;
+    }
+    return 0;
+}
+
+uint16_t mt_chess_move_get_packed(
+    struct mt_chess_move const * const move,
+    uint8_t const * const board,
+    enum mt_chess_type const promotion)
 {
     assert(move != NULL);
     assert(board != NULL);
 
-    int const from_index =
-            move->from.row * ((int)mt_chess_col_h + 1) + move->from.col;
+    int const from_index = move->from.row * s_row_len + move->from.col;
     assert(0 <= from_index && from_index < 8 * 8);
 
-    int const to_index =
-            move->to.row * ((int)mt_chess_col_h + 1) + move->to.col;
+    int const to_index = move->to.row * s_row_len + move->to.col;
     assert(0 <= to_index && to_index < 8 * 8);
 
-    assert(board[from_index] == move->piece.id);
-
-    // NOT doing the move, yet (see below).
+    enum mt_chess_move_special special = mt_chess_move_special_none;
 
     if(move->piece.type == mt_chess_type_king)
     {
-        // Additionally move rook, if castling.
+        if(abs(move->to.col - move->from.col) == 2)
+        {
+            special = mt_chess_move_special_castling;
+        }
+    }
+    else
+    {
+        if(move->piece.type == mt_chess_type_pawn)
+        {
+            if(move->to.row == (uint8_t)mt_chess_row_8
+                || move->to.row == (uint8_t)mt_chess_row_1)
+            {
+                special = mt_chess_move_special_promotion;
+            }
+            else
+            {
+                if(move->from.col != move->to.col && board[to_index] == 0)
+                {
+                    special = mt_chess_move_special_en_passant;
+                }
+            }
+        }
+    }
+    return mt_chess_move_pack(from_index, to_index, special, promotion);
+}
 
-        int const horiz_dist_val = move->to.col - move->from.col;
+void mt_chess_move_get_unpacked(
+    uint16_t const packed,
+    struct mt_chess_piece const * const pieces,
+    uint8_t const * const board,
+    struct mt_chess_move * const out_move)
+{
+    assert(pieces != NULL);
+    assert(board != NULL);
+    assert(out_move != NULL);
 
-        if(abs(horiz_dist_val) == 2)
-        {
-            assert(board[to_index] == 0); // (not updated, yet)
+    int const from_index = mt_chess_move_get_from(packed);
+    int const to_index = mt_chess_move_get_to(packed);
 
-            // Initial values are for kingside castling:
-            enum mt_chess_col rook_from_col = mt_chess_col_h;
-            enum mt_chess_col rook_to_col = mt_chess_col_f;
+    assert(board[from_index] != 0);
 
-            if(horiz_dist_val < 0)
-            {
-                // Queenside castling.
-                rook_from_col = mt_chess_col_a;
-                rook_to_col = mt_chess_col_d;
-            }
+    out_move->piece =
+        pieces[mt_chess_piece_get_index(pieces, board[from_index])];
+
+    out_move->from.row = (uint8_t)(from_index / s_row_len);
+    out_move->from.col = (uint8_t)(from_index % s_row_len);
+    out_move->to.row = (uint8_t)(to_index / s_row_len);
+    out_move->to.col = (uint8_t)(to_index % s_row_len);
+}
+
+void mt_chess_move_get_castling_rook(
+    uint16_t const move,
+    int * const out_from_index,
+    int * const out_to_index)
+{
+    assert(mt_chess_move_get_special(move) == mt_chess_move_special_castling);
+    assert(out_from_index != NULL);
+    assert(out_to_index != NULL);
 
-            int const rook_from_index =
-                move->from/*to*/.row * ((int)mt_chess_col_h + 1)
-                    + rook_from_col;
-             assert(0 <= rook_from_index && rook_from_index < 8 * 8);
+    int const from_index = mt_chess_move_get_from(move);
+    int const row_offset = from_index - from_index % s_row_len;
 
-            int const rook_to_index =
-                move->to/*from*/.row * ((int)mt_chess_col_h + 1) + rook_to_col;
-            assert(0 <= rook_to_index && rook_to_index < 8 * 8);
+    if(mt_chess_move_get_to(move) < from_index)
+    {
+        // Queenside castling.
+        *out_from_index = row_offset + (int)mt_chess_col_a;
+        *out_to_index = row_offset + (int)mt_chess_col_d;
+        return;
+    }
+    *out_from_index = row_offset + (int)mt_chess_col_h;
+    *out_to_index = row_offset + (int)mt_chess_col_f;
+}
+
+void mt_chess_move_apply(uint16_t const move, uint8_t * const board)
+{
+    assert(board != NULL);
+
+    int const from_index = mt_chess_move_get_from(move);
+    int const to_index = mt_chess_move_get_to(move);
+
+    assert(board[from_index] != 0);
+
+    // NOT doing the move, yet (see below).
+
+    switch(mt_chess_move_get_special(move))
+    {
+        case mt_chess_move_special_castling:
+        {
+            // Additionally move rook.
+
+            assert(board[to_index] == 0); // (not updated, yet)
+
+            int rook_from_index = -1;
+            int rook_to_index = -1;
+
+            mt_chess_move_get_castling_rook(
+                move, &rook_from_index, &rook_to_index);
 
             assert(board[rook_from_index] != 0); // Kind of a parity test..
             assert(board[rook_to_index] == 0);
@@ -82,40 +247,31 @@ void mt_chess_move_apply(
             // Move rook:
             board[rook_to_index] = board[rook_from_index];
             board[rook_from_index] = 0;
-            
+            break;
         }
-    }
-    else 
-    {
-        if(move->piece.type == mt_chess_type_pawn)
+        case mt_chess_move_special_en_passant:
         {
-            if(move->from.col != move->to.col)
-            {
-                if(board[to_index] == 0) // (not updated, yet)
-                {
-                    // Assuming "en passant".
+            assert(board[to_index] == 0); // (not updated, yet)
 
-                    uint8_t const opponent_pawn_row = move->from.row;
-                    uint8_t const opponent_pawn_col = move->to.col;
+            // The opponent's pawn is at the from-row and the to-column:
+            int const opponent_pawn_index =
+                from_index - from_index % s_row_len + to_index % s_row_len;
 
-                    int const opponent_pawn_index =
-                        opponent_pawn_row * ((int)mt_chess_col_h + 1)
-                        + opponent_pawn_col;
-                    assert(0 <= opponent_pawn_index && opponent_pawn_index < 8 * 8);
+            // Kind of a parity test..
+            assert(board[opponent_pawn_index] != 0);
 
-                    // Kind of a parity test..
-                    assert(board[opponent_pawn_index] != 0);
+            // Remove opponent's pawn from board:
+            board[opponent_pawn_index] = 0;
+            break;
+        }
 
-                    // Remove opponent's pawn from board:
-                    board[opponent_pawn_index] = 0;
-                }
-                //
-                // Otherwise: Standard catch by a pawn.
-            }
+        default:
+        {
+            break; // Standard move or catch (or promotion, see above).
         }
     }
 
     // Move the piece:
+    board[to_index] = board[from_index];
     board[from_index] = 0;
-    board[to_index] = move->piece.id;
 }
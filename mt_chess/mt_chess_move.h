@@ -1,4 +1,3 @@
-
 // Marcel Timm, RhinoDevel, 2025dec21
 
 #ifndef MT_CHESS_MOVE
@@ -12,6 +11,7 @@
 
 #include "mt_chess_piece.h"
 #include "mt_chess_pos.h"
+#include "mt_chess_type.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -20,7 +20,7 @@ extern "C" {
 /**
  * - Castling must be detected implicitly by the piece being a king and the move
  *   being a king-castling move.
- * 
+ *
  * - "En passant" must be detected implicitly by the piece being a pawn and the
  *   move being a pawn-"en passant" move.
  */
@@ -28,23 +28,130 @@ struct mt_chess_move
 {
     // Must be a deep-copy, because of possible pawn promotion after this move.
     struct mt_chess_piece piece;
-    
+
     struct mt_chess_pos from;
     struct mt_chess_pos to;
 };
 
+// Packed (16-bit) move, used for move lists and the game log:
+//
+// - Bits  0 -  5: Board index of the from-square.
+// - Bits  6 - 11: Board index of the to-square.
+// - Bits 12 - 13: Promotion piece type, minus mt_chess_type_knight.
+// - Bits 14 - 15: Special move kind (see enum mt_chess_move_special).
+//
+// - The value 0 is not a valid move (from- and to-square are equal).
+
+enum mt_chess_move_special
+{
+    mt_chess_move_special_none = 0,
+    mt_chess_move_special_promotion = 1,
+    mt_chess_move_special_en_passant = 2,
+    mt_chess_move_special_castling = 3
+};
+
+static inline uint16_t mt_chess_move_pack(
+    int const from_index,
+    int const to_index,
+    enum mt_chess_move_special const special,
+    enum mt_chess_type const promotion)
+{
+    return (uint16_t)(
+        from_index
+            | (to_index << 6)
+            | (special == mt_chess_move_special_promotion
+                ? ((int)promotion - (int)mt_chess_type_knight) << 12 : 0)
+            | ((int)special << 14));
+}
+
+static inline int mt_chess_move_get_from(uint16_t const move)
+{
+    return move & 0x3F;
+}
+
+static inline int mt_chess_move_get_to(uint16_t const move)
+{
+    return (move >> 6) & 0x3F;
+}
+
+static inline enum mt_chess_move_special mt_chess_move_get_special(
+    uint16_t const move)
+{
+    return (enum mt_chess_move_special)(move >> 14);
+}
+
+/**
+ * - Only meaningful, if special move kind is promotion.
+ */
+static inline enum mt_chess_type mt_chess_move_get_promotion(
+    uint16_t const move)
+{
+    return (enum mt_chess_type)(
+        (int)mt_chess_type_knight + ((move >> 12) & 3));
+}
+
+// Size of the coordinate notation of a packed move, e.g. "e7e8q" plus
+// terminator (see mt_chess_move_get_str()).
+//
+#define MT_CHESS_MOVE_STR_SIZE 6
+
 void mt_chess_move_invalidate(struct mt_chess_move * const move);
 
 /**
- * - Detects castling and applies additional move of the rook implicitly.
- * - Detects "en passant" and removes other pawn automatically.
+ * - Writes given packed move in coordinate notation (e.g. "e2e4" or "e7e8q")
+ *   to given buffer, which must hold MT_CHESS_MOVE_STR_SIZE characters.
+ */
+void mt_chess_move_get_str(uint16_t const move, char * const out_str);
+
+/**
+ * - Returns the move from given list of packed moves, which is given in
+ *   coordinate notation (see mt_chess_move_get_str()) by given string.
+ * - The promotion letter is optional (queen, if omitted).
+ * - Returns 0 (invalid move), if not found or string is invalid.
+ */
+uint16_t mt_chess_move_find_str(
+    char const * const str,
+    uint16_t const * const moves,
+    int const count);
+
+/**
+ * - Given board is the board before the move.
+ * - Detects castling and "en passant" (see struct mt_chess_move).
+ * - Given promotion piece type is used, if the move is a promotion, only.
+ */
+uint16_t mt_chess_move_get_packed(
+    struct mt_chess_move const * const move,
+    uint8_t const * const board,
+    enum mt_chess_type const promotion);
+
+/**
+ * - Given pieces and board are the ones before the move.
+ */
+void mt_chess_move_get_unpacked(
+    uint16_t const packed,
+    struct mt_chess_piece const * const pieces,
+    uint8_t const * const board,
+    struct mt_chess_move * const out_move);
+
+/**
+ * - Given move must be a castling move (of the king).
+ * - Gets the board indices of the rook's move.
+ */
+void mt_chess_move_get_castling_rook(
+    uint16_t const move,
+    int * const out_from_index,
+    int * const out_to_index);
+
+/**
+ * - Applies additional move of the rook, if castling.
+ * - Removes other pawn, if "en passant".
+ * - Does NOT change the piece type on promotion (the board just holds IDs).
  * - Does no error handling/detection! Assumes, given move is pseudo-possible
  *   [meaning: Move must have been validated by mt_chess/is_move_allowed(), but
  *    we are ignoring check, check-mate and pinning rules that may forbid this
  *    move, here].
  */
-void mt_chess_move_apply(
-    struct mt_chess_move const * const move, uint8_t * const board);
+void mt_chess_move_apply(uint16_t const move, uint8_t * const board);
 
 #ifdef __cplusplus
 }
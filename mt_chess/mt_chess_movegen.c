@@ -0,0 +1,349 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_movegen.h"
+#include "mt_chess_data.h"
+#include "mt_chess_move.h"
+#include "mt_chess_attack.h"
+#include "mt_chess_check.h"
+#include "mt_chess_piece.h"
+#include "mt_chess_color.h"
+#include "mt_chess_type.h"
+#include "mt_chess_row.h"
+#include "mt_chess_col.h"
+#include "mt_chess_bit.h"
+#include "mt_chess_stats.h"
+
+static int const s_row_len = (int)mt_chess_col_h + 1;
+
+static void add(
+    struct mt_chess_move_list * const list,
+    int const from_index,
+    int const to_index,
+    enum mt_chess_move_special const special,
+    enum mt_chess_type const promotion)
+{
+    assert(list->count < MT_CHESS_MOVE_LIST_MAX);
+
+    list->moves[list->count] =
+        mt_chess_move_pack(from_index, to_index, special, promotion);
+    ++list->count;
+}
+
+static void add_all(
+    struct mt_chess_move_list * const list,
+    int const from_index,
+    uint64_t targets)
+{
+    while(targets != 0)
+    {
+        add(
+            list,
+            from_index,
+            mt_chess_bit_pop_first(&targets),
+            mt_chess_move_special_none,
+            mt_chess_type_queen); // (ignored)
+    }
+}
+
+static void add_pawn(
+    struct mt_chess_move_list * const list,
+    int const from_index,
+    uint64_t targets,
+    bool const promotes)
+{
+    while(targets != 0)
+    {
+        int const to_index = mt_chess_bit_pop_first(&targets);
+
+        if(!promotes)
+        {
+            add(
+                list,
+                from_index,
+                to_index,
+                mt_chess_move_special_none,
+                mt_chess_type_queen); // (ignored)
+            continue;
+        }
+        for(int type = (int)mt_chess_type_queen;
+            (int)mt_chess_type_knight <= type;
+            --type)
+        {
+            add(
+                list,
+                from_index,
+                to_index,
+                mt_chess_move_special_promotion,
+                (enum mt_chess_type)type);
+        }
+    }
+}
+
+static void add_castling(
+    struct mt_chess_data const * const data,
+    int const king_index,
+    uint64_t const occupied,
+    struct mt_chess_move_list * const out_list)
+{
+    bool const white = data->turn == mt_chess_color_white;
+    uint8_t const kingside = white
+        ? MT_CHESS_DATA_CASTLING_WHITE_KINGSIDE
+        : MT_CHESS_DATA_CASTLING_BLACK_KINGSIDE;
+    uint8_t const queenside = white
+        ? MT_CHESS_DATA_CASTLING_WHITE_QUEENSIDE
+        : MT_CHESS_DATA_CASTLING_BLACK_QUEENSIDE;
+
+    if((data->castling & (kingside | queenside)) == 0)
+    {
+        return;
+    }
+
+    // A castling right being available implies that king and rook are at their
+    // initial squares.
+
+    assert(king_index % s_row_len == (int)mt_chess_col_e);
+
+    if((data->castling & kingside) != 0)
+    {
+        uint64_t const empty = MT_CHESS_BIT_SQUARE(king_index + 1)
+            | MT_CHESS_BIT_SQUARE(king_index + 2);
+
+        if((occupied & empty) == 0 && (data->check.danger & empty) == 0)
+        {
+            add(
+                out_list,
+                king_index,
+                king_index + 2,
+                mt_chess_move_special_castling,
+                mt_chess_type_queen); // (ignored)
+        }
+    }
+    if((data->castling & queenside) != 0)
+    {
+        uint64_t const empty = MT_CHESS_BIT_SQUARE(king_index - 1)
+            | MT_CHESS_BIT_SQUARE(king_index - 2)
+            | MT_CHESS_BIT_SQUARE(king_index - 3);
+        uint64_t const safe = MT_CHESS_BIT_SQUARE(king_index - 1)
+            | MT_CHESS_BIT_SQUARE(king_index - 2);
+
+        if((occupied & empty) == 0 && (data->check.danger & safe) == 0)
+        {
+            add(
+                out_list,
+                king_index,
+                king_index - 2,
+                mt_chess_move_special_castling,
+                mt_chess_type_queen); // (ignored)
+        }
+    }
+}
+
+void mt_chess_movegen_get_legal(
+    struct mt_chess_data const * const data,
+    struct mt_chess_move_list * const out_list)
+{
+    assert(data != NULL);
+    assert(out_list != NULL);
+
+    enum mt_chess_color const turn = (enum mt_chess_color)data->turn;
+    bool const white = turn == mt_chess_color_white;
+    struct mt_chess_check const * const check = &data->check;
+    bool const double_check = mt_chess_bit_count(check->checkers) > 1;
+
+    // White has negative direction, because of rank order (8 to 1).
+    int const pawn_add = white ? -s_row_len : s_row_len;
+    int const pawn_start_row = white ? (int)mt_chess_row_2 : (int)mt_chess_row_7;
+    int const pawn_last_row = white ? (int)mt_chess_row_8 : (int)mt_chess_row_1;
+
+    uint64_t own = 0;
+    uint64_t occupied = 0;
+
+    MT_CHESS_STATS_BEGIN(stats_begin);
+
+    out_list->count = 0;
+
+    for(int index = 0; index < 8 * 8; ++index)
+    {
+        uint8_t const piece_id = data->board[index];
+
+        if(piece_id == 0)
+        {
+            continue;
+        }
+        occupied |= MT_CHESS_BIT_SQUARE(index);
+        if(data->pieces[mt_chess_piece_get_index(data->pieces, piece_id)].color
+            == turn)
+        {
+            own |= MT_CHESS_BIT_SQUARE(index);
+        }
+    }
+
+    uint64_t const opponent = occupied & ~own;
+    uint64_t from_mask = own;
+
+    while(from_mask != 0)
+    {
+        int const from_index = mt_chess_bit_pop_first(&from_mask);
+        struct mt_chess_piece const * const piece = data->pieces
+            + mt_chess_piece_get_index(data->pieces, data->board[from_index]);
+
+        if(piece->type == mt_chess_type_king)
+        {
+            add_all(
+                out_list,
+                from_index,
+                mt_chess_attack_get_king(from_index) & ~own & ~check->danger);
+
+            if(check->checkers == 0)
+            {
+                add_castling(data, from_index, occupied, out_list);
+            }
+            continue;
+        }
+
+        if(double_check)
+        {
+            continue; // Only the king can move.
+        }
+
+        uint64_t const legal = mt_chess_check_get_mask(check, from_index);
+
+        switch(piece->type)
+        {
+            case mt_chess_type_pawn:
+            {
+                int const to_index = from_index + pawn_add;
+                bool const promotes = to_index / s_row_len == pawn_last_row;
+                uint64_t targets = 0;
+
+                if((occupied & MT_CHESS_BIT_SQUARE(to_index)) == 0)
+                {
+                    targets |= MT_CHESS_BIT_SQUARE(to_index);
+
+                    if(from_index / s_row_len == pawn_start_row
+                        && (occupied
+                            & MT_CHESS_BIT_SQUARE(to_index + pawn_add)) == 0)
+                    {
+                        targets |= MT_CHESS_BIT_SQUARE(to_index + pawn_add);
+                    }
+                }
+
+                uint64_t const attacks =
+                    mt_chess_attack_get_pawn(from_index, turn);
+
+                targets |= attacks & opponent;
+
+                add_pawn(out_list, from_index, targets & legal, promotes);
+
+                if(data->en_passant != MT_CHESS_DATA_NO_EN_PASSANT
+                    && (attacks
+                        & MT_CHESS_BIT_SQUARE(data->en_passant)) != 0
+                    && mt_chess_check_is_en_passant_safe(
+                        data->pieces,
+                        data->board,
+                        turn,
+                        from_index,
+                        (int)data->en_passant))
+                {
+                    add(
+                        out_list,
+                        from_index,
+                        (int)data->en_passant,
+                        mt_chess_move_special_en_passant,
+                        mt_chess_type_queen); // (ignored)
+                }
+                break;
+            }
+            case mt_chess_type_knight:
+            {
+                add_all(
+                    out_list,
+                    from_index,
+                    mt_chess_attack_get_knight(from_index) & ~own & legal);
+                break;
+            }
+            case mt_chess_type_bishop:
+            {
+                add_all(
+                    out_list,
+                    from_index,
+                    mt_chess_attack_get_bishop(from_index, occupied)
+                        & ~own & legal);
+                break;
+            }
+            case mt_chess_type_rook:
+            {
+                add_all(
+                    out_list,
+                    from_index,
+                    mt_chess_attack_get_rook(from_index, occupied)
+                        & ~own & legal);
+                break;
+            }
+            case mt_chess_type_queen:
+            {
+                add_all(
+                    out_list,
+                    from_index,
+                    (mt_chess_attack_get_bishop(from_index, occupied)
+                        | mt_chess_attack_get_rook(from_index, occupied))
+                            & ~own & legal);
+                break;
+            }
+
+            default:
+            {
+                assert(false); // Must not get here.
+                break;
+            }
+        }
+    }
+
+    MT_CHESS_STATS_END(mt_chess_stats_id_movegen, stats_begin);
+}
+
+uint64_t mt_chess_movegen_get_targets(
+    struct mt_chess_move_list const * const list, int const from_index)
+{
+    assert(list != NULL);
+    assert(0 <= from_index && from_index < 8 * 8);
+
+    uint64_t ret_val = 0;
+
+    for(int i = 0; i < list->count; ++i)
+    {
+        uint16_t const move = list->moves[i];
+
+        if(mt_chess_move_get_from(move) == from_index)
+        {
+            ret_val |= MT_CHESS_BIT_SQUARE(mt_chess_move_get_to(move));
+        }
+    }
+    return ret_val;
+}
+
+uint64_t mt_chess_movegen_get_movable(
+    struct mt_chess_move_list const * const list)
+{
+    assert(list != NULL);
+
+    uint64_t ret_val = 0;
+
+    for(int i = 0; i < list->count; ++i)
+    {
+        ret_val |= MT_CHESS_BIT_SQUARE(mt_chess_move_get_from(list->moves[i]));
+    }
+    return ret_val;
+}
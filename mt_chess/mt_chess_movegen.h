@@ -0,0 +1,54 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_MOVEGEN
+#define MT_CHESS_MOVEGEN
+
+#ifdef __cplusplus
+    #include <cstdint>
+#else //__cplusplus
+    #include <stdint.h>
+#endif //__cplusplus
+
+#include "mt_chess_data.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// More than the maximum count of legal moves in any chess position (218).
+//
+#define MT_CHESS_MOVE_LIST_MAX 256
+
+struct mt_chess_move_list
+{
+    uint16_t moves[MT_CHESS_MOVE_LIST_MAX]; // Packed (see mt_chess_move.h).
+    int count;
+};
+
+/**
+ * - Fills given list with all legal moves of the player having the turn.
+ * - Generates all four promotion piece types per promoting pawn move.
+ */
+void mt_chess_movegen_get_legal(
+    struct mt_chess_data const * const data,
+    struct mt_chess_move_list * const out_list);
+
+/**
+ * - Returns the mask of the squares (see mt_chess_bit.h) that the moves of
+ *   given list from given square lead to.
+ */
+uint64_t mt_chess_movegen_get_targets(
+    struct mt_chess_move_list const * const list, int const from_index);
+
+/**
+ * - Returns the mask of the squares that at least one move of given list
+ *   starts from.
+ */
+uint64_t mt_chess_movegen_get_movable(
+    struct mt_chess_move_list const * const list);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_MOVEGEN
@@ -0,0 +1,188 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstddef>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stddef.h>
+#endif //__cplusplus
+
+#include "mt_chess_pawn.h"
+#include "mt_chess_color.h"
+#include "mt_chess_thread.h"
+#include "mt_chess_stats.h"
+
+#define MT_PAWN_HASH_SIZE (1 << MT_CHESS_PAWN_HASH_BITS)
+
+static int const s_row_len = 8;
+
+static uint64_t const s_col_a = 0x0101010101010101ULL;
+
+// Bonus of a passed pawn, indexed by its row counted from its side's first
+// row (0):
+//
+static int const s_passed[8] = { 0, 5, 10, 20, 35, 60, 100, 0 };
+
+static int const s_doubled = -10; // Per pawn behind another one.
+static int const s_isolated = -15;
+static int const s_backward = -8;
+
+// Shelter per column at and beside the king's column by a pawn on the second
+// or third row of its side (or the penalty, if there is no such pawn):
+//
+static int const s_shelter_second_row = 10;
+static int const s_shelter_third_row = 5;
+static int const s_shelter_missing = -15;
+
+static MT_CHESS_THREAD_LOCAL struct mt_chess_pawn_entry
+    s_table[MT_PAWN_HASH_SIZE];
+
+/**
+ * - Returns the mask of the columns beside given column.
+ */
+static uint64_t get_beside_mask(int const col)
+{
+    return (col == 0 ? 0 : s_col_a << (col - 1))
+        | (col == s_row_len - 1 ? 0 : s_col_a << (col + 1));
+}
+
+/**
+ * - Returns the mask of the rows in front of given row, from the view of
+ *   given color (white moves to row 0, black to row 7).
+ */
+static uint64_t get_front_mask(enum mt_chess_color const color, int const row)
+{
+    if(color == mt_chess_color_white)
+    {
+        return (1ULL << (s_row_len * row)) - 1;
+    }
+    return row == s_row_len - 1 ? 0 : ~((1ULL << (s_row_len * (row + 1))) - 1);
+}
+
+/**
+ * - Returns the score of the passed, isolated, doubled and backward pawns of
+ *   given color.
+ */
+static int get_score(
+    uint64_t const * const pawns, enum mt_chess_color const color)
+{
+    enum mt_chess_color const opp = color == mt_chess_color_white
+        ? mt_chess_color_black : mt_chess_color_white;
+    uint64_t const own = pawns[color];
+    int ret_val = 0;
+
+    for(int index = 0; index < 8 * 8; ++index)
+    {
+        if((own >> index & 1) == 0)
+        {
+            continue;
+        }
+
+        int const row = index / s_row_len;
+        int const col = index % s_row_len;
+        uint64_t const col_mask = s_col_a << col;
+        uint64_t const beside = get_beside_mask(col);
+        uint64_t const front = get_front_mask(color, row);
+
+        if((pawns[opp] & (col_mask | beside) & front) == 0)
+        {
+            ret_val += s_passed[
+                color == mt_chess_color_white ? s_row_len - 1 - row : row];
+        }
+        if((own & col_mask & front) != 0)
+        {
+            ret_val += s_doubled;
+        }
+        if((own & beside) == 0)
+        {
+            ret_val += s_isolated;
+            continue;
+        }
+
+        // Backward: No pawn beside can support it (all are in front) and the
+        // square in front is attacked by an opponent's pawn.
+
+        int const forward = color == mt_chess_color_white ? -1 : 1;
+        int const attack_row = row + 2 * forward;
+
+        if((own & beside & ~front) == 0
+            && 0 <= attack_row && attack_row < s_row_len
+            && (pawns[opp] & beside
+                    & (0xFFULL << (s_row_len * attack_row))) != 0)
+        {
+            ret_val += s_backward;
+        }
+    }
+    return ret_val;
+}
+
+/**
+ * - Returns the shelter by the pawns of given color for its king at given
+ *   column.
+ */
+static int get_shelter(
+    uint64_t const * const pawns,
+    enum mt_chess_color const color,
+    int const king_col)
+{
+    int const second_row = color == mt_chess_color_white ? 6 : 1;
+    int const third_row = color == mt_chess_color_white ? 5 : 2;
+    int ret_val = 0;
+
+    for(int col = king_col - 1; col <= king_col + 1; ++col)
+    {
+        if(col < 0 || s_row_len <= col)
+        {
+            continue;
+        }
+        if((pawns[color] >> (second_row * s_row_len + col) & 1) != 0)
+        {
+            ret_val += s_shelter_second_row;
+        }
+        else if((pawns[color] >> (third_row * s_row_len + col) & 1) != 0)
+        {
+            ret_val += s_shelter_third_row;
+        }
+        else
+        {
+            ret_val += s_shelter_missing;
+        }
+    }
+    return ret_val;
+}
+
+struct mt_chess_pawn_entry const * mt_chess_pawn_probe(
+    uint64_t const pawn_hash, uint64_t const * const pawns)
+{
+    assert(pawns != NULL);
+
+    MT_CHESS_STATS_BEGIN(stats_begin);
+
+    struct mt_chess_pawn_entry * const entry =
+        s_table + (pawn_hash & (MT_PAWN_HASH_SIZE - 1));
+
+    if(entry->used != 0 && entry->key == pawn_hash)
+    {
+        MT_CHESS_STATS_END(mt_chess_stats_id_pawn_hash_hit, stats_begin);
+        return entry;
+    }
+
+    entry->key = pawn_hash;
+    entry->score = (int16_t)(get_score(pawns, mt_chess_color_white)
+        - get_score(pawns, mt_chess_color_black));
+    for(int color = 0; color < 2; ++color)
+    {
+        for(int col = 0; col < s_row_len; ++col)
+        {
+            entry->shelter[color][col] = (int16_t)get_shelter(
+                pawns, (enum mt_chess_color)color, col);
+        }
+    }
+    entry->used = 1;
+
+    MT_CHESS_STATS_END(mt_chess_stats_id_pawn_hash_miss, stats_begin);
+    return entry;
+}
@@ -0,0 +1,63 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_PAWN
+#define MT_CHESS_PAWN
+
+#ifdef __cplusplus
+    #include <cstdint>
+#else //__cplusplus
+    #include <stdint.h>
+#endif //__cplusplus
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Pawn-structure evaluation, cached per thread in a pawn hash table indexed by
+// the pawn hash of the position (see mt_chess_data.pawn_hash), because the
+// pawns change much less often than the other pieces during a search:
+//
+// - Define MT_CHESS_PAWN_HASH_BITS when building the library to set the count
+//   of entries per thread (2 to the power of the bits, 48 bytes each).
+// - Hits and misses are counted by the hot-path stats (see mt_chess_stats.h),
+//   to size the table.
+
+#ifndef MT_CHESS_PAWN_HASH_BITS
+    #define MT_CHESS_PAWN_HASH_BITS 10
+#endif //MT_CHESS_PAWN_HASH_BITS
+
+/**
+ * - Evaluation terms depending on the pawns, only.
+ */
+struct mt_chess_pawn_entry
+{
+    uint64_t key; // Pawn hash.
+
+    // Passed, isolated, doubled and backward pawns in centipawns, white's
+    // score minus black's score:
+    //
+    int16_t score;
+
+    // King shelter in centipawns by the pawns in front of a king on the first
+    // or second row of its side, indexed by enum mt_chess_color and the
+    // king's column:
+    //
+    int16_t shelter[2][8];
+
+    uint8_t used; // 0 = Entry holds nothing, yet.
+};
+
+/**
+ * - Returns the calling thread's entry for the pawns of given position (with
+ *   given pawn hash and given pawns per color, bit n set for a pawn at board
+ *   index n), evaluating the pawns on a miss.
+ * - The entry stays valid until the next call by the calling thread.
+ */
+struct mt_chess_pawn_entry const * mt_chess_pawn_probe(
+    uint64_t const pawn_hash, uint64_t const * const pawns);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_PAWN
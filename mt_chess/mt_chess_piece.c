@@ -24,16 +24,12 @@ int mt_chess_piece_get_index(
     // Also assuming that array the pointer points to has 2 x 2 x 8 items.
     
     assert(1 <= id && id <= 32); // Although no problem, here.
-    
-    for(int i = 0; i < 2 * 2 * 8; ++i)
-    {
-        if(pieces[i].id == id)
-        {
-            return i;
-        }
-    }
-    assert(false);
-    return -1; // Not found.
+
+    // See mt_chess_piece_init().
+    int const ret_val = (int)id - 1;
+
+    assert(pieces[ret_val].id == id);
+    return ret_val;
 }
 
 void mt_chess_piece_init(struct mt_chess_piece * const pieces)
@@ -48,16 +44,16 @@ void mt_chess_piece_init(struct mt_chess_piece * const pieces)
     assert((int)mt_chess_color_black == 1);
     for(int color = 0; color < 2; ++color) // Per color.
     {
-        pieces[i].color = (enum mt_chess_color)color;
-        pieces[i].type = mt_chess_type_king;
+        pieces[i].color = (uint8_t)color;
+        pieces[i].type = (uint8_t)mt_chess_type_king;
         pieces[i].id = id;
         ++i;
         ++id;
         
         for(int c = 0; c < 8; ++c)
         {
-            pieces[i].color = (enum mt_chess_color)color;
-            pieces[i].type = mt_chess_type_pawn;
+            pieces[i].color = (uint8_t)color;
+            pieces[i].type = (uint8_t)mt_chess_type_pawn;
             pieces[i].id = id;
             ++i;
             ++id;
@@ -65,8 +61,8 @@ void mt_chess_piece_init(struct mt_chess_piece * const pieces)
         
         for(int c = 0; c < 2; ++c)
         {
-            pieces[i].color = (enum mt_chess_color)color;
-            pieces[i].type = mt_chess_type_knight;
+            pieces[i].color = (uint8_t)color;
+            pieces[i].type = (uint8_t)mt_chess_type_knight;
             pieces[i].id = id;
             ++i;
             ++id;
@@ -74,8 +70,8 @@ void mt_chess_piece_init(struct mt_chess_piece * const pieces)
         
         for(int c = 0; c < 2; ++c)
         {
-            pieces[i].color = (enum mt_chess_color)color;
-            pieces[i].type = mt_chess_type_bishop;
+            pieces[i].color = (uint8_t)color;
+            pieces[i].type = (uint8_t)mt_chess_type_bishop;
             pieces[i].id = id;
             ++i;
             ++id;
@@ -83,22 +79,23 @@ void mt_chess_piece_init(struct mt_chess_piece * const pieces)
         
         for(int c = 0; c < 2; ++c)
         {
-            pieces[i].color = (enum mt_chess_color)color;
-            pieces[i].type = mt_chess_type_rook;
+            pieces[i].color = (uint8_t)color;
+            pieces[i].type = (uint8_t)mt_chess_type_rook;
             pieces[i].id = id;
             ++i;
             ++id;
         }
         
-        pieces[i].color = (enum mt_chess_color)color;
-        pieces[i].type = mt_chess_type_queen;
+        pieces[i].color = (uint8_t)color;
+        pieces[i].type = (uint8_t)mt_chess_type_queen;
         pieces[i].id = id;
         ++i;
         ++id;
     }
     assert(i == 2 * 2 * 8); // 32, for valid indices from 0 to 31.
 
-    // TODO: Just use i + 1 directly instead of extra ID?
+    // The ID is always the index plus one (mt_chess_piece_get_index() relies
+    // on this):
     assert(id == i + 1); // 33, for valid IDs from 1 to 32.
 }
 
@@ -106,8 +103,8 @@ void mt_chess_piece_invalidate(struct mt_chess_piece * const piece)
 {
     assert(piece != NULL);
     
-    piece->color = mt_chess_color_white; // Not invalid..
-    piece->type = mt_chess_type_king; // Also not invalid..
+    piece->color = (uint8_t)mt_chess_color_white; // Not invalid..
+    piece->type = (uint8_t)mt_chess_type_king; // Also not invalid..
     
     piece->id = 0; // Signalizes invalid piece.
 }
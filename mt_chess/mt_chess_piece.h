@@ -19,11 +19,14 @@ extern "C" {
 
 struct mt_chess_piece // Not just an enum., e.g., because of pawn promotion.
 {
-    enum mt_chess_color color;
-    enum mt_chess_type type;
+    uint8_t color; // Holds value of enumeration mt_chess_color.
+    uint8_t type; // Holds value of enumeration mt_chess_type.
     uint8_t id; // 0 for invalid/unset (0 also means empty cell on the board).
 };
 
+/**
+ * - Constant time, because the index of a piece is always its ID minus one.
+ */
 int mt_chess_piece_get_index(
         struct mt_chess_piece const * const pieces, uint8_t const id);
 
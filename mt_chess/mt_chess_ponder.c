@@ -0,0 +1,308 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_ponder.h"
+#include "mt_chess_search_async.h"
+#include "mt_chess_search.h"
+#include "mt_chess_data.h"
+#include "mt_chess_thread.h"
+#include "mt_chess_clock.h"
+#include "mt_chess_latency.h"
+#include "mt_chess_mem.h"
+
+/**
+ * - One search of the pool.
+ */
+struct slot
+{
+    struct mt_chess_ponder_pool * pool;
+    struct mt_chess_search_async * async;
+
+    // Protected by the pool's mutex:
+
+    bool used; // By a game (or by a stopped search not done, yet).
+    bool done; // The search's completion function was called.
+    bool abandoned; // The game stopped pondering before the search was done.
+
+    uint64_t max_nodes; // 0 = no limit (while pondering).
+    uint64_t end_ns; // 0 = no limit (while pondering).
+
+    struct mt_chess_search_result result; // Valid, if done.
+};
+
+struct mt_chess_ponder_pool
+{
+    struct mt_chess_thread_mutex mutex;
+    struct slot * slots;
+    int count;
+};
+
+/**
+ * - Stop function of the searches, stopping at the limits of a ponder hit.
+ */
+static bool is_stopped(void * const ctx, uint64_t const nodes)
+{
+    struct slot * const slot = (struct slot *)ctx;
+
+    mt_chess_thread_mutex_lock(&slot->pool->mutex);
+
+    uint64_t const max_nodes = slot->max_nodes;
+    uint64_t const end_ns = slot->end_ns;
+
+    mt_chess_thread_mutex_unlock(&slot->pool->mutex);
+
+    return (max_nodes != 0 && max_nodes <= nodes)
+        || (end_ns != 0 && end_ns <= mt_chess_clock_get_ns());
+}
+
+static void on_done(
+    void * const ctx, struct mt_chess_search_result const * const result)
+{
+    struct slot * const slot = (struct slot *)ctx;
+
+    mt_chess_thread_mutex_lock(&slot->pool->mutex);
+    slot->result = *result;
+    slot->done = true;
+    if(slot->abandoned)
+    {
+        slot->used = false; // (the game does not wait for the result)
+    }
+    mt_chess_thread_mutex_unlock(&slot->pool->mutex);
+}
+
+struct mt_chess_ponder_pool * mt_chess_ponder_pool_create(int const count)
+{
+    assert(1 <= count);
+
+    struct mt_chess_ponder_pool * const ret_val =
+        (struct mt_chess_ponder_pool *)mt_chess_mem_alloc(sizeof *ret_val);
+
+    mt_chess_thread_mutex_init(&ret_val->mutex);
+    ret_val->slots = (struct slot *)mt_chess_mem_alloc(
+        (size_t)count * sizeof *ret_val->slots);
+    ret_val->count = 0;
+
+    for(int i = 0; i < count; ++i)
+    {
+        struct slot * const slot = ret_val->slots + i;
+
+        slot->pool = ret_val;
+        slot->async = mt_chess_search_async_create();
+        if(slot->async == NULL)
+        {
+            mt_chess_ponder_pool_free(ret_val);
+            return NULL;
+        }
+        slot->used = false;
+        slot->done = false;
+        slot->abandoned = false;
+        slot->max_nodes = 0;
+        slot->end_ns = 0;
+        ++ret_val->count;
+    }
+    return ret_val;
+}
+
+void mt_chess_ponder_pool_free(struct mt_chess_ponder_pool * const pool)
+{
+    assert(pool != NULL);
+
+    for(int i = 0; i < pool->count; ++i)
+    {
+        // (waits for abandoned searches to stop)
+        mt_chess_search_async_free(pool->slots[i].async);
+
+        assert(!pool->slots[i].used); // (all games must have stopped)
+    }
+    mt_chess_mem_free(pool->slots);
+    mt_chess_thread_mutex_deinit(&pool->mutex);
+    mt_chess_mem_free(pool);
+}
+
+void mt_chess_ponder_init(
+    struct mt_chess_ponder * const ponder,
+    struct mt_chess_ponder_pool * const pool)
+{
+    assert(ponder != NULL);
+
+    ponder->pool = pool;
+    ponder->slot = -1;
+    ponder->hash = 0;
+}
+
+bool mt_chess_ponder_start(
+    struct mt_chess_ponder * const ponder,
+    struct mt_chess_data const * const data,
+    uint16_t const reply)
+{
+    assert(ponder != NULL);
+    assert(data != NULL);
+
+    mt_chess_ponder_stop(ponder);
+
+    struct mt_chess_ponder_pool * const pool = ponder->pool;
+
+    if(pool == NULL || reply == 0)
+    {
+        return false;
+    }
+
+    struct slot * slot = NULL;
+
+    mt_chess_thread_mutex_lock(&pool->mutex);
+    for(int i = 0; i < pool->count; ++i)
+    {
+        if(!pool->slots[i].used)
+        {
+            slot = pool->slots + i;
+            slot->used = true;
+            slot->done = false;
+            slot->abandoned = false;
+            slot->max_nodes = 0;
+            slot->end_ns = 0;
+            ponder->slot = i;
+            break;
+        }
+    }
+    mt_chess_thread_mutex_unlock(&pool->mutex);
+
+    if(slot == NULL)
+    {
+        return false; // At the cap.
+    }
+
+    struct mt_chess_data child = *data;
+    struct mt_chess_search_limits limits;
+
+    mt_chess_data_apply_move(&child, reply, NULL);
+    ponder->hash = child.hash;
+
+    mt_chess_search_init_limits(&limits);
+    limits.is_stopped = is_stopped;
+    limits.ctx = slot;
+
+    // The completion function of an abandoned earlier search of the slot may
+    // not have returned, yet:
+    //
+    mt_chess_search_async_wait(slot->async);
+
+    bool const started =
+        mt_chess_search_async_start(slot->async, &child, &limits, on_done);
+
+    assert(started);
+    (void)started;
+    return true;
+}
+
+void mt_chess_ponder_stop(struct mt_chess_ponder * const ponder)
+{
+    assert(ponder != NULL);
+
+    if(ponder->slot == -1)
+    {
+        return;
+    }
+
+    struct slot * const slot = ponder->pool->slots + ponder->slot;
+
+    mt_chess_search_async_stop(slot->async);
+
+    mt_chess_thread_mutex_lock(&ponder->pool->mutex);
+    if(slot->done)
+    {
+        slot->used = false;
+    }
+    else
+    {
+        slot->abandoned = true; // (on_done() frees the slot)
+    }
+    mt_chess_thread_mutex_unlock(&ponder->pool->mutex);
+
+    ponder->slot = -1;
+}
+
+void mt_chess_ponder_check_miss(
+    struct mt_chess_ponder * const ponder,
+    struct mt_chess_data const * const data)
+{
+    assert(ponder != NULL);
+    assert(data != NULL);
+
+    if(ponder->slot != -1 && data->hash != ponder->hash)
+    {
+        mt_chess_ponder_stop(ponder);
+    }
+}
+
+bool mt_chess_ponder_get_best(
+    struct mt_chess_ponder * const ponder,
+    struct mt_chess_data const * const data,
+    struct mt_chess_search_limits const * const limits,
+    struct mt_chess_search_result * const out_result)
+{
+    assert(ponder != NULL);
+    assert(data != NULL);
+    assert(limits != NULL);
+    assert(out_result != NULL);
+
+    mt_chess_ponder_check_miss(ponder, data);
+    if(ponder->slot == -1)
+    {
+        return false;
+    }
+
+    // Ponder hit:
+
+    struct slot * const slot = ponder->pool->slots + ponder->slot;
+    uint64_t const latency_begin = mt_chess_latency_begin();
+
+    uint64_t time_ns = limits->time_ns;
+
+    // The search already running got no time manager, so there is no soft
+    // deadline. It gets the time a search of a new position aims for (its
+    // optimum, which is below the hard deadline), instead:
+    //
+    if(limits->timeman != NULL)
+    {
+        uint64_t const optimum_ns = limits->timeman->optimum_ns == 0
+            ? 1 : limits->timeman->optimum_ns; // (0 would mean no limit)
+
+        if(time_ns == 0 || optimum_ns < time_ns)
+        {
+            time_ns = optimum_ns;
+        }
+    }
+
+    mt_chess_thread_mutex_lock(&ponder->pool->mutex);
+    slot->max_nodes = limits->nodes;
+    slot->end_ns = time_ns == 0 ? 0 : mt_chess_clock_get_ns() + time_ns;
+    if(slot->max_nodes == 0 && slot->end_ns == 0)
+    {
+        slot->max_nodes = 1; // (no limit would never stop, so stopping now)
+    }
+    mt_chess_thread_mutex_unlock(&ponder->pool->mutex);
+
+    mt_chess_search_async_wait(slot->async);
+
+    mt_chess_thread_mutex_lock(&ponder->pool->mutex);
+    assert(slot->done);
+    *out_result = slot->result;
+    slot->used = false;
+    mt_chess_thread_mutex_unlock(&ponder->pool->mutex);
+
+    mt_chess_latency_end(mt_chess_latency_id_bot_move, latency_begin);
+
+    ponder->slot = -1;
+    return true;
+}
@@ -0,0 +1,109 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_PONDER
+#define MT_CHESS_PONDER
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_data.h"
+#include "mt_chess_search.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Pondering: After the bot made its move, the position after the expected
+// reply gets searched during the opponent's time. If the opponent plays the
+// expected reply ("ponder hit"), that search just goes on with the limits of
+// the bot's next move, otherwise it gets stopped ("ponder miss").
+
+/**
+ * - Holds the search threads shared by all games, which caps the count of
+ *   games pondering at once.
+ * - Is thread-safe.
+ */
+struct mt_chess_ponder_pool;
+
+/**
+ * - The pondering state of one game (calls for one game must not overlap).
+ */
+struct mt_chess_ponder
+{
+    struct mt_chess_ponder_pool * pool;
+    int slot; // Index of the pool's search used or -1, if not pondering.
+    uint64_t hash; // Hash of the position searched.
+};
+
+/**
+ * - Starts given count of search threads (waiting until used).
+ * - Returns NULL, if a thread could not be started.
+ * - Free return value via mt_chess_ponder_pool_free(), after all games
+ *   stopped pondering.
+ */
+struct mt_chess_ponder_pool * mt_chess_ponder_pool_create(int const count);
+
+void mt_chess_ponder_pool_free(struct mt_chess_ponder_pool * const pool);
+
+/**
+ * - Initializes given game's state (not pondering).
+ */
+void mt_chess_ponder_init(
+    struct mt_chess_ponder * const ponder,
+    struct mt_chess_ponder_pool * const pool);
+
+/**
+ * - Starts searching the position after given expected reply (given position
+ *   being the one after the bot's move) without any limit.
+ * - Returns false, if the pool's searches are all in use (or there is no
+ *   expected reply). Stops pondering first, if still pondering.
+ */
+bool mt_chess_ponder_start(
+    struct mt_chess_ponder * const ponder,
+    struct mt_chess_data const * const data,
+    uint16_t const reply);
+
+/**
+ * - Stops pondering without waiting for the search to stop (so its search
+ *   thread may be in use for about a thousand nodes, yet).
+ * - Does nothing, if not pondering.
+ */
+void mt_chess_ponder_stop(struct mt_chess_ponder * const ponder);
+
+/**
+ * - Stops pondering, if given position is not the one pondered (the opponent
+ *   did not play the expected reply), to free the search early.
+ */
+void mt_chess_ponder_check_miss(
+    struct mt_chess_ponder * const ponder,
+    struct mt_chess_data const * const data);
+
+/**
+ * - Returns true on a ponder hit, if pondering the given position: Lets the
+ *   search go on until given node or time limit is reached (the nodes
+ *   visited while pondering counting, the time starting now) and stores its
+ *   result (with the nodes visited while pondering).
+ * - With a time manager given (clocked game), the time limit is at most its
+ *   optimum time (see mt_chess_timeman.h), starting now. There is no soft
+ *   deadline after an iteration, as the search was started without it.
+ * - Without any limit, the search stops at once.
+ * - Without a ponder hit, stops pondering (if pondering) and returns false
+ *   (the caller needs to search by itself).
+ * - Ignores the depth and the functions of given limits.
+ */
+bool mt_chess_ponder_get_best(
+    struct mt_chess_ponder * const ponder,
+    struct mt_chess_data const * const data,
+    struct mt_chess_search_limits const * const limits,
+    struct mt_chess_search_result * const out_result);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_PONDER
@@ -0,0 +1,148 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstddef>
+    #include <cassert>
+    #include <cstdbool>
+    #include <cstdio>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <assert.h>
+    #include <stdbool.h>
+    #include <stdio.h>
+#endif //__cplusplus
+
+#include "mt_chess_record.h"
+#include "mt_chess_game.h"
+#include "mt_chess_data.h"
+#include "mt_chess_log_node.h"
+#include "mt_chess_movegen.h"
+#include "mt_chess_le.h"
+#include "mt_chess_mem.h"
+
+size_t mt_chess_record_get_size(struct mt_chess_game const * const game)
+{
+    assert(game != NULL);
+    assert(game->ply <= MT_CHESS_RECORD_MAX_PLIES);
+
+    return MT_CHESS_RECORD_HEADER_SIZE + (size_t)game->ply;
+}
+
+size_t mt_chess_record_write(
+    struct mt_chess_game const * const game,
+    struct mt_chess_record_header const * const header,
+    uint8_t * const out_buf)
+{
+    assert(game != NULL);
+    assert(game->ply <= MT_CHESS_RECORD_MAX_PLIES);
+    assert(header != NULL);
+    assert(out_buf != NULL);
+
+    out_buf[0] = MT_CHESS_RECORD_VERSION;
+    out_buf[1] = header->result;
+    out_buf[2] = header->termination;
+    out_buf[3] = 0;
+    mt_chess_le_write_u16(out_buf + 4, (uint16_t)game->ply);
+    mt_chess_le_write_u16(out_buf + 6, 0);
+    mt_chess_le_write_u32(out_buf + 8, header->time_ms[0]);
+    mt_chess_le_write_u32(out_buf + 12, header->time_ms[1]);
+
+    // Replay the logged moves from the start, to get their indices:
+
+    struct mt_chess_data data;
+    struct mt_chess_move_list list;
+    struct mt_chess_log_node const * node = game->log;
+
+    mt_chess_data_init(&data);
+    for(int ply = 0; ply < game->ply; ++ply)
+    {
+        assert(node != NULL);
+
+        int index = 0;
+
+        mt_chess_movegen_get_legal(&data, &list);
+        while(list.moves[index] != node->move)
+        {
+            ++index;
+            assert(index < list.count); // Logged moves are legal.
+        }
+        out_buf[MT_CHESS_RECORD_HEADER_SIZE + ply] = (uint8_t)index;
+
+        mt_chess_data_apply_move(&data, node->move, NULL);
+        node = node->next;
+    }
+    return MT_CHESS_RECORD_HEADER_SIZE + (size_t)game->ply;
+}
+
+size_t mt_chess_record_read(
+    uint8_t const * const buf,
+    size_t const size,
+    struct mt_chess_game * const game,
+    struct mt_chess_record_header * const out_header)
+{
+    assert(buf != NULL);
+    assert(game != NULL);
+    assert(out_header != NULL);
+
+    if(size < MT_CHESS_RECORD_HEADER_SIZE
+        || buf[0] != MT_CHESS_RECORD_VERSION
+        || (uint8_t)mt_chess_record_result_draw < buf[1]
+        || (uint8_t)mt_chess_record_termination_adjudication < buf[2])
+    {
+        return 0;
+    }
+
+    out_header->result = buf[1];
+    out_header->termination = buf[2];
+    out_header->ply_count = mt_chess_le_read_u16(buf + 4);
+    out_header->time_ms[0] = mt_chess_le_read_u32(buf + 8);
+    out_header->time_ms[1] = mt_chess_le_read_u32(buf + 12);
+
+    size_t const ret_val =
+        MT_CHESS_RECORD_HEADER_SIZE + (size_t)out_header->ply_count;
+
+    if(size < ret_val)
+    {
+        return 0; // Truncated.
+    }
+
+    struct mt_chess_move_list list;
+
+    mt_chess_game_reset(game);
+    for(size_t i = MT_CHESS_RECORD_HEADER_SIZE; i < ret_val; ++i)
+    {
+        mt_chess_movegen_get_legal(&game->data, &list);
+        if(list.count <= (int)buf[i])
+        {
+            return 0; // No such move.
+        }
+        mt_chess_game_do_move(game, list.moves[buf[i]]);
+    }
+    return ret_val;
+}
+
+bool mt_chess_record_append(
+    char const * const path,
+    struct mt_chess_game const * const game,
+    struct mt_chess_record_header const * const header)
+{
+    assert(path != NULL);
+
+    size_t const size = mt_chess_record_get_size(game);
+    uint8_t * const buf = (uint8_t *)mt_chess_mem_alloc(size);
+
+    mt_chess_record_write(game, header, buf);
+
+    FILE * const file = fopen(path, "ab");
+    bool ret_val = false;
+
+    if(file != NULL)
+    {
+        ret_val = fwrite(buf, 1, size, file) == size;
+        ret_val = fclose(file) == 0 && ret_val;
+    }
+    mt_chess_mem_free(buf);
+    return ret_val;
+}
@@ -0,0 +1,126 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_RECORD
+#define MT_CHESS_RECORD
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_game.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Compact binary game record, to be appended to a file one after another:
+//
+// - Header of MT_CHESS_RECORD_HEADER_SIZE bytes (little-endian):
+//
+//   - Byte       0: Format version (MT_CHESS_RECORD_VERSION).
+//   - Byte       1: Result (enum mt_chess_record_result).
+//   - Byte       2: Termination (enum mt_chess_record_termination).
+//   - Byte       3: Reserved (0).
+//   - Bytes  4 -  5: Count of moves (plies) following the header.
+//   - Bytes  6 -  7: Reserved (0).
+//   - Bytes  8 - 11: Milliseconds used by white.
+//   - Bytes 12 - 15: Milliseconds used by black.
+//
+// - Followed by one byte per move, which is the index of the move in the list
+//   of legal moves generated by mt_chess_movegen_get_legal() for the position
+//   before the move (there are never more than 256 legal moves).
+// - Games always start at the initial position.
+// - Changing the order of the generated moves requires a new format version.
+
+#define MT_CHESS_RECORD_VERSION 1
+#define MT_CHESS_RECORD_HEADER_SIZE 16
+
+// Longest game a record can hold:
+//
+#define MT_CHESS_RECORD_MAX_PLIES 0xFFFF
+
+enum mt_chess_record_result
+{
+    mt_chess_record_result_unknown = 0, // (e.g. game not finished)
+    mt_chess_record_result_white = 1,
+    mt_chess_record_result_black = 2,
+    mt_chess_record_result_draw = 3
+};
+
+// The first values equal the ones of enum mt_chess_game_state.
+//
+enum mt_chess_record_termination
+{
+    mt_chess_record_termination_none = 0,
+    mt_chess_record_termination_checkmate = 1,
+    mt_chess_record_termination_stalemate = 2,
+    mt_chess_record_termination_fifty_moves = 3,
+    mt_chess_record_termination_repetition = 4,
+    mt_chess_record_termination_insufficient_material = 5,
+    mt_chess_record_termination_resignation = 6,
+    mt_chess_record_termination_time = 7,
+    mt_chess_record_termination_adjudication = 8
+};
+
+struct mt_chess_record_header
+{
+    uint8_t result; // Holds value of enumeration mt_chess_record_result.
+
+    // Holds value of enumeration mt_chess_record_termination.
+    uint8_t termination;
+
+    uint16_t ply_count;
+    uint32_t time_ms[2]; // Indexed by enum mt_chess_color.
+};
+
+/**
+ * - Returns the size of the record of given game, which holds the moves
+ *   leading to the current position (not moves taken back).
+ */
+size_t mt_chess_record_get_size(struct mt_chess_game const * const game);
+
+/**
+ * - Writes the record of given game to given buffer, which must hold
+ *   mt_chess_record_get_size() bytes.
+ * - Takes result, termination and times from given header (the count of moves
+ *   is taken from the game).
+ * - Returns the count of bytes written.
+ */
+size_t mt_chess_record_write(
+    struct mt_chess_game const * const game,
+    struct mt_chess_record_header const * const header,
+    uint8_t * const out_buf);
+
+/**
+ * - Reads a record from given buffer of given size and replays its moves
+ *   into given game (which gets reset, first).
+ * - Returns the count of bytes read (the size of the record) or 0, if the
+ *   buffer does not start with a valid record (the game is undefined, then).
+ */
+size_t mt_chess_record_read(
+    uint8_t const * const buf,
+    size_t const size,
+    struct mt_chess_game * const game,
+    struct mt_chess_record_header * const out_header);
+
+/**
+ * - Appends the record of given game to the file with given path, creating
+ *   the file, if it does not exist.
+ * - Returns false on error.
+ */
+bool mt_chess_record_append(
+    char const * const path,
+    struct mt_chess_game const * const game,
+    struct mt_chess_record_header const * const header);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_RECORD
@@ -0,0 +1,147 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_sample.h"
+#include "mt_chess_data.h"
+#include "mt_chess_piece.h"
+#include "mt_chess_color.h"
+#include "mt_chess_type.h"
+#include "mt_chess_zobrist.h"
+#include "mt_chess_le.h"
+
+static int const s_square_count = 8 * 8;
+
+// Offsets of the fields (see mt_chess_sample.h):
+//
+static int const s_occupied_offset = 0;
+static int const s_pieces_offset = 8;
+static int const s_state_offset = 24;
+static int const s_en_passant_offset = 25;
+static int const s_halfmove_clock_offset = 26;
+static int const s_score_offset = 28;
+static int const s_result_offset = 30;
+
+void mt_chess_sample_write(
+    struct mt_chess_data const * const data,
+    int const score,
+    enum mt_chess_sample_result const result,
+    uint8_t * const out_buf)
+{
+    assert(data != NULL);
+    assert(INT16_MIN <= score && score <= INT16_MAX);
+    assert(out_buf != NULL);
+
+    uint64_t occupied = 0;
+    int count = 0;
+
+    for(int i = 0; i < MT_CHESS_SAMPLE_SIZE; ++i)
+    {
+        out_buf[i] = 0;
+    }
+    for(int index = 0; index < s_square_count; ++index)
+    {
+        uint8_t const id = data->board[index];
+
+        if(id == 0)
+        {
+            continue;
+        }
+
+        struct mt_chess_piece const * const piece =
+            data->pieces + mt_chess_piece_get_index(data->pieces, id);
+        uint8_t const nibble = (uint8_t)(piece->type | piece->color << 3);
+
+        assert(count < 2 * 2 * 8);
+
+        occupied |= 1ULL << index;
+        out_buf[s_pieces_offset + count / 2] |=
+            (uint8_t)(count % 2 == 0 ? nibble : nibble << 4);
+        ++count;
+    }
+    mt_chess_le_write_u64(out_buf + s_occupied_offset, occupied);
+
+    out_buf[s_state_offset] = (uint8_t)(data->turn | data->castling << 1);
+    out_buf[s_en_passant_offset] = data->en_passant;
+    out_buf[s_halfmove_clock_offset] = data->halfmove_clock < 0xFF
+        ? (uint8_t)data->halfmove_clock : 0xFF;
+    mt_chess_le_write_u16(
+        out_buf + s_score_offset, (uint16_t)(int16_t)score);
+    out_buf[s_result_offset] = (uint8_t)result;
+}
+
+bool mt_chess_sample_read(
+    uint8_t const * const buf,
+    struct mt_chess_data * const out_data,
+    int * const out_score,
+    enum mt_chess_sample_result * const out_result)
+{
+    assert(buf != NULL);
+    assert(out_data != NULL);
+    assert(out_score != NULL);
+    assert(out_result != NULL);
+
+    uint64_t const occupied = mt_chess_le_read_u64(buf + s_occupied_offset);
+    int8_t squares[8 * 8];
+    int count = 0;
+
+    for(int index = 0; index < s_square_count; ++index)
+    {
+        if((occupied >> index & 1) == 0)
+        {
+            squares[index] = 0;
+            continue;
+        }
+        if(count == 2 * 2 * 8)
+        {
+            return false;
+        }
+
+        uint8_t const byte = buf[s_pieces_offset + count / 2];
+        int const nibble = count % 2 == 0 ? byte & 0xF : byte >> 4;
+        int const type = nibble & 7;
+
+        if((int)mt_chess_type_queen < type)
+        {
+            return false;
+        }
+        squares[index] = (int8_t)(nibble >> 3 == 0 ? type + 1 : -(type + 1));
+        ++count;
+    }
+    if(!mt_chess_data_set_pieces(out_data, squares))
+    {
+        return false;
+    }
+
+    uint8_t const state = buf[s_state_offset];
+
+    out_data->turn = (uint8_t)(state & 1);
+    out_data->castling = (uint8_t)(state >> 1);
+    out_data->en_passant = buf[s_en_passant_offset];
+    out_data->halfmove_clock = buf[s_halfmove_clock_offset];
+    out_data->ply = out_data->turn;
+    if(0xF < out_data->castling
+        || (out_data->en_passant != MT_CHESS_DATA_NO_EN_PASSANT
+            && s_square_count <= (int)out_data->en_passant)
+        || (int)mt_chess_sample_result_win < (int)buf[s_result_offset])
+    {
+        return false;
+    }
+    out_data->hash = mt_chess_zobrist_get(out_data);
+    out_data->pawn_hash = mt_chess_zobrist_get_pawns(out_data);
+    mt_chess_data_update_check(out_data);
+
+    *out_score = (int)(int16_t)mt_chess_le_read_u16(buf + s_score_offset);
+    *out_result = (enum mt_chess_sample_result)buf[s_result_offset];
+    return true;
+}
@@ -0,0 +1,76 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_SAMPLE
+#define MT_CHESS_SAMPLE
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_data.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Training sample: A position labeled with its search score and the result
+// of the game it was reached in, of fixed size (MT_CHESS_SAMPLE_SIZE bytes,
+// little-endian), so a file of samples can be read at any offset:
+//
+// - Bytes  0 -  7: Occupied squares (bit n set for board index n, with index
+//                  0 = a8 and 63 = h1).
+// - Bytes  8 - 23: Four bits per occupied square, in the order of the board
+//                  indices (low bits first): The piece's type (enumeration
+//                  mt_chess_type) plus 8 for black. Unused bits are 0.
+// - Byte       24: Turn (bit 0, enumeration mt_chess_color) and castling
+//                  rights (bits 1 - 4, see MT_CHESS_DATA_CASTLING_*).
+// - Byte       25: "En passant" square (see mt_chess_data.en_passant).
+// - Byte       26: Half-move clock (at most 255).
+// - Byte       27: Reserved (0).
+// - Bytes 28 - 29: Score in centipawns from the view of the player having the
+//                  turn (signed, see mt_chess_search_result.score).
+// - Byte       30: Result from the view of the player having the turn
+//                  (enumeration mt_chess_sample_result).
+// - Byte       31: Reserved (0).
+
+#define MT_CHESS_SAMPLE_SIZE 32
+
+enum mt_chess_sample_result
+{
+    mt_chess_sample_result_loss = 0,
+    mt_chess_sample_result_draw = 1,
+    mt_chess_sample_result_win = 2
+};
+
+/**
+ * - Writes the sample of given position with given score and result to given
+ *   buffer, which must hold MT_CHESS_SAMPLE_SIZE bytes.
+ */
+void mt_chess_sample_write(
+    struct mt_chess_data const * const data,
+    int const score,
+    enum mt_chess_sample_result const result,
+    uint8_t * const out_buf);
+
+/**
+ * - Reads the sample in given buffer of MT_CHESS_SAMPLE_SIZE bytes into given
+ *   position, score and result.
+ * - The ply of the position is not stored (set to 0 or 1 by the turn).
+ * - Returns false, if the buffer does not hold a valid sample (the position
+ *   is undefined, then).
+ */
+bool mt_chess_sample_read(
+    uint8_t const * const buf,
+    struct mt_chess_data * const out_data,
+    int * const out_score,
+    enum mt_chess_sample_result * const out_result);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_SAMPLE
@@ -0,0 +1,370 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_san.h"
+#include "mt_chess_data.h"
+#include "mt_chess_movegen.h"
+#include "mt_chess_move.h"
+#include "mt_chess_piece.h"
+#include "mt_chess_type.h"
+
+static int const s_row_len = 8;
+
+// Indexed by enum mt_chess_type (no letter for pawns):
+//
+static char const s_letters[6] = { 'K', '\0', 'N', 'B', 'R', 'Q' };
+
+// Longest SAN accepted by the parser, without suffixes, e.g. "Qh4xe1" or
+// "Qh4-e1" (or "exd8=Q"):
+//
+static int const s_max_len = 6;
+
+static enum mt_chess_type get_type(
+    struct mt_chess_data const * const data, int const index)
+{
+    uint8_t const id = data->board[index];
+
+    assert(id != 0);
+    return (enum mt_chess_type)data->pieces[
+        mt_chess_piece_get_index(data->pieces, id)].type;
+}
+
+/**
+ * - Returns the piece type of given SAN letter or -1, if there is none.
+ */
+static int get_letter_type(char const letter)
+{
+    for(int type = 0; type < 6; ++type)
+    {
+        if(s_letters[type] != '\0' && s_letters[type] == letter)
+        {
+            return type;
+        }
+    }
+    return -1;
+}
+
+/**
+ * - Writes file and rank of the square at given board index.
+ */
+static int add_square(char * const out_str, int const index)
+{
+    out_str[0] = (char)('a' + index % s_row_len);
+    out_str[1] = (char)('8' - index / s_row_len); // (row 0 is rank 8)
+    return 2;
+}
+
+/**
+ * - Writes the file and/or rank of the from-square of given move, if needed
+ *   to tell it apart from other legal moves of pieces of the same type to the
+ *   same square.
+ */
+static int add_disambiguation(
+    struct mt_chess_data const * const data,
+    struct mt_chess_move_list const * const list,
+    uint16_t const move,
+    enum mt_chess_type const type,
+    char * const out_str)
+{
+    int const from = mt_chess_move_get_from(move);
+    int const to = mt_chess_move_get_to(move);
+    bool ambiguous = false;
+    bool same_file = false;
+    bool same_rank = false;
+
+    for(int i = 0; i < list->count; ++i)
+    {
+        int const other = mt_chess_move_get_from(list->moves[i]);
+
+        if(other == from
+            || mt_chess_move_get_to(list->moves[i]) != to
+            || get_type(data, other) != type)
+        {
+            continue;
+        }
+        ambiguous = true;
+        same_file = same_file || other % s_row_len == from % s_row_len;
+        same_rank = same_rank || other / s_row_len == from / s_row_len;
+    }
+
+    int ret_val = 0;
+
+    if(!ambiguous)
+    {
+        return 0;
+    }
+    if(!same_file)
+    {
+        out_str[ret_val++] = (char)('a' + from % s_row_len);
+        return ret_val;
+    }
+    if(!same_rank)
+    {
+        out_str[ret_val++] = (char)('8' - from / s_row_len);
+        return ret_val;
+    }
+    return add_square(out_str, from);
+}
+
+void mt_chess_san_get_str(
+    struct mt_chess_data const * const data,
+    struct mt_chess_move_list const * const list,
+    uint16_t const move,
+    char * const out_str)
+{
+    assert(data != NULL);
+    assert(list != NULL);
+    assert(out_str != NULL);
+
+    int const from = mt_chess_move_get_from(move);
+    int const to = mt_chess_move_get_to(move);
+    enum mt_chess_move_special const special = mt_chess_move_get_special(move);
+    enum mt_chess_type const type = get_type(data, from);
+    bool const capture = data->board[to] != 0
+        || special == mt_chess_move_special_en_passant;
+    int i = 0;
+
+    if(special == mt_chess_move_special_castling)
+    {
+        out_str[i++] = 'O';
+        out_str[i++] = '-';
+        out_str[i++] = 'O';
+        if(to < from)
+        {
+            out_str[i++] = '-'; // Queenside.
+            out_str[i++] = 'O';
+        }
+    }
+    else if(type == mt_chess_type_pawn)
+    {
+        if(capture)
+        {
+            out_str[i++] = (char)('a' + from % s_row_len);
+            out_str[i++] = 'x';
+        }
+        i += add_square(out_str + i, to);
+        if(special == mt_chess_move_special_promotion)
+        {
+            out_str[i++] = '=';
+            out_str[i++] = s_letters[mt_chess_move_get_promotion(move)];
+        }
+    }
+    else
+    {
+        out_str[i++] = s_letters[type];
+        i += add_disambiguation(data, list, move, type, out_str + i);
+        if(capture)
+        {
+            out_str[i++] = 'x';
+        }
+        i += add_square(out_str + i, to);
+    }
+
+    // Check or mate suffix:
+
+    struct mt_chess_data child = *data;
+
+    mt_chess_data_apply_move(&child, move, NULL);
+    if(child.check.checkers != 0)
+    {
+        struct mt_chess_move_list child_list;
+
+        mt_chess_movegen_get_legal(&child, &child_list);
+        out_str[i++] = child_list.count == 0 ? '#' : '+';
+    }
+
+    assert(i < MT_CHESS_SAN_STR_SIZE);
+    out_str[i] = '\0';
+}
+
+/**
+ * - Returns the castling move to the king's destination column from given
+ *   list or 0, if there is none.
+ */
+static uint16_t find_castling(
+    struct mt_chess_move_list const * const list, int const to_col)
+{
+    for(int i = 0; i < list->count; ++i)
+    {
+        uint16_t const move = list->moves[i];
+
+        if(mt_chess_move_get_special(move) == mt_chess_move_special_castling
+            && mt_chess_move_get_to(move) % s_row_len == to_col)
+        {
+            return move;
+        }
+    }
+    return 0;
+}
+
+static bool is_castling_str(
+    char const * const str, int const len, int const count)
+{
+    if(len != 2 * count + 1)
+    {
+        return false;
+    }
+    for(int i = 0; i < len; ++i)
+    {
+        if(i % 2 == 0 ? str[i] != 'O' && str[i] != '0' : str[i] != '-')
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint16_t mt_chess_san_find_str(
+    char const * const str,
+    struct mt_chess_data const * const data,
+    struct mt_chess_move_list const * const list)
+{
+    assert(str != NULL);
+    assert(data != NULL);
+    assert(list != NULL);
+
+    // Length without check or mate suffix and annotations:
+
+    int len = 0;
+
+    while(str[len] != '\0')
+    {
+        if(s_max_len + 4 < len)
+        {
+            return 0; // Too long.
+        }
+        ++len;
+    }
+    while(0 < len
+        && (str[len - 1] == '+' || str[len - 1] == '#'
+            || str[len - 1] == '!' || str[len - 1] == '?'))
+    {
+        --len;
+    }
+
+    if(is_castling_str(str, len, 1))
+    {
+        return find_castling(list, 6);
+    }
+    if(is_castling_str(str, len, 2))
+    {
+        return find_castling(list, 2);
+    }
+    if(len < 2 || s_max_len < len)
+    {
+        return 0;
+    }
+
+    // Piece type (pawn, if no letter):
+
+    int first = 0;
+    int type = get_letter_type(str[0]);
+
+    if(type == -1)
+    {
+        type = (int)mt_chess_type_pawn;
+    }
+    else
+    {
+        first = 1;
+    }
+
+    // Promotion:
+
+    int promotion = -1;
+
+    if(type == (int)mt_chess_type_pawn && get_letter_type(str[len - 1]) != -1)
+    {
+        promotion = get_letter_type(str[len - 1]);
+        --len;
+        if(str[len - 1] == '=')
+        {
+            --len;
+        }
+        if(promotion == (int)mt_chess_type_king)
+        {
+            return 0;
+        }
+    }
+
+    // Destination square:
+
+    if(len - first < 2
+        || str[len - 2] < 'a' || 'h' < str[len - 2]
+        || str[len - 1] < '1' || '8' < str[len - 1])
+    {
+        return 0;
+    }
+
+    int const to =
+        ('8' - str[len - 1]) * s_row_len + (str[len - 2] - 'a');
+
+    // Disambiguation (file and/or rank of the from-square), capture and
+    // long algebraic notation's separator:
+
+    int from_col = -1;
+    int from_row = -1;
+
+    for(int i = first; i < len - 2; ++i)
+    {
+        char const c = str[i];
+
+        if('a' <= c && c <= 'h' && from_col == -1 && from_row == -1)
+        {
+            from_col = c - 'a';
+            continue;
+        }
+        if('1' <= c && c <= '8' && from_row == -1)
+        {
+            from_row = '8' - c;
+            continue;
+        }
+        if((c == 'x' || c == '-') && i == len - 3)
+        {
+            continue;
+        }
+        return 0;
+    }
+
+    uint16_t ret_val = 0;
+
+    for(int i = 0; i < list->count; ++i)
+    {
+        uint16_t const move = list->moves[i];
+        int const from = mt_chess_move_get_from(move);
+        enum mt_chess_move_special const special =
+            mt_chess_move_get_special(move);
+
+        if(mt_chess_move_get_to(move) != to
+            || special == mt_chess_move_special_castling
+            || (from_col != -1 && from % s_row_len != from_col)
+            || (from_row != -1 && from / s_row_len != from_row)
+            || (int)get_type(data, from) != type)
+        {
+            continue;
+        }
+        if(special == mt_chess_move_special_promotion
+            ? (int)mt_chess_move_get_promotion(move) != promotion
+            : promotion != -1)
+        {
+            continue;
+        }
+        if(ret_val != 0)
+        {
+            return 0; // Ambiguous.
+        }
+        ret_val = move;
+    }
+    return ret_val;
+}
@@ -0,0 +1,57 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_SAN
+#define MT_CHESS_SAN
+
+#ifdef __cplusplus
+    #include <cstdint>
+#else //__cplusplus
+    #include <stdint.h>
+#endif //__cplusplus
+
+#include "mt_chess_data.h"
+#include "mt_chess_movegen.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Standard algebraic notation (SAN), e.g. "Nbd7", "exd6", "O-O-O" or
+// "e8=Q+". Neither function allocates memory.
+
+// Size of the longest SAN of a move, e.g. "Qh4xe1+" or "exd8=Q#", plus
+// terminator.
+//
+#define MT_CHESS_SAN_STR_SIZE 8
+
+/**
+ * - Writes the SAN of given legal move of given position to given buffer,
+ *   which must hold MT_CHESS_SAN_STR_SIZE characters.
+ * - Given list must hold the legal moves of the position (for the
+ *   disambiguation, which is as short as possible).
+ * - Adds "+" or "#", if the move gives check or mate.
+ */
+void mt_chess_san_get_str(
+    struct mt_chess_data const * const data,
+    struct mt_chess_move_list const * const list,
+    uint16_t const move,
+    char * const out_str);
+
+/**
+ * - Returns the move from given list of legal moves of given position, which
+ *   is given in SAN by given string.
+ * - Tolerates superfluous disambiguation, missing check or mate suffixes,
+ *   annotations (e.g. "!?"), "0-0" for castling, a promotion without "="
+ *   and long algebraic notation (e.g. "Ng1-f3").
+ * - Returns 0 (invalid move), if not found, ambiguous or string is invalid.
+ */
+uint16_t mt_chess_san_find_str(
+    char const * const str,
+    struct mt_chess_data const * const data,
+    struct mt_chess_move_list const * const list);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_SAN
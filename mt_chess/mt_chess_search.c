@@ -0,0 +1,673 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_search.h"
+#include "mt_chess_data.h"
+#include "mt_chess_movegen.h"
+#include "mt_chess_move.h"
+#include "mt_chess_eval.h"
+#include "mt_chess_piece.h"
+#include "mt_chess_type.h"
+#include "mt_chess_clock.h"
+#include "mt_chess_latency.h"
+#include "mt_chess_trace.h"
+
+// Bigger than any score:
+static int const s_infinity = MT_CHESS_SEARCH_MATE + 1;
+
+/**
+ * - State of one search (there is no global state).
+ */
+struct search
+{
+    uint64_t nodes;
+    uint64_t max_nodes; // 0 = no limit.
+    uint64_t start_ns;
+    uint64_t max_ns; // 0 = no limit.
+    bool (*is_stopped)(void * const ctx, uint64_t const nodes); // (or NULL)
+    void * ctx;
+    bool aborted;
+
+    // Nodes spent on the best move at the root in the current iteration:
+    //
+    uint64_t best_move_nodes;
+
+    // Principal variation of each ply (triangular, the variation of a ply
+    // being the best move followed by the variation of the next ply):
+    //
+    uint16_t pv[MT_CHESS_SEARCH_MAX_DEPTH + 1][MT_CHESS_SEARCH_MAX_DEPTH];
+    int pv_len[MT_CHESS_SEARCH_MAX_DEPTH + 1];
+};
+
+/**
+ * - A best move with its exact score and principal variation.
+ */
+struct line
+{
+    uint16_t pv[MT_CHESS_SEARCH_MAX_DEPTH];
+    int pv_len;
+    int score;
+};
+
+// Count of nodes between two time and stop checks (must be a power of two).
+//
+#define MT_SEARCH_TIME_CHECK_NODES 1024
+
+static bool is_aborted(struct search * const search)
+{
+    if(search->max_nodes != 0 && search->max_nodes <= search->nodes)
+    {
+        search->aborted = true;
+    }
+    if((search->nodes & (MT_SEARCH_TIME_CHECK_NODES - 1)) == 0)
+    {
+        if(search->max_ns != 0
+            && search->max_ns <= mt_chess_clock_get_ns() - search->start_ns)
+        {
+            search->aborted = true;
+        }
+        if(search->is_stopped != NULL
+            && search->is_stopped(search->ctx, search->nodes))
+        {
+            search->aborted = true;
+        }
+    }
+    return search->aborted;
+}
+
+/**
+ * - Makes given move followed by the variation of the next ply the variation
+ *   of given ply.
+ */
+static void update_pv(
+    struct search * const search, int const ply, uint16_t const move)
+{
+    assert(ply < MT_CHESS_SEARCH_MAX_DEPTH);
+
+    uint16_t * const pv = search->pv[ply];
+    uint16_t const * const next = search->pv[ply + 1];
+    int const next_len = search->pv_len[ply + 1];
+
+    assert(next_len < MT_CHESS_SEARCH_MAX_DEPTH - ply);
+
+    pv[0] = move;
+    for(int i = 0; i < next_len; ++i)
+    {
+        pv[i + 1] = next[i];
+    }
+    search->pv_len[ply] = next_len + 1;
+}
+
+/**
+ * - Returns a key to sort moves by (higher first): Catches of valuable pieces
+ *   by cheap pieces first (MVV-LVA), promotions and quiet moves follow.
+ */
+static int get_order_key(
+    struct mt_chess_data const * const data, uint16_t const move)
+{
+    int const from_index = mt_chess_move_get_from(move);
+    int const to_index = mt_chess_move_get_to(move);
+    enum mt_chess_move_special const special = mt_chess_move_get_special(move);
+    struct mt_chess_piece const * const piece = data->pieces
+        + mt_chess_piece_get_index(data->pieces, data->board[from_index]);
+    int ret_val = 0;
+
+    if(special == mt_chess_move_special_en_passant)
+    {
+        ret_val = 10 * mt_chess_eval_get_value(mt_chess_type_pawn);
+    }
+    else
+    {
+        uint8_t const caught_id = data->board[to_index];
+
+        if(caught_id != 0)
+        {
+            ret_val = 10 * mt_chess_eval_get_value(
+                (enum mt_chess_type)data->pieces[
+                    mt_chess_piece_get_index(data->pieces, caught_id)].type);
+        }
+    }
+    if(ret_val != 0)
+    {
+        ret_val -= mt_chess_eval_get_value((enum mt_chess_type)piece->type)
+            / 10;
+    }
+    if(special == mt_chess_move_special_promotion)
+    {
+        ret_val += mt_chess_eval_get_value(mt_chess_move_get_promotion(move));
+    }
+    return ret_val;
+}
+
+/**
+ * - Returns true, if given move catches or promotes.
+ */
+static bool is_noisy(
+    struct mt_chess_data const * const data, uint16_t const move)
+{
+    enum mt_chess_move_special const special = mt_chess_move_get_special(move);
+
+    return special == mt_chess_move_special_promotion
+        || special == mt_chess_move_special_en_passant
+        || data->board[mt_chess_move_get_to(move)] != 0;
+}
+
+/**
+ * - Sorts given moves by their keys (see get_order_key()), but puts given
+ *   first move first, if it is in the list.
+ */
+static void sort_moves(
+    struct mt_chess_data const * const data,
+    struct mt_chess_move_list * const list,
+    uint16_t const first)
+{
+    int keys[MT_CHESS_MOVE_LIST_MAX];
+
+    for(int i = 0; i < list->count; ++i)
+    {
+        keys[i] = list->moves[i] == first
+            ? s_infinity : get_order_key(data, list->moves[i]);
+    }
+
+    // Insertion sort (lists are short and often almost sorted):
+    //
+    for(int i = 1; i < list->count; ++i)
+    {
+        int const key = keys[i];
+        uint16_t const move = list->moves[i];
+        int j = i - 1;
+
+        while(0 <= j && keys[j] < key)
+        {
+            keys[j + 1] = keys[j];
+            list->moves[j + 1] = list->moves[j];
+            --j;
+        }
+        keys[j + 1] = key;
+        list->moves[j + 1] = move;
+    }
+}
+
+static int quiesce(
+    struct search * const search,
+    struct mt_chess_data const * const data,
+    int alpha,
+    int const beta,
+    int const ply)
+{
+    ++search->nodes;
+    if(is_aborted(search))
+    {
+        return 0; // (ignored)
+    }
+
+    bool const in_check = data->check.checkers != 0;
+    struct mt_chess_move_list list;
+
+    mt_chess_movegen_get_legal(data, &list);
+    if(list.count == 0)
+    {
+        return in_check ? -MT_CHESS_SEARCH_MATE + ply : 0;
+    }
+
+    int best = -s_infinity;
+
+    if(!in_check) // (must evade, otherwise)
+    {
+        best = mt_chess_eval_get(data); // "Stand pat".
+        if(beta <= best || 2 * MT_CHESS_SEARCH_MAX_DEPTH <= ply)
+        {
+            return best;
+        }
+        if(alpha < best)
+        {
+            alpha = best;
+        }
+    }
+
+    sort_moves(data, &list, 0);
+
+    for(int i = 0; i < list.count; ++i)
+    {
+        if(!in_check && !is_noisy(data, list.moves[i]))
+        {
+            continue;
+        }
+
+        struct mt_chess_data child = *data;
+
+        mt_chess_data_apply_move(&child, list.moves[i], NULL);
+
+        int const score = -quiesce(search, &child, -beta, -alpha, ply + 1);
+
+        if(search->aborted)
+        {
+            return 0; // (ignored)
+        }
+        if(best < score)
+        {
+            best = score;
+            if(alpha < score)
+            {
+                alpha = score;
+                if(beta <= alpha)
+                {
+                    break; // Cut-off.
+                }
+            }
+        }
+    }
+    return best;
+}
+
+/**
+ * - Negamax alpha-beta search (fail-soft).
+ * - Sets best move found, if given pointer is not NULL (at the root).
+ */
+static int search_node(
+    struct search * const search,
+    struct mt_chess_data const * const data,
+    int const depth,
+    int alpha,
+    int const beta,
+    int const ply,
+    uint16_t const first,
+    uint16_t * const out_best)
+{
+    search->pv_len[ply] = 0;
+
+    if(depth <= 0)
+    {
+        return quiesce(search, data, alpha, beta, ply);
+    }
+
+    ++search->nodes;
+    if(is_aborted(search))
+    {
+        return 0; // (ignored)
+    }
+
+    if(0 < ply && 2 * 50 <= data->halfmove_clock)
+    {
+        return 0; // Draw by 50-move rule.
+    }
+
+    struct mt_chess_move_list list;
+
+    mt_chess_movegen_get_legal(data, &list);
+    if(list.count == 0)
+    {
+        return data->check.checkers != 0 ? -MT_CHESS_SEARCH_MATE + ply : 0;
+    }
+
+    sort_moves(data, &list, first);
+
+    int best = -s_infinity;
+
+    for(int i = 0; i < list.count; ++i)
+    {
+        struct mt_chess_data child = *data;
+        uint64_t const nodes_before = search->nodes;
+        MT_CHESS_TRACE_BEGIN_IF(trace_begin, ply == 0);
+
+        mt_chess_data_apply_move(&child, list.moves[i], NULL);
+
+        int const score = -search_node(
+            search, &child, depth - 1, -beta, -alpha, ply + 1, 0, NULL);
+
+        MT_CHESS_TRACE_END(trace_begin, "root_move", list.moves[i]);
+
+        if(search->aborted)
+        {
+            return 0; // (ignored)
+        }
+        if(best < score)
+        {
+            best = score;
+            if(out_best != NULL)
+            {
+                *out_best = list.moves[i];
+                search->best_move_nodes = search->nodes - nodes_before;
+            }
+            if(alpha < score)
+            {
+                alpha = score;
+                update_pv(search, ply, list.moves[i]);
+                if(beta <= alpha)
+                {
+                    break; // Cut-off.
+                }
+            }
+        }
+    }
+    return best;
+}
+
+/**
+ * - Stores given root move followed by the variation of ply 1 with given
+ *   score in given line.
+ */
+static void set_line(
+    struct search const * const search,
+    uint16_t const move,
+    int const score,
+    struct line * const out_line)
+{
+    int const next_len = search->pv_len[1];
+
+    assert(next_len < MT_CHESS_SEARCH_MAX_DEPTH);
+
+    out_line->pv[0] = move;
+    for(int i = 0; i < next_len; ++i)
+    {
+        out_line->pv[i + 1] = search->pv[1][i];
+    }
+    out_line->pv_len = next_len + 1;
+    out_line->score = score;
+}
+
+/**
+ * - Searches the root moves of one iteration of a MultiPV search, keeping
+ *   up to given count of best moves with exact scores in given lines (best
+ *   first).
+ * - Each move is searched with the score of the worst line kept so far as
+ *   lower bound (if there are enough lines), so moves not making it into the
+ *   lines fail low as cheaply as in a normal search.
+ * - Returns the count of lines found (0, if aborted).
+ */
+static int search_root_multi_pv(
+    struct search * const search,
+    struct mt_chess_data const * const data,
+    struct mt_chess_move_list const * const list,
+    int const depth,
+    int const line_count,
+    struct line * const out_lines)
+{
+    assert(1 <= depth);
+    assert(line_count <= list->count);
+
+    int count = 0;
+
+    ++search->nodes;
+    if(is_aborted(search))
+    {
+        return 0;
+    }
+    search->pv_len[0] = 0;
+
+    for(int i = 0; i < list->count; ++i)
+    {
+        int const alpha = count < line_count
+            ? -s_infinity : out_lines[count - 1].score;
+        struct mt_chess_data child = *data;
+        uint64_t const nodes_before = search->nodes;
+
+        mt_chess_data_apply_move(&child, list->moves[i], NULL);
+
+        int const score = -search_node(
+            search, &child, depth - 1, -s_infinity, -alpha, 1, 0, NULL);
+
+        if(search->aborted)
+        {
+            return 0;
+        }
+        if(score <= alpha)
+        {
+            continue; // Not better than the worst line (if enough lines).
+        }
+
+        // Insertion into the lines sorted by score (dropping the worst line,
+        // if there are enough lines):
+
+        int pos = count < line_count ? count++ : line_count - 1;
+
+        while(0 < pos && out_lines[pos - 1].score < score)
+        {
+            out_lines[pos] = out_lines[pos - 1];
+            --pos;
+        }
+        set_line(search, list->moves[i], score, out_lines + pos);
+        if(pos == 0)
+        {
+            search->best_move_nodes = search->nodes - nodes_before;
+        }
+    }
+    return count;
+}
+
+/**
+ * - Moves the first moves of given lines to the front of given list (in the
+ *   order of the lines), for the next iteration to search them first.
+ */
+static void put_lines_first(
+    struct line const * const lines,
+    int const line_count,
+    struct mt_chess_move_list * const list)
+{
+    for(int l = line_count - 1; 0 <= l; --l)
+    {
+        int i = 0;
+
+        while(list->moves[i] != lines[l].pv[0])
+        {
+            ++i;
+            assert(i < list->count);
+        }
+        for(; 0 < i; --i)
+        {
+            list->moves[i] = list->moves[i - 1];
+        }
+        list->moves[0] = lines[l].pv[0];
+    }
+}
+
+/**
+ * - Calls the iteration function of given search for each given line, if
+ *   there is a function.
+ */
+static void report_iteration(
+    struct search const * const search,
+    struct mt_chess_search_limits const * const limits,
+    int const depth,
+    struct line const * const lines,
+    int const line_count)
+{
+    if(limits->on_iteration == NULL)
+    {
+        return;
+    }
+
+    struct mt_chess_search_info info;
+
+    info.nodes = search->nodes;
+    info.time_ns = mt_chess_clock_get_ns() - search->start_ns;
+    info.depth = depth;
+    for(int l = 0; l < line_count; ++l)
+    {
+        info.line = l;
+        info.score = lines[l].score;
+        info.pv_len = lines[l].pv_len;
+        for(int i = 0; i < info.pv_len; ++i)
+        {
+            info.pv[i] = lines[l].pv[i];
+        }
+        limits->on_iteration(limits->ctx, &info);
+    }
+}
+
+void mt_chess_search_init_limits(
+    struct mt_chess_search_limits * const out_limits)
+{
+    assert(out_limits != NULL);
+
+    out_limits->nodes = 0;
+    out_limits->time_ns = 0;
+    out_limits->depth = MT_CHESS_SEARCH_MAX_DEPTH;
+    out_limits->multi_pv = 1;
+    out_limits->timeman = NULL;
+    out_limits->on_iteration = NULL;
+    out_limits->is_stopped = NULL;
+    out_limits->ctx = NULL;
+}
+
+static void get_best(
+    struct mt_chess_data const * const data,
+    struct mt_chess_search_limits const * const limits,
+    struct mt_chess_search_result * const out_result)
+{
+    assert(data != NULL);
+    assert(limits != NULL);
+    assert(1 <= limits->depth && limits->depth <= MT_CHESS_SEARCH_MAX_DEPTH);
+    assert(
+        1 <= limits->multi_pv
+            && limits->multi_pv <= MT_CHESS_SEARCH_MAX_MULTI_PV);
+    assert(out_result != NULL);
+
+    struct search search;
+    struct mt_chess_move_list list;
+    struct line lines[MT_CHESS_SEARCH_MAX_MULTI_PV];
+
+    search.nodes = 0;
+    search.max_nodes = limits->nodes;
+    search.start_ns = mt_chess_clock_get_ns();
+    search.max_ns = limits->time_ns;
+    if(limits->timeman != NULL
+        && (search.max_ns == 0 || limits->timeman->max_ns < search.max_ns))
+    {
+        search.max_ns = limits->timeman->max_ns;
+    }
+    search.is_stopped = limits->is_stopped;
+    search.ctx = limits->ctx;
+    search.aborted = false;
+    search.best_move_nodes = 0;
+
+    out_result->move = 0;
+    out_result->reply = 0;
+    out_result->score = 0;
+    out_result->depth = 0;
+
+    mt_chess_movegen_get_legal(data, &list);
+    if(list.count == 0)
+    {
+        out_result->score = data->check.checkers != 0
+            ? -MT_CHESS_SEARCH_MATE : 0;
+        out_result->nodes = 0;
+        return;
+    }
+    out_result->move = list.moves[0]; // (in case first iteration is aborted)
+
+    int const multi_pv =
+        limits->multi_pv < list.count ? limits->multi_pv : list.count;
+
+    if(1 < multi_pv)
+    {
+        sort_moves(data, &list, 0); // (later iterations sort by the lines)
+    }
+
+    for(int depth = 1; depth <= limits->depth; ++depth)
+    {
+        uint64_t const nodes_before = search.nodes;
+        int line_count = 1;
+        MT_CHESS_TRACE_BEGIN(trace_begin);
+
+        if(multi_pv == 1)
+        {
+            uint16_t best = 0;
+            int const score = search_node(
+                &search,
+                data,
+                depth,
+                -s_infinity,
+                s_infinity,
+                0,
+                out_result->move,
+                &best);
+
+            if(!search.aborted)
+            {
+                assert(best != 0);
+                assert(search.pv_len[0] != 0 && search.pv[0][0] == best);
+
+                search.pv_len[1] = search.pv_len[0] - 1; // (for set_line())
+                for(int i = 1; i < search.pv_len[0]; ++i)
+                {
+                    search.pv[1][i - 1] = search.pv[0][i];
+                }
+                set_line(&search, best, score, lines);
+            }
+        }
+        else
+        {
+            line_count = search_root_multi_pv(
+                &search, data, &list, depth, multi_pv, lines);
+            if(!search.aborted)
+            {
+                assert(line_count == multi_pv);
+
+                put_lines_first(lines, line_count, &list);
+            }
+        }
+
+        MT_CHESS_TRACE_END(trace_begin, "iteration", depth);
+
+        if(search.aborted)
+        {
+            break; // Keeping result of last completed iteration.
+        }
+
+        uint16_t const best = lines[0].pv[0];
+        int const score = lines[0].score;
+
+        out_result->move = best;
+        out_result->reply = 2 <= lines[0].pv_len ? lines[0].pv[1] : 0;
+        out_result->score = score;
+        out_result->depth = depth;
+
+        report_iteration(&search, limits, depth, lines, line_count);
+
+        if(limits->timeman != NULL
+            && (list.count == 1 // (no need to think about a forced move)
+                || mt_chess_timeman_is_done(
+                    limits->timeman,
+                    best,
+                    score,
+                    (int)(search.best_move_nodes * 1000
+                        / (search.nodes - nodes_before)),
+                    mt_chess_clock_get_ns() - search.start_ns)))
+        {
+            break;
+        }
+
+        if(MT_CHESS_SEARCH_MATE - MT_CHESS_SEARCH_MAX_DEPTH <= score
+            || score <= -MT_CHESS_SEARCH_MATE + MT_CHESS_SEARCH_MAX_DEPTH)
+        {
+            break; // Mate found, deeper search would not change anything.
+        }
+    }
+    out_result->nodes = search.nodes;
+}
+
+void mt_chess_search_get_best(
+    struct mt_chess_data const * const data,
+    struct mt_chess_search_limits const * const limits,
+    struct mt_chess_search_result * const out_result)
+{
+    uint64_t const latency_begin = mt_chess_latency_begin();
+    MT_CHESS_TRACE_BEGIN(trace_begin);
+
+    get_best(data, limits, out_result);
+
+    MT_CHESS_TRACE_END(trace_begin, "search", out_result->nodes);
+    mt_chess_latency_end(mt_chess_latency_id_bot_move, latency_begin);
+}
@@ -0,0 +1,128 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_SEARCH
+#define MT_CHESS_SEARCH
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_data.h"
+#include "mt_chess_timeman.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Score of the player having the turn being mated right now. Mate in n plies
+// is scored as MT_CHESS_SEARCH_MATE - n.
+//
+#define MT_CHESS_SEARCH_MATE 30000
+
+// Maximum depth of the full-width search in plies.
+//
+#define MT_CHESS_SEARCH_MAX_DEPTH 64
+
+// Maximum count of lines of a MultiPV search.
+//
+#define MT_CHESS_SEARCH_MAX_MULTI_PV 32
+
+/**
+ * - Progress of a search after a completed iteration, one per line of a
+ *   MultiPV search.
+ */
+struct mt_chess_search_info
+{
+    uint64_t nodes; // Count of nodes visited so far.
+    uint64_t time_ns; // Time searched so far.
+    int depth; // Depth of the iteration.
+    int line; // Index of the line (0 = best line).
+    int score; // See mt_chess_search_result.
+
+    // Principal variation, starting with the best move:
+    //
+    uint16_t pv[MT_CHESS_SEARCH_MAX_DEPTH]; // Packed.
+    int pv_len;
+};
+
+struct mt_chess_search_limits
+{
+    uint64_t nodes; // Maximum count of nodes to visit or 0 (= no limit).
+    uint64_t time_ns; // Maximum time to search or 0 (= no limit).
+    int depth; // Maximum depth in plies (1 to MT_CHESS_SEARCH_MAX_DEPTH).
+
+    // Count of best moves to find exact scores and principal variations for
+    // (1 to MT_CHESS_SEARCH_MAX_MULTI_PV, 1 = normal search). Each iteration
+    // reports one line per move (at most the count of legal moves):
+    //
+    int multi_pv;
+
+    // Optional (may be NULL), initialized time manager of a clocked game.
+    // Stops the search at its hard deadline (or the time limit above, if
+    // earlier) and after the iteration that passed its soft deadline:
+    //
+    struct mt_chess_timeman * timeman;
+
+    // Optional (may be NULL), called by the searching thread after each
+    // completed iteration. The info pointed to is valid during the call, only:
+    //
+    void (*on_iteration)(
+        void * const ctx, struct mt_chess_search_info const * const info);
+
+    // Optional (may be NULL), polled by the searching thread every 1024
+    // nodes with the count of nodes visited so far. The search stops (like
+    // when reaching a limit), as soon as this returns true:
+    //
+    bool (*is_stopped)(void * const ctx, uint64_t const nodes);
+
+    void * ctx; // Given to the functions above.
+};
+
+struct mt_chess_search_result
+{
+    uint64_t nodes; // Count of nodes visited.
+
+    // Centipawns from the point of view of the player having the turn (see
+    // MT_CHESS_SEARCH_MATE for mate scores).
+    int score;
+
+    int depth; // Depth of the last completed iteration.
+
+    uint16_t move; // Packed best move or 0, if there is no legal move.
+
+    // Packed expected reply to the best move (second move of the principal
+    // variation) or 0, if unknown (e.g. after a depth 1 search).
+    uint16_t reply;
+};
+
+/**
+ * - Sets given limits to none (maximum depth, no node or time limit, one
+ *   line) and the time manager and functions to NULL.
+ */
+void mt_chess_search_init_limits(
+    struct mt_chess_search_limits * const out_limits);
+
+/**
+ * - Searches for the best move of the player having the turn with iterative
+ *   deepening alpha-beta and a quiescence search for catches.
+ * - Stops after the iteration of maximum depth or as soon as the maximum
+ *   count of nodes was visited or the maximum time is over (using the best
+ *   move of the last completed iteration) or the search is stopped (see
+ *   mt_chess_search_limits.is_stopped).
+ * - Is reentrant (may be called by multiple threads at once).
+ * - Records its latency as bot move selection (see mt_chess_latency.h).
+ */
+void mt_chess_search_get_best(
+    struct mt_chess_data const * const data,
+    struct mt_chess_search_limits const * const limits,
+    struct mt_chess_search_result * const out_result);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_SEARCH
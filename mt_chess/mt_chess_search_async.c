@@ -0,0 +1,221 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_search_async.h"
+#include "mt_chess_search.h"
+#include "mt_chess_data.h"
+#include "mt_chess_thread.h"
+#include "mt_chess_mem.h"
+
+struct mt_chess_search_async
+{
+    struct mt_chess_thread thread;
+
+    // Protects all members below:
+    struct mt_chess_thread_mutex mutex;
+    struct mt_chess_thread_cond changed; // Signals started and done searches.
+
+    bool pending; // A search was started, but the thread did not take it, yet.
+    bool running; // A search was started and did not complete, yet.
+    bool stop; // The running search shall stop.
+    bool quit; // The thread shall return (after a pending search).
+
+    struct mt_chess_data data;
+    struct mt_chess_search_limits limits; // (with the caller's stop function)
+    void (*on_done)(
+        void * const ctx, struct mt_chess_search_result const * const result);
+};
+
+/**
+ * - Stop function given to the search (calls the caller's one, too).
+ */
+static bool is_stopped(void * const ctx, uint64_t const nodes)
+{
+    struct mt_chess_search_async * const async =
+        (struct mt_chess_search_async *)ctx;
+
+    mt_chess_thread_mutex_lock(&async->mutex);
+
+    bool const ret_val = async->stop;
+
+    mt_chess_thread_mutex_unlock(&async->mutex);
+
+    if(ret_val)
+    {
+        return true;
+    }
+    return async->limits.is_stopped != NULL
+        && async->limits.is_stopped(async->limits.ctx, nodes);
+}
+
+/**
+ * - Iteration function given to the search (calls the caller's one).
+ */
+static void on_iteration(
+    void * const ctx, struct mt_chess_search_info const * const info)
+{
+    struct mt_chess_search_async * const async =
+        (struct mt_chess_search_async *)ctx;
+
+    async->limits.on_iteration(async->limits.ctx, info);
+}
+
+static void run(void * const arg)
+{
+    struct mt_chess_search_async * const async =
+        (struct mt_chess_search_async *)arg;
+
+    while(true)
+    {
+        mt_chess_thread_mutex_lock(&async->mutex);
+        while(!async->pending && !async->quit)
+        {
+            mt_chess_thread_cond_wait(&async->changed, &async->mutex);
+        }
+        if(!async->pending)
+        {
+            assert(async->quit);
+
+            mt_chess_thread_mutex_unlock(&async->mutex);
+            return;
+        }
+        async->pending = false;
+        mt_chess_thread_mutex_unlock(&async->mutex);
+
+        // Position, limits and completion function are not written by other
+        // threads, while the search is running.
+
+        struct mt_chess_search_limits limits = async->limits;
+        struct mt_chess_search_result result;
+
+        limits.on_iteration =
+            async->limits.on_iteration != NULL ? on_iteration : NULL;
+        limits.is_stopped = is_stopped;
+        limits.ctx = async;
+
+        mt_chess_search_get_best(&async->data, &limits, &result);
+
+        async->on_done(async->limits.ctx, &result);
+
+        mt_chess_thread_mutex_lock(&async->mutex);
+        async->running = false;
+        mt_chess_thread_cond_broadcast(&async->changed);
+        mt_chess_thread_mutex_unlock(&async->mutex);
+    }
+}
+
+struct mt_chess_search_async * mt_chess_search_async_create(void)
+{
+    struct mt_chess_search_async * const ret_val =
+        (struct mt_chess_search_async *)mt_chess_mem_alloc(sizeof *ret_val);
+
+    mt_chess_thread_mutex_init(&ret_val->mutex);
+    mt_chess_thread_cond_init(&ret_val->changed);
+    ret_val->pending = false;
+    ret_val->running = false;
+    ret_val->stop = false;
+    ret_val->quit = false;
+    ret_val->on_done = NULL;
+
+    if(!mt_chess_thread_start(&ret_val->thread, run, ret_val))
+    {
+        mt_chess_thread_cond_deinit(&ret_val->changed);
+        mt_chess_thread_mutex_deinit(&ret_val->mutex);
+        mt_chess_mem_free(ret_val);
+        return NULL;
+    }
+    return ret_val;
+}
+
+void mt_chess_search_async_free(struct mt_chess_search_async * const async)
+{
+    assert(async != NULL);
+
+    mt_chess_thread_mutex_lock(&async->mutex);
+    async->stop = true;
+    async->quit = true;
+    mt_chess_thread_cond_broadcast(&async->changed);
+    mt_chess_thread_mutex_unlock(&async->mutex);
+
+    mt_chess_thread_join(&async->thread);
+
+    assert(!async->pending && !async->running);
+
+    mt_chess_thread_cond_deinit(&async->changed);
+    mt_chess_thread_mutex_deinit(&async->mutex);
+    mt_chess_mem_free(async);
+}
+
+bool mt_chess_search_async_start(
+    struct mt_chess_search_async * const async,
+    struct mt_chess_data const * const data,
+    struct mt_chess_search_limits const * const limits,
+    void (*on_done)(
+        void * const ctx, struct mt_chess_search_result const * const result))
+{
+    assert(async != NULL);
+    assert(data != NULL);
+    assert(limits != NULL);
+    assert(on_done != NULL);
+
+    mt_chess_thread_mutex_lock(&async->mutex);
+    if(async->running)
+    {
+        mt_chess_thread_mutex_unlock(&async->mutex);
+        return false;
+    }
+    async->data = *data;
+    async->limits = *limits;
+    async->on_done = on_done;
+    async->stop = false;
+    async->pending = true;
+    async->running = true;
+    mt_chess_thread_cond_broadcast(&async->changed);
+    mt_chess_thread_mutex_unlock(&async->mutex);
+    return true;
+}
+
+void mt_chess_search_async_stop(struct mt_chess_search_async * const async)
+{
+    assert(async != NULL);
+
+    mt_chess_thread_mutex_lock(&async->mutex);
+    async->stop = true;
+    mt_chess_thread_mutex_unlock(&async->mutex);
+}
+
+void mt_chess_search_async_wait(struct mt_chess_search_async * const async)
+{
+    assert(async != NULL);
+
+    mt_chess_thread_mutex_lock(&async->mutex);
+    while(async->running)
+    {
+        mt_chess_thread_cond_wait(&async->changed, &async->mutex);
+    }
+    mt_chess_thread_mutex_unlock(&async->mutex);
+}
+
+bool mt_chess_search_async_is_running(
+    struct mt_chess_search_async * const async)
+{
+    assert(async != NULL);
+
+    mt_chess_thread_mutex_lock(&async->mutex);
+
+    bool const ret_val = async->running;
+
+    mt_chess_thread_mutex_unlock(&async->mutex);
+    return ret_val;
+}
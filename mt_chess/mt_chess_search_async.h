@@ -0,0 +1,80 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_SEARCH_ASYNC
+#define MT_CHESS_SEARCH_ASYNC
+
+#ifdef __cplusplus
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_data.h"
+#include "mt_chess_search.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+/**
+ * - Runs searches (see mt_chess_search_get_best()) on a thread of its own,
+ *   one search at a time, so the caller's thread never blocks on a search.
+ */
+struct mt_chess_search_async;
+
+/**
+ * - Starts the thread, which waits for searches to run.
+ * - Returns NULL, if the thread could not be started.
+ * - Free return value via mt_chess_search_async_free().
+ */
+struct mt_chess_search_async * mt_chess_search_async_create(void);
+
+/**
+ * - Stops a running search (waiting for its completion function to return)
+ *   and the thread.
+ */
+void mt_chess_search_async_free(struct mt_chess_search_async * const async);
+
+/**
+ * - Starts searching a copy of given position with a copy of given limits and
+ *   returns without waiting.
+ * - The iteration function of the limits (if any) reports progress. Given
+ *   completion function gets called with the limits' context and the result
+ *   after the search ended (by itself or via mt_chess_search_async_stop()).
+ *   Both are called by the search thread and must not call
+ *   mt_chess_search_async_start() or mt_chess_search_async_wait().
+ * - The stop function of the limits (if any) is polled, too.
+ * - Returns false and does nothing, if a search is running.
+ */
+bool mt_chess_search_async_start(
+    struct mt_chess_search_async * const async,
+    struct mt_chess_data const * const data,
+    struct mt_chess_search_limits const * const limits,
+    void (*on_done)(
+        void * const ctx, struct mt_chess_search_result const * const result));
+
+/**
+ * - Makes the running search (if any) stop as soon as possible, without
+ *   waiting for that.
+ * - May be called by any thread.
+ */
+void mt_chess_search_async_stop(struct mt_chess_search_async * const async);
+
+/**
+ * - Waits until there is no search running (its completion function
+ *   returned).
+ */
+void mt_chess_search_async_wait(struct mt_chess_search_async * const async);
+
+/**
+ * - Returns true, if a search was started and its completion function did not
+ *   return, yet.
+ */
+bool mt_chess_search_async_is_running(
+    struct mt_chess_search_async * const async);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_SEARCH_ASYNC
@@ -0,0 +1,228 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstddef>
+    #include <cassert>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <assert.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_snapshot.h"
+#include "mt_chess_game.h"
+#include "mt_chess_data.h"
+#include "mt_chess_log_node.h"
+#include "mt_chess_log_pool.h"
+#include "mt_chess_zobrist.h"
+#include "mt_chess_color.h"
+#include "mt_chess_type.h"
+#include "mt_chess_le.h"
+
+static uint8_t const s_magic[4] = { 'M', 'T', 'C', 'S' };
+
+static int const s_square_count = 8 * 8;
+static int const s_piece_count = 2 * 2 * 8;
+
+size_t mt_chess_snapshot_get_size(struct mt_chess_game const * const game)
+{
+    assert(game != NULL);
+
+    return MT_CHESS_SNAPSHOT_HEADER_SIZE
+        + MT_CHESS_SNAPSHOT_POSITION_SIZE
+        + (size_t)game->ply_count * MT_CHESS_SNAPSHOT_MOVE_SIZE;
+}
+
+static void write_position(
+    struct mt_chess_data const * const data, uint8_t * const out_buf)
+{
+    uint8_t * p = out_buf;
+
+    for(int i = 0; i < s_square_count; ++i)
+    {
+        *p++ = data->board[i];
+    }
+    for(int i = 0; i < s_piece_count; ++i)
+    {
+        *p++ = data->pieces[i].color;
+        *p++ = data->pieces[i].type;
+        *p++ = data->pieces[i].id;
+    }
+    *p++ = data->turn;
+    *p++ = data->castling;
+    *p++ = data->en_passant;
+    *p++ = 0;
+    mt_chess_le_write_u16(p, data->halfmove_clock);
+    mt_chess_le_write_u16(p + 2, data->ply);
+    mt_chess_le_write_u64(p + 4, data->hash);
+
+    assert(p + 12 == out_buf + MT_CHESS_SNAPSHOT_POSITION_SIZE);
+}
+
+/**
+ * - Returns false, if given buffer does not hold a valid position.
+ */
+static bool read_position(
+    uint8_t const * const buf, struct mt_chess_data * const data)
+{
+    uint8_t const * p = buf;
+
+    for(int i = 0; i < s_square_count; ++i)
+    {
+        data->board[i] = *p++;
+        if(s_piece_count < (int)data->board[i])
+        {
+            return false;
+        }
+    }
+    for(int i = 0; i < s_piece_count; ++i)
+    {
+        data->pieces[i].color = *p++;
+        data->pieces[i].type = *p++;
+        data->pieces[i].id = *p++;
+        if((int)mt_chess_color_black < (int)data->pieces[i].color
+            || (int)mt_chess_type_queen < (int)data->pieces[i].type
+            || (int)data->pieces[i].id != i + 1)
+        {
+            return false;
+        }
+    }
+    data->turn = *p++;
+    data->castling = *p++;
+    data->en_passant = *p++;
+    ++p; // (reserved)
+    data->halfmove_clock = mt_chess_le_read_u16(p);
+    data->ply = mt_chess_le_read_u16(p + 2);
+    data->hash = mt_chess_le_read_u64(p + 4);
+
+    if((int)mt_chess_color_black < (int)data->turn
+        || 0xF < data->castling
+        || (data->en_passant != MT_CHESS_DATA_NO_EN_PASSANT
+            && s_square_count <= (int)data->en_passant))
+    {
+        return false;
+    }
+    if(mt_chess_zobrist_get(data) != data->hash)
+    {
+        return false; // Corrupted (or written by a different key set).
+    }
+    data->pawn_hash = mt_chess_zobrist_get_pawns(data); // (not stored)
+    mt_chess_data_update_check(data);
+    return true;
+}
+
+size_t mt_chess_snapshot_write(
+    struct mt_chess_game const * const game, uint8_t * const out_buf)
+{
+    assert(game != NULL);
+    assert(out_buf != NULL);
+
+    for(int i = 0; i < 4; ++i)
+    {
+        out_buf[i] = s_magic[i];
+    }
+    mt_chess_le_write_u16(out_buf + 4, MT_CHESS_SNAPSHOT_VERSION);
+    mt_chess_le_write_u16(out_buf + 6, 0);
+    mt_chess_le_write_u32(out_buf + 8, (uint32_t)game->ply_count);
+    mt_chess_le_write_u32(out_buf + 12, (uint32_t)game->ply);
+
+    write_position(&game->data, out_buf + MT_CHESS_SNAPSHOT_HEADER_SIZE);
+
+    uint8_t * p = out_buf
+        + MT_CHESS_SNAPSHOT_HEADER_SIZE + MT_CHESS_SNAPSHOT_POSITION_SIZE;
+
+    for(struct mt_chess_log_node const * node = game->log;
+        node != NULL;
+        node = node->next)
+    {
+        mt_chess_le_write_u16(p, node->move);
+        mt_chess_le_write_u64(p + 2, node->undo.hash);
+        mt_chess_le_write_u16(p + 10, node->undo.halfmove_clock);
+        p[12] = node->undo.captured;
+        p[13] = node->undo.castling;
+        p[14] = node->undo.en_passant;
+        p[15] = 0;
+        p += MT_CHESS_SNAPSHOT_MOVE_SIZE;
+    }
+
+    assert(p == out_buf + mt_chess_snapshot_get_size(game));
+    return (size_t)(p - out_buf);
+}
+
+bool mt_chess_snapshot_read(
+    uint8_t const * const buf,
+    size_t const size,
+    struct mt_chess_game * const game)
+{
+    assert(buf != NULL);
+    assert(game != NULL);
+
+    mt_chess_game_reset(game); // (reuses the log nodes)
+
+    if(size < MT_CHESS_SNAPSHOT_HEADER_SIZE + MT_CHESS_SNAPSHOT_POSITION_SIZE)
+    {
+        return false;
+    }
+    for(int i = 0; i < 4; ++i)
+    {
+        if(buf[i] != s_magic[i])
+        {
+            return false;
+        }
+    }
+
+    uint32_t const ply_count = mt_chess_le_read_u32(buf + 8);
+    uint32_t const ply = mt_chess_le_read_u32(buf + 12);
+
+    if(mt_chess_le_read_u16(buf + 4) != MT_CHESS_SNAPSHOT_VERSION
+        || ply_count < ply
+        || (size - MT_CHESS_SNAPSHOT_HEADER_SIZE
+                - MT_CHESS_SNAPSHOT_POSITION_SIZE)
+            / MT_CHESS_SNAPSHOT_MOVE_SIZE < (size_t)ply_count)
+    {
+        return false;
+    }
+    if(!read_position(buf + MT_CHESS_SNAPSHOT_HEADER_SIZE, &game->data))
+    {
+        mt_chess_game_reset(game);
+        return false;
+    }
+
+    uint8_t const * p =
+        buf + MT_CHESS_SNAPSHOT_HEADER_SIZE + MT_CHESS_SNAPSHOT_POSITION_SIZE;
+
+    for(uint32_t i = 0; i < ply_count; ++i)
+    {
+        struct mt_chess_log_node * const node =
+            mt_chess_log_pool_get(&game->pool);
+
+        node->move = mt_chess_le_read_u16(p);
+        node->undo.hash = mt_chess_le_read_u64(p + 2);
+        node->undo.halfmove_clock = mt_chess_le_read_u16(p + 10);
+        node->undo.captured = p[12];
+        node->undo.castling = p[13];
+        node->undo.en_passant = p[14];
+        p += MT_CHESS_SNAPSHOT_MOVE_SIZE;
+
+        if(game->log == NULL)
+        {
+            game->log = node;
+        }
+        else
+        {
+            game->latest->next = node;
+            node->last = game->latest;
+        }
+        game->latest = node;
+        if(i < ply)
+        {
+            game->current = node;
+        }
+    }
+    game->ply_count = (int)ply_count;
+    game->ply = (int)ply;
+    return true;
+}
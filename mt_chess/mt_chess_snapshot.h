@@ -0,0 +1,78 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_SNAPSHOT
+#define MT_CHESS_SNAPSHOT
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_game.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Snapshot of a live game (e.g. for crash recovery or to move a game to
+// another process), without pointers and independent of the struct layout
+// (all values little-endian):
+//
+// - Header (MT_CHESS_SNAPSHOT_HEADER_SIZE bytes):
+//
+//   - Bytes  0 -  3: "MTCS".
+//   - Bytes  4 -  5: Format version (MT_CHESS_SNAPSHOT_VERSION).
+//   - Bytes  6 -  7: Reserved (0).
+//   - Bytes  8 - 11: Count of logged moves (including moves taken back).
+//   - Bytes 12 - 15: Count of logged moves applied to the position.
+//
+// - Position (MT_CHESS_SNAPSHOT_POSITION_SIZE bytes):
+//
+//   - Bytes   0 -  63: Board (piece IDs).
+//   - Bytes  64 - 159: Pieces (color, type and ID each).
+//   - Bytes 160 - 163: Turn, castling rights, "en passant" square, reserved.
+//   - Bytes 164 - 167: Half-move clock and ply.
+//   - Bytes 168 - 175: Hash.
+//
+// - Followed by MT_CHESS_SNAPSHOT_MOVE_SIZE bytes per logged move (move and
+//   undo record, see struct mt_chess_log_node).
+//
+// - The check information is not stored, but recomputed on restore.
+
+#define MT_CHESS_SNAPSHOT_VERSION 1
+#define MT_CHESS_SNAPSHOT_HEADER_SIZE 16
+#define MT_CHESS_SNAPSHOT_POSITION_SIZE 176
+#define MT_CHESS_SNAPSHOT_MOVE_SIZE 16
+
+size_t mt_chess_snapshot_get_size(struct mt_chess_game const * const game);
+
+/**
+ * - Writes the snapshot of given game to given buffer, which must hold
+ *   mt_chess_snapshot_get_size() bytes.
+ * - Returns the count of bytes written.
+ */
+size_t mt_chess_snapshot_write(
+    struct mt_chess_game const * const game, uint8_t * const out_buf);
+
+/**
+ * - Restores given game from the snapshot in given buffer of given size,
+ *   without replaying moves (reuses the memory of the game's log).
+ * - Returns false, if the buffer does not hold a valid snapshot (e.g.
+ *   truncated, other version or the hash not matching the position). The
+ *   game is reset, then.
+ */
+bool mt_chess_snapshot_read(
+    uint8_t const * const buf,
+    size_t const size,
+    struct mt_chess_game * const game);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_SNAPSHOT
@@ -0,0 +1,70 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstddef>
+    #include <cassert>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <assert.h>
+#endif //__cplusplus
+
+#include "mt_chess_stats.h"
+#include "mt_chess_thread.h"
+
+static char const * const s_names[mt_chess_stats_id_count] = {
+    "try_move",
+    "validate_king",
+    "validate_pawn",
+    "validate_knight",
+    "validate_bishop",
+    "validate_rook",
+    "validate_queen",
+    "check_update",
+    "movegen",
+    "render",
+    "log_do_move",
+    "log_undo",
+    "log_redo",
+    "log_jump",
+    "pawn_hash_hit",
+    "pawn_hash_miss"
+};
+
+char const * mt_chess_stats_get_name(enum mt_chess_stats_id const id)
+{
+    assert(0 <= (int)id && (int)id < (int)mt_chess_stats_id_count);
+
+    return s_names[id];
+}
+
+#ifdef MT_CHESS_STATS_ENABLED
+
+static MT_CHESS_THREAD_LOCAL struct mt_chess_stats s_stats;
+
+void mt_chess_stats_add(enum mt_chess_stats_id const id, uint64_t const begin)
+{
+    assert(0 <= (int)id && (int)id < (int)mt_chess_stats_id_count);
+
+    struct mt_chess_stats_entry * const entry = s_stats.entries + id;
+
+    ++entry->count;
+    entry->ticks += mt_chess_stats_get_ticks() - begin;
+}
+
+void mt_chess_stats_get(struct mt_chess_stats * const out_stats)
+{
+    assert(out_stats != NULL);
+
+    *out_stats = s_stats;
+}
+
+void mt_chess_stats_reset(void)
+{
+    static struct mt_chess_stats const zero = { 0 };
+
+    s_stats = zero;
+}
+
+#endif //MT_CHESS_STATS_ENABLED
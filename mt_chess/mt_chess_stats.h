@@ -0,0 +1,125 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_STATS
+#define MT_CHESS_STATS
+
+#ifdef __cplusplus
+    #include <cstdint>
+#else //__cplusplus
+    #include <stdint.h>
+#endif //__cplusplus
+
+#ifdef MT_CHESS_STATS_ENABLED
+    #ifdef _MSC_VER
+        #include <intrin.h>
+    #endif //_MSC_VER
+    #include "mt_chess_clock.h"
+#endif //MT_CHESS_STATS_ENABLED
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Optional hot-path instrumentation:
+//
+// - Define MT_CHESS_STATS_ENABLED when building the library to enable it.
+// - Otherwise the macros below expand to nothing and the hot paths do not pay
+//   anything (mt_chess_get_stats() just returns false, then).
+// - Counters and timers are per thread, so they need no synchronization. Get
+//   the ones of the calling thread via mt_chess_get_stats().
+
+// The validation IDs are in the order of enum mt_chess_type (see
+// mt_chess/is_move_allowed()).
+//
+enum mt_chess_stats_id
+{
+    mt_chess_stats_id_try_move = 0,
+    mt_chess_stats_id_validate_king = 1,
+    mt_chess_stats_id_validate_pawn = 2,
+    mt_chess_stats_id_validate_knight = 3,
+    mt_chess_stats_id_validate_bishop = 4,
+    mt_chess_stats_id_validate_rook = 5,
+    mt_chess_stats_id_validate_queen = 6,
+    mt_chess_stats_id_check_update = 7,
+    mt_chess_stats_id_movegen = 8,
+    mt_chess_stats_id_render = 9,
+    mt_chess_stats_id_log_do_move = 10,
+    mt_chess_stats_id_log_undo = 11,
+    mt_chess_stats_id_log_redo = 12,
+    mt_chess_stats_id_log_jump = 13,
+
+    // Probes of the pawn hash table (see mt_chess_pawn.h), a miss's ticks
+    // including the pawn-structure evaluation:
+    //
+    mt_chess_stats_id_pawn_hash_hit = 14,
+    mt_chess_stats_id_pawn_hash_miss = 15,
+
+    mt_chess_stats_id_count = 16 // (not an ID)
+};
+
+struct mt_chess_stats_entry
+{
+    uint64_t count;
+
+    // Sum of the durations in ticks (CPU time stamp counter cycles on x86 and
+    // x64, nanoseconds otherwise, see mt_chess_stats_get_ticks()).
+    //
+    uint64_t ticks;
+};
+
+struct mt_chess_stats
+{
+    struct mt_chess_stats_entry entries[mt_chess_stats_id_count];
+};
+
+/**
+ * - Returns a short name of given ID (e.g. "try_move"), for output.
+ */
+char const * mt_chess_stats_get_name(enum mt_chess_stats_id const id);
+
+#ifdef MT_CHESS_STATS_ENABLED
+
+static inline uint64_t mt_chess_stats_get_ticks(void)
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    return mt_chess_clock_get_ns();
+#endif
+}
+
+/**
+ * - Adds one call with given start ticks to the calling thread's entry of
+ *   given ID.
+ */
+void mt_chess_stats_add(enum mt_chess_stats_id const id, uint64_t const begin);
+
+/**
+ * - Copies the calling thread's counters and timers to given struct.
+ */
+void mt_chess_stats_get(struct mt_chess_stats * const out_stats);
+
+/**
+ * - Zeroes the calling thread's counters and timers.
+ */
+void mt_chess_stats_reset(void);
+
+    #define MT_CHESS_STATS_BEGIN(begin) \
+        uint64_t const begin = mt_chess_stats_get_ticks()
+    #define MT_CHESS_STATS_END(id, begin) \
+        mt_chess_stats_add((id), (begin))
+
+#else //MT_CHESS_STATS_ENABLED
+
+    #define MT_CHESS_STATS_BEGIN(begin) ((void)0)
+    #define MT_CHESS_STATS_END(id, begin) ((void)0)
+
+#endif //MT_CHESS_STATS_ENABLED
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_STATS
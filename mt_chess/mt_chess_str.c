@@ -15,6 +15,8 @@
 #include "mt_chess_color.h"
 #include "mt_chess_piece.h"
 #include "mt_chess_data.h"
+#include "mt_chess_mem.h"
+#include "mt_chess_stats.h"
 
 #define MT_CC "\033"
 //
@@ -209,7 +211,8 @@ static char* create_board_as_unicode(struct mt_chess_data const * const data)
             )
             + (18 + 1) // Bottom row (showing a, b, c, d, e, f, g and h).
             + 1; // Trailing zero-terminator.
-    char * const ret_val = (char*)malloc((size_t)max_chars * sizeof *ret_val);
+    char * const ret_val =
+        (char*)mt_chess_mem_alloc((size_t)max_chars * sizeof *ret_val);
 
     assert(ret_val != NULL);
 
@@ -267,7 +270,7 @@ static char* create_board_as_ascii(struct mt_chess_data const * const data)
     //   ------------------------------------------------|\n   16
     //      a     b     c     d     e     f     g     h   \n\0 17
 
-    char * const ret_val = (char*)malloc(
+    char * const ret_val = (char*)mt_chess_mem_alloc(
         MT_BOARD_AS_STR_ASCII_CHARS * sizeof *ret_val);
     
     assert(ret_val != NULL);
@@ -478,9 +481,11 @@ static char* create_board_as_ascii(struct mt_chess_data const * const data)
 char* mt_chess_str_create_board(
     struct mt_chess_data const * const data, bool const unicode)
 {
-    if(unicode)
-    {
-        return create_board_as_unicode(data);
-    }
-    return create_board_as_ascii(data);
+    MT_CHESS_STATS_BEGIN(stats_begin);
+
+    char * const ret_val = unicode
+        ? create_board_as_unicode(data) : create_board_as_ascii(data);
+
+    MT_CHESS_STATS_END(mt_chess_stats_id_render, stats_begin);
+    return ret_val;
 }
@@ -0,0 +1,197 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200112L // For sysconf().
+#endif //_WIN32
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstddef>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#ifdef _WIN32
+    #include <windows.h>
+    #include <process.h>
+#else //_WIN32
+    #include <pthread.h>
+    #include <unistd.h>
+#endif //_WIN32
+
+#include "mt_chess_thread.h"
+#include "mt_chess_trace.h"
+
+#ifdef _WIN32
+static unsigned __stdcall run(void * const arg)
+{
+    struct mt_chess_thread * const thread = (struct mt_chess_thread *)arg;
+
+    thread->func(thread->arg);
+    return 0;
+}
+#else //_WIN32
+static void * run(void * const arg)
+{
+    struct mt_chess_thread * const thread = (struct mt_chess_thread *)arg;
+
+    thread->func(thread->arg);
+    return NULL;
+}
+#endif //_WIN32
+
+bool mt_chess_thread_start(
+    struct mt_chess_thread * const thread,
+    void (*func)(void * const arg),
+    void * const arg)
+{
+    assert(thread != NULL);
+    assert(func != NULL);
+
+    thread->func = func;
+    thread->arg = arg;
+
+#ifdef _WIN32
+    thread->handle = (HANDLE)_beginthreadex(NULL, 0, run, thread, 0, NULL);
+    return thread->handle != NULL;
+#else //_WIN32
+    return pthread_create(&thread->handle, NULL, run, thread) == 0;
+#endif //_WIN32
+}
+
+void mt_chess_thread_join(struct mt_chess_thread * const thread)
+{
+    assert(thread != NULL);
+
+#ifdef _WIN32
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+    thread->handle = NULL;
+#else //_WIN32
+    pthread_join(thread->handle, NULL);
+#endif //_WIN32
+}
+
+int mt_chess_thread_get_cpu_count(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+
+    GetSystemInfo(&info);
+    return 1 <= (int)info.dwNumberOfProcessors
+        ? (int)info.dwNumberOfProcessors : 1;
+#else //_WIN32
+    long const count = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return 1 <= count ? (int)count : 1;
+#endif //_WIN32
+}
+
+void mt_chess_thread_mutex_init(struct mt_chess_thread_mutex * const mutex)
+{
+    assert(mutex != NULL);
+
+#ifdef _WIN32
+    InitializeCriticalSection(&mutex->handle);
+#else //_WIN32
+    pthread_mutex_init(&mutex->handle, NULL);
+#endif //_WIN32
+}
+
+void mt_chess_thread_mutex_deinit(struct mt_chess_thread_mutex * const mutex)
+{
+    assert(mutex != NULL);
+
+#ifdef _WIN32
+    DeleteCriticalSection(&mutex->handle);
+#else //_WIN32
+    pthread_mutex_destroy(&mutex->handle);
+#endif //_WIN32
+}
+
+void mt_chess_thread_mutex_lock(struct mt_chess_thread_mutex * const mutex)
+{
+    assert(mutex != NULL);
+
+#ifdef _WIN32
+    EnterCriticalSection(&mutex->handle);
+#else //_WIN32
+    pthread_mutex_lock(&mutex->handle);
+#endif //_WIN32
+}
+
+void mt_chess_thread_mutex_unlock(struct mt_chess_thread_mutex * const mutex)
+{
+    assert(mutex != NULL);
+
+#ifdef _WIN32
+    LeaveCriticalSection(&mutex->handle);
+#else //_WIN32
+    pthread_mutex_unlock(&mutex->handle);
+#endif //_WIN32
+}
+
+void mt_chess_thread_cond_init(struct mt_chess_thread_cond * const cond)
+{
+    assert(cond != NULL);
+
+#ifdef _WIN32
+    InitializeConditionVariable(&cond->handle);
+#else //_WIN32
+    pthread_cond_init(&cond->handle, NULL);
+#endif //_WIN32
+}
+
+void mt_chess_thread_cond_deinit(struct mt_chess_thread_cond * const cond)
+{
+    assert(cond != NULL);
+
+#ifdef _WIN32
+    (void)cond; // (nothing to do)
+#else //_WIN32
+    pthread_cond_destroy(&cond->handle);
+#endif //_WIN32
+}
+
+void mt_chess_thread_cond_wait(
+    struct mt_chess_thread_cond * const cond,
+    struct mt_chess_thread_mutex * const mutex)
+{
+    assert(cond != NULL);
+    assert(mutex != NULL);
+
+    MT_CHESS_TRACE_BEGIN(trace_begin);
+
+#ifdef _WIN32
+    SleepConditionVariableCS(&cond->handle, &mutex->handle, INFINITE);
+#else //_WIN32
+    pthread_cond_wait(&cond->handle, &mutex->handle);
+#endif //_WIN32
+
+    MT_CHESS_TRACE_END(trace_begin, "wait", 0);
+}
+
+void mt_chess_thread_cond_signal(struct mt_chess_thread_cond * const cond)
+{
+    assert(cond != NULL);
+
+#ifdef _WIN32
+    WakeConditionVariable(&cond->handle);
+#else //_WIN32
+    pthread_cond_signal(&cond->handle);
+#endif //_WIN32
+}
+
+void mt_chess_thread_cond_broadcast(struct mt_chess_thread_cond * const cond)
+{
+    assert(cond != NULL);
+
+#ifdef _WIN32
+    WakeAllConditionVariable(&cond->handle);
+#else //_WIN32
+    pthread_cond_broadcast(&cond->handle);
+#endif //_WIN32
+}
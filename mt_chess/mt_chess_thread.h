@@ -0,0 +1,102 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_THREAD
+#define MT_CHESS_THREAD
+
+#ifdef __cplusplus
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#ifdef _WIN32
+    #include <windows.h>
+#else //_WIN32
+    #include <pthread.h>
+#endif //_WIN32
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Thin wrappers around Win32 threads or POSIX threads.
+
+#ifdef _MSC_VER
+    #define MT_CHESS_THREAD_LOCAL __declspec(thread)
+#else //_MSC_VER
+    #define MT_CHESS_THREAD_LOCAL _Thread_local
+#endif //_MSC_VER
+
+struct mt_chess_thread
+{
+#ifdef _WIN32
+    HANDLE handle;
+#else //_WIN32
+    pthread_t handle;
+#endif //_WIN32
+
+    void (*func)(void * const arg);
+    void * arg;
+};
+
+struct mt_chess_thread_mutex
+{
+#ifdef _WIN32
+    CRITICAL_SECTION handle;
+#else //_WIN32
+    pthread_mutex_t handle;
+#endif //_WIN32
+};
+
+struct mt_chess_thread_cond
+{
+#ifdef _WIN32
+    CONDITION_VARIABLE handle;
+#else //_WIN32
+    pthread_cond_t handle;
+#endif //_WIN32
+};
+
+/**
+ * - Starts a thread calling given function with given argument.
+ * - Given thread object must stay valid until mt_chess_thread_join() returned.
+ * - Returns false on error.
+ */
+bool mt_chess_thread_start(
+    struct mt_chess_thread * const thread,
+    void (*func)(void * const arg),
+    void * const arg);
+
+/**
+ * - Waits for the thread to return from its function.
+ */
+void mt_chess_thread_join(struct mt_chess_thread * const thread);
+
+/**
+ * - Returns the count of logical processors (at least 1).
+ */
+int mt_chess_thread_get_cpu_count(void);
+
+void mt_chess_thread_mutex_init(struct mt_chess_thread_mutex * const mutex);
+void mt_chess_thread_mutex_deinit(struct mt_chess_thread_mutex * const mutex);
+void mt_chess_thread_mutex_lock(struct mt_chess_thread_mutex * const mutex);
+void mt_chess_thread_mutex_unlock(struct mt_chess_thread_mutex * const mutex);
+
+void mt_chess_thread_cond_init(struct mt_chess_thread_cond * const cond);
+void mt_chess_thread_cond_deinit(struct mt_chess_thread_cond * const cond);
+
+/**
+ * - Given mutex must be locked by the caller. Spurious wake-ups are possible.
+ */
+void mt_chess_thread_cond_wait(
+    struct mt_chess_thread_cond * const cond,
+    struct mt_chess_thread_mutex * const mutex);
+
+void mt_chess_thread_cond_signal(struct mt_chess_thread_cond * const cond);
+void mt_chess_thread_cond_broadcast(struct mt_chess_thread_cond * const cond);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_THREAD
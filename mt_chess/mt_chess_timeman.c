@@ -0,0 +1,128 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_timeman.h"
+
+// Kept back from the time left for everything but the search (e.g. the
+// communication of the move):
+//
+static uint64_t const s_overhead_ns = 20ULL * 1000000ULL;
+
+// Moves the time left is spread over, if there is no time control ahead:
+//
+static int const s_default_moves_to_go = 30;
+
+// The hard deadline is this many times the optimum (at most):
+//
+static uint64_t const s_max_factor = 5;
+
+// Iterations the best move must have stayed the same, before it may be
+// considered as dominating:
+//
+static int const s_dominating_stable_count = 3;
+
+// Share of an iteration's nodes (per mille) spent on the best move to
+// consider it as dominating the other moves:
+//
+static int const s_dominating_permille = 900;
+
+void mt_chess_timeman_init(
+    struct mt_chess_timeman * const timeman,
+    struct mt_chess_timeman_clock const * const clock)
+{
+    assert(timeman != NULL);
+    assert(clock != NULL);
+    assert(0 <= clock->moves_to_go);
+
+    uint64_t const overhead = s_overhead_ns < clock->remaining_ns / 10
+        ? s_overhead_ns : clock->remaining_ns / 10;
+    uint64_t const usable = clock->remaining_ns - overhead;
+    uint64_t const moves_to_go = (uint64_t)(
+        clock->moves_to_go == 0 || s_default_moves_to_go < clock->moves_to_go
+            ? s_default_moves_to_go : clock->moves_to_go);
+
+    // Never more than most of the usable time on one move, keeping some time
+    // for the moves to come (the increment is added after the move):
+    //
+    uint64_t const cap = usable / 5 * 4;
+
+    timeman->optimum_ns =
+        usable / moves_to_go + clock->increment_ns / 4 * 3;
+    if(cap < timeman->optimum_ns)
+    {
+        timeman->optimum_ns = cap;
+    }
+    timeman->max_ns = timeman->optimum_ns * s_max_factor;
+    if(cap < timeman->max_ns)
+    {
+        timeman->max_ns = cap;
+    }
+    if(timeman->max_ns == 0)
+    {
+        timeman->max_ns = 1; // (0 would mean no limit to the search)
+    }
+    timeman->soft_ns = timeman->optimum_ns;
+
+    timeman->best_move = 0;
+    timeman->best_score = 0;
+    timeman->stable_count = 0;
+    timeman->instability = 0;
+}
+
+bool mt_chess_timeman_is_done(
+    struct mt_chess_timeman * const timeman,
+    uint16_t const best_move,
+    int const score,
+    int const best_move_nodes_permille,
+    uint64_t const elapsed_ns)
+{
+    assert(timeman != NULL);
+    assert(best_move != 0);
+
+    bool const first = timeman->best_move == 0;
+    bool const changed = !first && best_move != timeman->best_move;
+
+    timeman->instability = timeman->instability / 2 + (changed ? 100 : 0);
+    timeman->stable_count = first || changed ? 0 : timeman->stable_count + 1;
+
+    // Percent of the optimum:
+    //
+    uint64_t scale = 100 + (uint64_t)timeman->instability;
+
+    if(!first && score < timeman->best_score)
+    {
+        int const drop = timeman->best_score - score;
+
+        scale += (uint64_t)(drop < 100 ? drop : 100); // 1 % per centipawn.
+    }
+    if(s_dominating_stable_count <= timeman->stable_count
+        && s_dominating_permille <= best_move_nodes_permille)
+    {
+        scale = scale * 40 / 100;
+    }
+
+    timeman->soft_ns = timeman->optimum_ns / 100 * scale;
+    if(timeman->max_ns < timeman->soft_ns)
+    {
+        timeman->soft_ns = timeman->max_ns;
+    }
+
+    timeman->best_move = best_move;
+    timeman->best_score = score;
+
+    // The next iteration is expected to take at least as long as all
+    // iterations so far, so it would most likely end after the soft deadline:
+    //
+    return timeman->soft_ns <= 2 * elapsed_ns;
+}
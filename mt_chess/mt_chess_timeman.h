@@ -0,0 +1,87 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_TIMEMAN
+#define MT_CHESS_TIMEMAN
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Time management of clocked games: Decides how long to search a move (see
+// mt_chess_search_limits.timeman).
+
+/**
+ * - The clock of the player having the turn.
+ */
+struct mt_chess_timeman_clock
+{
+    uint64_t remaining_ns; // Time left.
+    uint64_t increment_ns; // Added after each move.
+    int moves_to_go; // Moves until the next time control or 0 (= all moves).
+};
+
+struct mt_chess_timeman
+{
+    // Time of the search to aim for in easy-going positions:
+    //
+    uint64_t optimum_ns;
+
+    // Hard deadline (time since the search started), checked during the
+    // search. Is never exceeded by more than the time of 1024 nodes:
+    //
+    uint64_t max_ns;
+
+    // Soft deadline (time since the search started), checked after each
+    // iteration. The search does not start another iteration after that:
+    //
+    uint64_t soft_ns;
+
+    // State of the iterations completed so far:
+
+    uint16_t best_move; // 0 = no iteration, yet.
+    int best_score;
+    int stable_count; // Count of iterations keeping the best move.
+    int instability; // Percent, decaying (grows with each best move change).
+};
+
+/**
+ * - Sets optimum and hard deadline for a search with given clock.
+ */
+void mt_chess_timeman_init(
+    struct mt_chess_timeman * const timeman,
+    struct mt_chess_timeman_clock const * const clock);
+
+/**
+ * - Updates the soft deadline after an iteration found given best move with
+ *   given score, given share of the iteration's nodes (in per mille) being
+ *   spent on the best move:
+ *
+ *   - A changing best move (unstable) or a dropping score extend it (at most
+ *     to the hard deadline).
+ *
+ *   - A best move that stayed the same for some iterations and took almost
+ *     all of the nodes (dominating the other moves) shortens it.
+ *
+ * - Returns true, if another iteration would most likely end after the soft
+ *   deadline, given the time spent so far (so it shall not be started).
+ */
+bool mt_chess_timeman_is_done(
+    struct mt_chess_timeman * const timeman,
+    uint16_t const best_move,
+    int const score,
+    int const best_move_nodes_permille,
+    uint64_t const elapsed_ns);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_TIMEMAN
@@ -0,0 +1,258 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstddef>
+    #include <cassert>
+    #include <cstdbool>
+    #include <cstdio>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <assert.h>
+    #include <stdbool.h>
+    #include <stdio.h>
+#endif //__cplusplus
+
+#include "mt_chess_trace.h"
+
+#ifdef MT_CHESS_TRACE_ENABLED
+
+#include "mt_chess_thread.h"
+#include "mt_chess_clock.h"
+#include "mt_chess_mem.h"
+
+struct span
+{
+    char const * name;
+    uint64_t begin; // Nanoseconds since mt_chess_trace_start().
+    uint64_t duration; // Nanoseconds.
+    int64_t arg;
+};
+
+struct buffer
+{
+    struct span * spans;
+    int count;
+    uint64_t dropped;
+};
+
+// Set by mt_chess_trace_start() and mt_chess_trace_stop(), only (see there):
+//
+static struct buffer * s_buffers = NULL;
+static int s_max_threads = 0;
+static int s_max_spans = 0;
+static uint64_t s_start_ns = 0;
+static int s_generation = 0; // Invalidates the threads' buffer pointers.
+static struct mt_chess_thread_mutex s_mutex; // Protects s_claimed, only.
+static int s_claimed = 0; // Count of buffers in use by threads.
+static uint64_t s_unclaimed_dropped = 0; // Of threads without buffer.
+
+static MT_CHESS_THREAD_LOCAL struct buffer * s_buffer = NULL;
+static MT_CHESS_THREAD_LOCAL int s_buffer_generation = 0;
+
+bool mt_chess_trace_start(int const max_threads, int const max_spans)
+{
+    assert(1 <= max_threads);
+    assert(1 <= max_spans);
+
+    if(s_buffers != NULL)
+    {
+        return false; // Already started.
+    }
+
+    s_buffers = (struct buffer *)mt_chess_mem_alloc(
+        (size_t)max_threads * sizeof *s_buffers);
+    for(int i = 0; i < max_threads; ++i)
+    {
+        s_buffers[i].spans = (struct span *)mt_chess_mem_alloc(
+            (size_t)max_spans * sizeof *s_buffers[i].spans);
+        s_buffers[i].count = 0;
+        s_buffers[i].dropped = 0;
+    }
+    s_max_threads = max_threads;
+    s_max_spans = max_spans;
+    mt_chess_thread_mutex_init(&s_mutex);
+    s_claimed = 0;
+    s_unclaimed_dropped = 0;
+    ++s_generation;
+    s_start_ns = mt_chess_clock_get_ns() - 1; // (never returning 0, below)
+    return true;
+}
+
+uint64_t mt_chess_trace_get_ns(void)
+{
+    if(s_buffers == NULL)
+    {
+        return 0;
+    }
+    return mt_chess_clock_get_ns() - s_start_ns;
+}
+
+/**
+ * - Returns the calling thread's buffer, claiming one, if not done, yet.
+ * - Returns NULL, if all buffers are claimed by other threads.
+ */
+static struct buffer * get_buffer(void)
+{
+    if(s_buffer_generation == s_generation)
+    {
+        return s_buffer;
+    }
+
+    mt_chess_thread_mutex_lock(&s_mutex);
+    if(s_claimed < s_max_threads)
+    {
+        s_buffer = s_buffers + s_claimed;
+        ++s_claimed;
+    }
+    else
+    {
+        s_buffer = NULL;
+    }
+    mt_chess_thread_mutex_unlock(&s_mutex);
+
+    s_buffer_generation = s_generation;
+    return s_buffer;
+}
+
+void mt_chess_trace_add(
+    uint64_t const begin, char const * const name, int64_t const arg)
+{
+    assert(name != NULL);
+
+    if(s_buffers == NULL || begin == 0)
+    {
+        return; // Not started (or span started before).
+    }
+
+    uint64_t const end = mt_chess_trace_get_ns();
+    struct buffer * const buffer = get_buffer();
+
+    if(buffer == NULL)
+    {
+        mt_chess_thread_mutex_lock(&s_mutex);
+        ++s_unclaimed_dropped;
+        mt_chess_thread_mutex_unlock(&s_mutex);
+        return;
+    }
+    if(buffer->count == s_max_spans)
+    {
+        ++buffer->dropped;
+        return;
+    }
+
+    struct span * const span = buffer->spans + buffer->count;
+
+    span->name = name;
+    span->begin = begin;
+    span->duration = end - begin;
+    span->arg = arg;
+    ++buffer->count;
+}
+
+/**
+ * - Writes complete events ("X") in microseconds, one thread ID per buffer.
+ */
+static bool write_json(char const * const path)
+{
+    FILE * const file = fopen(path, "w");
+
+    if(file == NULL)
+    {
+        return false;
+    }
+
+    bool first = true;
+
+    fprintf(file, "{\"traceEvents\":[\n");
+    for(int i = 0; i < s_claimed; ++i)
+    {
+        struct buffer const * const buffer = s_buffers + i;
+
+        fprintf(
+            file,
+            "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"thread %d\"}}",
+            first ? "" : ",\n",
+            i + 1,
+            i + 1);
+        first = false;
+
+        for(int j = 0; j < buffer->count; ++j)
+        {
+            struct span const * const span = buffer->spans + j;
+
+            fprintf(
+                file,
+                ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"value\":%lld}}",
+                span->name,
+                i + 1,
+                (double)span->begin / 1000.0,
+                (double)span->duration / 1000.0,
+                (long long)span->arg);
+        }
+    }
+    fprintf(file, "\n]}\n");
+    return fclose(file) == 0;
+}
+
+bool mt_chess_trace_stop(char const * const path, uint64_t * const out_dropped)
+{
+    assert(path != NULL);
+
+    if(s_buffers == NULL)
+    {
+        return false; // Not started.
+    }
+
+    bool const ret_val = write_json(path);
+
+    if(out_dropped != NULL)
+    {
+        *out_dropped = s_unclaimed_dropped;
+        for(int i = 0; i < s_claimed; ++i)
+        {
+            *out_dropped += s_buffers[i].dropped;
+        }
+    }
+
+    for(int i = 0; i < s_max_threads; ++i)
+    {
+        mt_chess_mem_free(s_buffers[i].spans);
+    }
+    mt_chess_mem_free(s_buffers);
+    s_buffers = NULL;
+    mt_chess_thread_mutex_deinit(&s_mutex);
+    return ret_val;
+}
+
+#else //MT_CHESS_TRACE_ENABLED
+
+bool mt_chess_trace_start(int const max_threads, int const max_spans)
+{
+    (void)max_threads;
+    (void)max_spans;
+    return false;
+}
+
+bool mt_chess_trace_stop(char const * const path, uint64_t * const out_dropped)
+{
+    (void)path;
+    (void)out_dropped;
+    return false;
+}
+
+uint64_t mt_chess_trace_get_ns(void)
+{
+    return 0;
+}
+
+void mt_chess_trace_add(
+    uint64_t const begin, char const * const name, int64_t const arg)
+{
+    (void)begin;
+    (void)name;
+    (void)arg;
+}
+
+#endif //MT_CHESS_TRACE_ENABLED
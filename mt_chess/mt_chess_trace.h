@@ -0,0 +1,90 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_TRACE
+#define MT_CHESS_TRACE
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Optional tracing of spans (e.g. search iterations or waits of threads),
+// written as Chrome trace-event JSON (to be opened via chrome://tracing or
+// https://ui.perfetto.dev):
+//
+// - Define MT_CHESS_TRACE_ENABLED when building the library to enable it.
+//   Otherwise the macros below expand to nothing and mt_chess_trace_start()
+//   just returns false.
+// - Each thread records into its own buffer, allocated (for all threads) by
+//   mt_chess_trace_start(). Recording a span is two clock reads and a store,
+//   no allocation and no locking (just once per thread, to get its buffer).
+// - Spans of a thread that does not get a buffer or whose buffer is full are
+//   dropped (and counted).
+
+/**
+ * - Allocates buffers for given count of threads, holding given count of
+ *   spans each, and starts recording.
+ * - Must not be called while any thread records spans.
+ * - Returns false, if already started or built without
+ *   MT_CHESS_TRACE_ENABLED.
+ */
+bool mt_chess_trace_start(int const max_threads, int const max_spans);
+
+/**
+ * - Stops recording and writes all recorded spans to given file, before
+ *   freeing the buffers.
+ * - Must not be called while any thread records spans (e.g. call it after
+ *   joining the threads).
+ * - Sets count of dropped spans, if given pointer is not NULL.
+ * - Returns false, if not started or file could not be written.
+ */
+bool mt_chess_trace_stop(char const * const path, uint64_t * const out_dropped);
+
+/**
+ * - Returns the current time in nanoseconds (never 0) or 0, if not started.
+ */
+uint64_t mt_chess_trace_get_ns(void);
+
+/**
+ * - Records a span from given start time (see mt_chess_trace_get_ns()) to now
+ *   with given name and argument value (e.g. a depth or a packed move).
+ * - Given name must be a string literal (just the pointer is stored).
+ */
+void mt_chess_trace_add(
+    uint64_t const begin, char const * const name, int64_t const arg);
+
+#ifdef MT_CHESS_TRACE_ENABLED
+
+    #define MT_CHESS_TRACE_BEGIN(begin) \
+        uint64_t const begin = mt_chess_trace_get_ns()
+    #define MT_CHESS_TRACE_BEGIN_IF(begin, condition) \
+        uint64_t const begin = (condition) ? mt_chess_trace_get_ns() : 0
+    #define MT_CHESS_TRACE_END(begin, name, arg) \
+        do \
+        { \
+            if((begin) != 0) \
+            { \
+                mt_chess_trace_add((begin), (name), (int64_t)(arg)); \
+            } \
+        } while(false)
+
+#else //MT_CHESS_TRACE_ENABLED
+
+    #define MT_CHESS_TRACE_BEGIN(begin) ((void)0)
+    #define MT_CHESS_TRACE_BEGIN_IF(begin, condition) ((void)0)
+    #define MT_CHESS_TRACE_END(begin, name, arg) ((void)0)
+
+#endif //MT_CHESS_TRACE_ENABLED
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_TRACE
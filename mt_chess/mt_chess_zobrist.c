@@ -0,0 +1,81 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstddef>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stddef.h>
+#endif //__cplusplus
+
+#include "mt_chess_zobrist.h"
+#include "mt_chess_data.h"
+#include "mt_chess_piece.h"
+#include "mt_chess_color.h"
+#include "mt_chess_type.h"
+#include "mt_chess_col.h"
+
+static int const s_row_len = (int)mt_chess_col_h + 1;
+
+uint64_t mt_chess_zobrist_get(struct mt_chess_data const * const data)
+{
+    assert(data != NULL);
+
+    uint64_t ret_val = 0;
+
+    for(int index = 0; index < 8 * 8; ++index)
+    {
+        uint8_t const piece_id = data->board[index];
+
+        if(piece_id == 0)
+        {
+            continue;
+        }
+
+        struct mt_chess_piece const * const piece =
+            data->pieces + mt_chess_piece_get_index(data->pieces, piece_id);
+
+        ret_val ^= mt_chess_zobrist_pieces[piece->color][piece->type][index];
+    }
+
+    ret_val ^= mt_chess_zobrist_castling[data->castling];
+
+    if(data->en_passant != MT_CHESS_DATA_NO_EN_PASSANT)
+    {
+        ret_val ^= mt_chess_zobrist_en_passant[data->en_passant % s_row_len];
+    }
+    if(data->turn == mt_chess_color_black)
+    {
+        ret_val ^= mt_chess_zobrist_black;
+    }
+    return ret_val;
+}
+
+uint64_t mt_chess_zobrist_get_pawns(struct mt_chess_data const * const data)
+{
+    assert(data != NULL);
+
+    uint64_t ret_val = 0;
+
+    for(int index = 0; index < 8 * 8; ++index)
+    {
+        uint8_t const piece_id = data->board[index];
+
+        if(piece_id == 0)
+        {
+            continue;
+        }
+
+        struct mt_chess_piece const * const piece =
+            data->pieces + mt_chess_piece_get_index(data->pieces, piece_id);
+
+        if(piece->type == mt_chess_type_pawn)
+        {
+            ret_val ^= mt_chess_zobrist_pieces[piece->color][
+                mt_chess_type_pawn][index];
+        }
+    }
+    return ret_val;
+}
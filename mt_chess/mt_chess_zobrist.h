@@ -0,0 +1,54 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_ZOBRIST
+#define MT_CHESS_ZOBRIST
+
+#ifdef __cplusplus
+    #include <cstdint>
+#else //__cplusplus
+    #include <stdint.h>
+#endif //__cplusplus
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+struct mt_chess_data;
+
+// Zobrist keys (see mt_chess_zobrist_keys.c):
+//
+// - A position's hash is the XOR of the keys of all pieces on the board, of
+//   the castling rights, of the column of the "en passant" square (if any) and
+//   mt_chess_zobrist_black, if black has the turn.
+//
+// - A position's pawn hash is the XOR of the keys of the pawns on the board,
+//   only (see mt_chess_data.pawn_hash).
+
+// Indices are color, type and board index.
+extern uint64_t const mt_chess_zobrist_pieces[2][6][8 * 8];
+
+// Index is the castling rights value (see MT_CHESS_DATA_CASTLING_*).
+extern uint64_t const mt_chess_zobrist_castling[16];
+
+// Index is the column of the "en passant" square.
+extern uint64_t const mt_chess_zobrist_en_passant[8];
+
+extern uint64_t const mt_chess_zobrist_black;
+
+/**
+ * - Calculates the hash of given position from scratch.
+ * - mt_chess_data_apply_move() updates the hash incrementally, instead.
+ */
+uint64_t mt_chess_zobrist_get(struct mt_chess_data const * const data);
+
+/**
+ * - Calculates the pawn hash of given position from scratch.
+ * - mt_chess_data_apply_move() updates the pawn hash incrementally, instead.
+ */
+uint64_t mt_chess_zobrist_get_pawns(struct mt_chess_data const * const data);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_ZOBRIST
@@ -0,0 +1,324 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cstdint>
+#else //__cplusplus
+    #include <stdint.h>
+#endif //__cplusplus
+
+#include "mt_chess_zobrist.h"
+
+// Random keys generated with SplitMix64, seeded with 0x6D745F6368657373
+// ("mt_chess"), in the order they appear in this file.
+
+uint64_t const mt_chess_zobrist_pieces[2][6][8 * 8] = {
+    { // White
+        { // King
+            0x173923F84E7B2CB8ULL, 0xB49AE1FA4E976DBFULL, 0x1B7327A3C1CCE8FCULL,
+            0x7B84C5718B2BE5E8ULL, 0x91E2A93C49A63426ULL, 0x6A447F80E8E305CFULL,
+            0x5307863A3BFFA2F3ULL, 0x472D26E42D0FEFC3ULL, 0x64E33153C2AF3F8CULL,
+            0xC3C43A2A160E128CULL, 0xD2C3D410E20B5527ULL, 0xBA750DB2825FCAB0ULL,
+            0x7B25119B7A09778CULL, 0x2039880BEA1D9D73ULL, 0xEF22E5F8BE537AD2ULL,
+            0x207CE2DA447C251AULL, 0x5EFE40F7267BEBB7ULL, 0x4C04614298383AE6ULL,
+            0x44C25583955C8746ULL, 0x6B025BC52675587DULL, 0xEFC3062C858EF60AULL,
+            0x080BCACB4D6FD397ULL, 0x9780450EC880918BULL, 0x335D3D3064149ADBULL,
+            0x2211B87B27E2816DULL, 0x272ABE5FF97D34FCULL, 0x8DBEB8FABB787480ULL,
+            0x4273C4974111D455ULL, 0x095D53BB97B5711AULL, 0xD813507B9A3360C8ULL,
+            0x0B7DF7E69201C86DULL, 0xDEA198748AD8819AULL, 0x2487BF5C63F73710ULL,
+            0x0B7C6E5BFD56F01BULL, 0x959F10644E48259CULL, 0xD7219DAED7BDB29EULL,
+            0x9B69D0D472062D26ULL, 0x579E1643FA89C447ULL, 0x11B5D0AEF386AED8ULL,
+            0xEE7B5673FDB11E76ULL, 0x41AE15BDFFDFBD26ULL, 0xD0E4474E5D9DAD8EULL,
+            0x2031B14242464571ULL, 0x97D4B04C17045DA1ULL, 0xE0761B7CB2992091ULL,
+            0x485C74F6318669E7ULL, 0xE8FBD59709D00D40ULL, 0x7298DD3E09BE771DULL,
+            0x7F7B6FE8B62E69DDULL, 0x43EB08CB0F8920A4ULL, 0x51B0606DD7A0C9D8ULL,
+            0xC299F124FAA9A4B2ULL, 0xFEF621EE82E83594ULL, 0xEAD5BD79E54CA469ULL,
+            0x20E478D694F3D9AAULL, 0x845EA2181CD839C6ULL, 0x216E586378BA683DULL,
+            0xC3579E46E7CE28A5ULL, 0xAD661079EBCAF64DULL, 0x12EFF6D5F1467C3FULL,
+            0x5274AA8167E09CFFULL, 0x2BA8313930FFB21BULL, 0x97D9A6224EFCC45AULL,
+            0x031EFCDA88453E45ULL
+        },
+        { // Pawn
+            0x39A4BAC9239988B3ULL, 0xF4720E8E7E046738ULL, 0x6FB6A210B255E372ULL,
+            0xE5CDC3B44AE60905ULL, 0xAB2A29364AA581D2ULL, 0x311F69EC1F5E8139ULL,
+            0x84096E5840A9DE4BULL, 0x4C594F1A30EE006EULL, 0x4C57AA93010EAE4AULL,
+            0xC6B49BE174265B56ULL, 0xBE6C0E55D28E4A45ULL, 0xFC2CCDF81996EB69ULL,
+            0x16BE3BCC4797563CULL, 0xCDAC45C8DCE4B0E0ULL, 0xA7D247DE82FF682AULL,
+            0xA1AD0696F4F27AAFULL, 0xCEC3AB3CF4A52DF4ULL, 0xB2F8C439269AD112ULL,
+            0x09DD99400642D0BEULL, 0xF735C515568D78B6ULL, 0xF7683B546883F13CULL,
+            0x73129BFF53C7ABEEULL, 0x2F4F5288E64219FDULL, 0xC9666C0F65649816ULL,
+            0xA8AD103EA31B6DE5ULL, 0x26A42F8F9C19C73EULL, 0x24E58F2DBCAFBA32ULL,
+            0x4D518194A2235CCFULL, 0x8CDD263E000BABC4ULL, 0x46DB66A8B5A6474BULL,
+            0x41C7228946C62E48ULL, 0xC84F3CE88BA17115ULL, 0x3A8EE8D82D4B4503ULL,
+            0xE0B81DBF04779AC7ULL, 0xF53D8DB9A965CE74ULL, 0x83AE066549CA0D3CULL,
+            0x359B0B66C5DC0CA9ULL, 0x3F3CF38763B4B61DULL, 0xEC6BF5BEE48F8DEAULL,
+            0x3E9F79B7570CE043ULL, 0x84D1269F543AFCF7ULL, 0x22945EA399DBF75EULL,
+            0xBC81FB8F00C18238ULL, 0xC7B8E976ACA489A5ULL, 0xA45E2D30094950EEULL,
+            0x8461D5EF6AA24481ULL, 0x92640C6DE17EED4BULL, 0xD1E368739D9F19FFULL,
+            0xC53B95A55860A55BULL, 0xD0478093D5B2FF9CULL, 0x190EE6FC0A2F8C13ULL,
+            0xF3228D9FFDE5E43BULL, 0xC6AD76988A2B72FCULL, 0x468E154200349C90ULL,
+            0x9FF7D3E357163875ULL, 0x8A8FF8A5F040CAB5ULL, 0x5024B5DA6A6872C8ULL,
+            0x7BF215987CBEC966ULL, 0xE60D661DA6B434AEULL, 0xA5BEC32C18676A44ULL,
+            0x2CC657F75767C298ULL, 0xFC8E8B00CFF1DE68ULL, 0xE7622983B27DD2F3ULL,
+            0xC14FD6B45CA292C8ULL
+        },
+        { // Knight
+            0xC2B6EA764C263E4AULL, 0x62E047B2054A1B0AULL, 0x1389A91460489B7EULL,
+            0x2DE911C99EE5A6D4ULL, 0x4CA526C153E311D4ULL, 0xCB28E58DBA943C1BULL,
+            0x6549783076DB3411ULL, 0x9B9C7FF051C115AFULL, 0x32385CB354B4D319ULL,
+            0x94D9A5278D1D83EEULL, 0x47B99285A657C9E2ULL, 0x35A2C364487617A5ULL,
+            0x9DF0DF3AD1666393ULL, 0x35C49ABBA920C728ULL, 0x3F62AA547276D20FULL,
+            0xEE25DA0B6D947871ULL, 0xD15736B68E514269ULL, 0x83B813FE9AF1D8BAULL,
+            0xFCBDB9821DEC4575ULL, 0xA43CBDD7AE035C8BULL, 0x48ED43C3FBCBCDB2ULL,
+            0xD928AB87B5BCFF08ULL, 0xC8DCDC45E01CD8F7ULL, 0x816DE56C805E9152ULL,
+            0xC10493AAFBAAFAEFULL, 0x9BF244DFC21044B5ULL, 0x58A5372A65DAF162ULL,
+            0x06AC076084044C86ULL, 0x5B6AD63D139D9DECULL, 0xC2CA9813CF9AFD8CULL,
+            0x61EB4B19A73BF00EULL, 0x03BD1937F3FDDA32ULL, 0x5CDD53FCFF9087EFULL,
+            0x10E303809234779CULL, 0x9722C0AFA81806A4ULL, 0xD13CD091B6CACFE1ULL,
+            0x04F62EDA82348805ULL, 0xCC545C7368205092ULL, 0x7FFB868C22F6EAC4ULL,
+            0xC25A030805021B12ULL, 0xD3BEF1AFECC38A2CULL, 0xCF5B1FDFBC877940ULL,
+            0x4D693F4B5B62B6CAULL, 0x15E5A44F8BB347B4ULL, 0xD2179528D17C9B46ULL,
+            0x52DA54FBAB48B9EBULL, 0x64BBAD3C73D4C3A2ULL, 0x920F3ADA63328CE3ULL,
+            0x582B2426695DF38BULL, 0xE3F862DF93724FA1ULL, 0x26C3745F8C5ED97CULL,
+            0xE55C93DFF48B6058ULL, 0xD0A2BF8ED225D029ULL, 0x42231EB711EDB5BCULL,
+            0xA8EF4B4AF787D1C6ULL, 0x391C6CE1B18A265CULL, 0x0A975BBFB3CD0A3AULL,
+            0x5D31D5BBA15EB367ULL, 0x406E7EAA80DA895EULL, 0x0CA6338DC5F9AE5FULL,
+            0x457DF02FA992D781ULL, 0xC72A5FE912650983ULL, 0xD354C8B58BE8133CULL,
+            0x246BCFBF418A6317ULL
+        },
+        { // Bishop
+            0x3B37241C950E1FA8ULL, 0x70150C17F53B7C43ULL, 0x9B8B78734874B4E1ULL,
+            0xDF2B3F13BFA29B2BULL, 0xCAF18E3D511E7656ULL, 0x8B1CE7D259579CBAULL,
+            0x69FBF785A6717BDBULL, 0x150DADB61D5E7594ULL, 0x7EA69AB81AFEE706ULL,
+            0x1BEE445C6FA7864FULL, 0xBE6FBAC2400B8D57ULL, 0x0431D38699F2E18DULL,
+            0x66FF5C2A254903FCULL, 0x3099FD02474D2013ULL, 0x0E39CE01759071BBULL,
+            0xDAECC20E82F792C2ULL, 0xD9F547983C623ECCULL, 0xE12CF4C0DE3922DEULL,
+            0x36CB6C3309EE4871ULL, 0xAB6251C847060552ULL, 0xC59430524B48BB79ULL,
+            0xE8EA1005158B6651ULL, 0x055DE77BF8545A96ULL, 0x8D468EFFD16A6EABULL,
+            0x15A5D7B903CFF486ULL, 0xB9DA542A45290B36ULL, 0xCFFC0EB2DF578F2EULL,
+            0x43B4AC0177BCE1C0ULL, 0xDF8CACA69EF39368ULL, 0xB749252BC4653D88ULL,
+            0xF5D8D450374F7052ULL, 0xAABC87E37DAA0735ULL, 0x50789FDAD83AE19FULL,
+            0x626CE2269B0A9235ULL, 0x07987E06E3300E45ULL, 0x18FDB1844D77C743ULL,
+            0xE098FEB5ACD6946FULL, 0x04ACDA97B2E6F8D9ULL, 0xA3D3C5EADEEFAB45ULL,
+            0x10E4FF6BA23114D6ULL, 0x2382A801092F0DD6ULL, 0xED27B808EBB705A1ULL,
+            0x480B4200A6E0C8DCULL, 0x95D0AA28C210FEC6ULL, 0xBB1716D578DFDB00ULL,
+            0xFBE19901491805BFULL, 0x04800C36285098E3ULL, 0x82A8A0904935763CULL,
+            0x6E5AD423D00C7FD7ULL, 0xC7C0C74EC7E44F22ULL, 0x2E06BBA6C7FFA537ULL,
+            0x1D0B7DB7D927D56FULL, 0x8D0567F9E0E54D47ULL, 0xE62D927D3F7A95AAULL,
+            0x93299F47C8669A46ULL, 0x0CB26C564628212EULL, 0x73905EE2085F4ACBULL,
+            0xA5C2A2DFFF0D487EULL, 0xB5A7AFC26044E37AULL, 0x35A6963AA710273CULL,
+            0x227259B366AEE151ULL, 0x27EA91449D798312ULL, 0x6B7A4CF07C58BBF9ULL,
+            0x73CD18A9AE130F56ULL
+        },
+        { // Rook
+            0x008E8624F0300FDBULL, 0x7C29F1771D3E76B9ULL, 0xABAA2CB5CC04D98BULL,
+            0x5D5A6E0C8F9733A0ULL, 0xB3DBBE0E427DA0EEULL, 0x83C55A89ED3B55B9ULL,
+            0x9B0D7022375E46F6ULL, 0xC9D61AE51994BAE4ULL, 0xE693B7C792D96A5FULL,
+            0xF4B5D7416086A094ULL, 0x479E693177A4AAFDULL, 0x5C2BE42766C1D5F8ULL,
+            0x123765EF079D420CULL, 0x9240C9314F525790ULL, 0x7574ABE0A5F1A74DULL,
+            0x4E8D3AF4BF591DA5ULL, 0x5159BEE920974F7FULL, 0x747EB17CC6B4E911ULL,
+            0x5E49D451CA46DAD8ULL, 0x3AF6B4FDB846DCAFULL, 0x734EFD926774BA36ULL,
+            0x00FEA1BA8750859AULL, 0x1CC846B15A5DE2E7ULL, 0x3B55041DEBD8FD96ULL,
+            0x824CDD2DBFAF0468ULL, 0xB81AFAF837006921ULL, 0x65B36DDE3D6C08BEULL,
+            0xFDE932FE87064A1DULL, 0x66CB2749596F4F53ULL, 0xD22ECB6485943019ULL,
+            0x1E50FA414BDFD2C9ULL, 0x0FA9A15AE125964FULL, 0x3776DA0FA03982E7ULL,
+            0x4058158F845BC7E7ULL, 0x4E9B1B543A9A7EE5ULL, 0x8CE46C56987387E4ULL,
+            0x68F0A2060B23AF84ULL, 0xEDE34C9A08DA621AULL, 0xEAAC8A600C71DDE7ULL,
+            0xA0BCABF0000ED65DULL, 0xEEF8BA597D168341ULL, 0xCB69A83B02822493ULL,
+            0x7B734089E42BEDF1ULL, 0x3F6C6B523B6E2B6FULL, 0xD1E2AA2D1533F10FULL,
+            0x25C8DE2E9BE3A6C9ULL, 0x9EEB02085E421E84ULL, 0x32A09CCDE1B588FAULL,
+            0x8E72BA0C67D9E726ULL, 0x19CE0B8CE5629A23ULL, 0x2140697F58565C69ULL,
+            0x0F962844C4F867F7ULL, 0xB360DDDAECF5AFADULL, 0xAF1E7D697FF8CFDAULL,
+            0xAC2A78E5B67FEF34ULL, 0x82127E26E1CF4AECULL, 0x835AF4D61004CCCFULL,
+            0xB6C1262CF7FD7EC6ULL, 0xF3398C4EDD1C9808ULL, 0x65B811DA51BC1537ULL,
+            0x7EAC2191BA7BEE88ULL, 0xB2511FD54A1CF35CULL, 0x3CD4E01B0D5B7DA8ULL,
+            0x8788F3C13393DAA2ULL
+        },
+        { // Queen
+            0x34B9C3ED268D59E9ULL, 0x59BA9B27EE354AEFULL, 0x8D8D0DBD856FCC4BULL,
+            0x0EBEF8EDEC982E28ULL, 0xD2EE85DD0E04D072ULL, 0x29AE07B6C96E3333ULL,
+            0xB50EC176CE54B609ULL, 0xFA961C7CD9E024ABULL, 0x8128D54BC579F541ULL,
+            0x928203389847C002ULL, 0xC5E5A867A170F9EBULL, 0xC9ACC05051012009ULL,
+            0x156B25A23E12EF34ULL, 0x24AE00B9FD18658EULL, 0x0EE93849A788B55EULL,
+            0xD46CAA3A01CF3AC1ULL, 0x39A54951137EE4ABULL, 0x8D51C1D8BEF01F4DULL,
+            0x75F98CF114911FD3ULL, 0xDE0D50DDB201858BULL, 0x29174DA61CC41DDEULL,
+            0x923E583499427996ULL, 0x734ACA171D4A3518ULL, 0xDD45CBDFA0F1BE39ULL,
+            0x2C32411A9C5DEB5CULL, 0x5DD6FF4BF5F5196FULL, 0x6AFFB8D36DE49CFFULL,
+            0x1F961F0B05AC102BULL, 0x3320B93CAB5F83B1ULL, 0xE63E0C97162D9DD7ULL,
+            0xCB2F675D1A4BAD3DULL, 0x407368AA784FF8DFULL, 0xD342BB3764717F7DULL,
+            0xD2E80E329D6C71E0ULL, 0xDFC5FCB81F94DD17ULL, 0xF91764DCC7190D83ULL,
+            0x258A85B4DE76C1F5ULL, 0xDBCAA825D78E9B9CULL, 0xF00686B1A51C137CULL,
+            0x985C0C69D37B27D1ULL, 0x330ACADBEF4CDAD2ULL, 0xEE47DDBBC1114333ULL,
+            0xB31322BA6F8E4CB2ULL, 0x74CD2465427B9D67ULL, 0x4EC61D53B313834EULL,
+            0x90003A2708931212ULL, 0x80D02002E8A34C87ULL, 0xD4A4CA0F8394F552ULL,
+            0x34ACDC4FA3279A1AULL, 0xA12658A8F968D3DFULL, 0xE434706AEADB0E99ULL,
+            0x8E625DDE19432059ULL, 0x041FB015A3004AA8ULL, 0xBEC3AC8B3766330AULL,
+            0xA91B49C27A3D2D78ULL, 0x1335A81B8CB7EEC9ULL, 0x1F269E567DA0908FULL,
+            0xC1EEF483CBF95B03ULL, 0x5C5AF2A751DDDAD9ULL, 0x0A18679AD722D3B3ULL,
+            0x0BC196B1625289C4ULL, 0x6CD71D81FEBBC627ULL, 0x4CE60BE5C7BE228FULL,
+            0xA89C80F7F4B95417ULL
+        }
+    },
+    { // Black
+        { // King
+            0xDCB3C1AE78C1EBC2ULL, 0x9DC89CD19CC2F8FFULL, 0xDE0ED9B3EFEEE005ULL,
+            0xE72905E5D28F8D9BULL, 0x195583F1E3C52161ULL, 0x50E1CCC663BADE03ULL,
+            0xC0B2F386C52F20B3ULL, 0x63CED1218AACCFCEULL, 0x8D221652374F8D35ULL,
+            0xDACC7C603B65DAA8ULL, 0x10ABE34815286F26ULL, 0x9F088A5B9B742E1DULL,
+            0xCC6AA6CD55255069ULL, 0x4F3DE27B8714E173ULL, 0x3268CDCA1872AB79ULL,
+            0x9AC0560E38AA81A6ULL, 0x7B9DB65D489E0FFDULL, 0x26F07D2AAA11D55DULL,
+            0xB427D3B19E19FD3EULL, 0x2AE689B1539C6C3EULL, 0xBC8CA295D20D0F28ULL,
+            0xF978F7E5AC3161AFULL, 0x151A72C175C11E93ULL, 0x1204B9C4A0BF6DE5ULL,
+            0x12AF00F25005CD0FULL, 0x918CDA40C62E4263ULL, 0xA20E62CC7A905014ULL,
+            0x9A233F7352AF1F19ULL, 0x3A4BD065A55EC3C4ULL, 0xC3D795093C62F7D9ULL,
+            0x9A6C43E604F0C0B4ULL, 0xCC2854B921CBB0ADULL, 0xC6A5772D42E64D24ULL,
+            0x83CC48D63507D191ULL, 0x056FC6CCFAE626AAULL, 0xE5138EDE6A136004ULL,
+            0x76282AE4DA431E2EULL, 0x9EFEF2DBC28D9BA7ULL, 0x485142204F53EF4CULL,
+            0x1888666266D7EA50ULL, 0xEA878106F595FC9AULL, 0x1FA40022B0885409ULL,
+            0xA73F40A5FA265B20ULL, 0x8CDEBF427E3A3AD7ULL, 0xB9A8C15DF94E282CULL,
+            0x847F1B0CEECB49C6ULL, 0xE017F0D20DC0828AULL, 0x4C91398C253B6BC7ULL,
+            0x6ADD673D2767E584ULL, 0xE55AAD64BD8497E9ULL, 0xF7E6E76A7204B85BULL,
+            0x59172CF91EA21921ULL, 0x9BE2801262B36D3FULL, 0x0FF12FDF15766C49ULL,
+            0xFADDD1DA709A6B69ULL, 0x5C43FD249071AB16ULL, 0xC34D58A7C4F8EC76ULL,
+            0xE806128041459CEBULL, 0x73509298C17D8695ULL, 0x07DCC626F65BCE50ULL,
+            0x6F350CB913EC53D7ULL, 0x9A0490C169A6DB8CULL, 0x2A30B1054C5369CBULL,
+            0x196328C7A3899B00ULL
+        },
+        { // Pawn
+            0xE0178E425BC429F9ULL, 0x425BE22A53051541ULL, 0xAD53D53D24DFE41DULL,
+            0x990FFA689E272C09ULL, 0x2EF58D318E63FA49ULL, 0xE8FC07ED005F13A0ULL,
+            0x8A6D354435B08F66ULL, 0x4D85600FCB9817F8ULL, 0x4A831FD832C19C18ULL,
+            0x64DBDCEA4963DF95ULL, 0x075E3EB6310A628EULL, 0xC43F70B899116D83ULL,
+            0x6370F36249871FFAULL, 0x3E5B9423180A5228ULL, 0xB2FBC5BFC0D57083ULL,
+            0x50EBAA43DAD1527EULL, 0xCAE2120A3686F536ULL, 0xBECA0D22C88CC6DBULL,
+            0x951BDCE8AC9D1795ULL, 0x664DEC193B414BF9ULL, 0x84A75C15B26E59DBULL,
+            0x6383A5D6F989DB0DULL, 0x37D227B3C2090BF3ULL, 0xB187754E4EE792EAULL,
+            0xE08268380CD4DC1FULL, 0x456B5A8908C14196ULL, 0xE786D0E8581CF54EULL,
+            0x9D204779E3D13503ULL, 0x5431A7FB1B012104ULL, 0x0A4E4FD542EA61C0ULL,
+            0x535DEABE4619D110ULL, 0xF7902E027CE7AF89ULL, 0x40FFE9ABC98CA4A0ULL,
+            0x82C4B2864BB2043DULL, 0x07227B8A70060226ULL, 0x7146EB6CC8C23E92ULL,
+            0xED3082A805A45E75ULL, 0x4B2AB5FFEA9640EDULL, 0x57EDC18875CA6D1FULL,
+            0x06FD2B45A61E0DC9ULL, 0x2C641C8AF24BD760ULL, 0xFACE1278B4218C41ULL,
+            0xF8A392B5C20798A9ULL, 0xC391CBB6A6800761ULL, 0x9B2DC108BA76E497ULL,
+            0xF42B1D68E9B37ED0ULL, 0x69F4C18F5395732FULL, 0x36767CA4ADC0E77AULL,
+            0x678EAD5C5088E553ULL, 0xB8E909BE557F46FBULL, 0x60D02E8D9A698BA8ULL,
+            0x69FDB9B70EB08E94ULL, 0x7D27AE2D72765714ULL, 0xA96228E058C57194ULL,
+            0x2CD1659955D2B933ULL, 0x1846FDE7750EFF48ULL, 0x5D15253EE7190FD4ULL,
+            0xF952F2D8E4FC9CD1ULL, 0x05679489FBC1C3F1ULL, 0x71F50BA88B57B952ULL,
+            0xB1302661C72357D3ULL, 0x94CF701D836F6082ULL, 0x1A50EBA7AC7E0FBCULL,
+            0xDA6344CC5720AF6EULL
+        },
+        { // Knight
+            0xDEC0D80B6A0424A1ULL, 0x720D8A7BB74F801DULL, 0x9FB2A9B37456C192ULL,
+            0x5F76AD21263E4A01ULL, 0x7245170763E016F6ULL, 0xA83BB537FC4FD2CAULL,
+            0x8D8AE654D1E44B0FULL, 0x5DF1B5F68E2E0B44ULL, 0x339064C926D295B3ULL,
+            0xF174E39CF4F7F0CBULL, 0xC4C8DEE2FF7C8641ULL, 0xBE58A9C6B7EC17BFULL,
+            0xA46D77AC69BC5E6CULL, 0x4EC43B30042DEF46ULL, 0x900765FDE4BB0420ULL,
+            0x9B9267ADA36808A0ULL, 0xD2BB854B18366D5FULL, 0xBF936C568EA89C0DULL,
+            0x894C96AF3E702D23ULL, 0x86B5CE810C5FD59BULL, 0x3FD590AA8DDDAFA4ULL,
+            0x9EF49C2FB3BEC353ULL, 0xFDCDB780FA5848C7ULL, 0x7C5BA450D3774360ULL,
+            0x4EBC0C75B58425CCULL, 0xAB54A627010328F1ULL, 0x3C8C8C944078B7B5ULL,
+            0xC790E11A30BE4D67ULL, 0x742513C06BECB254ULL, 0x27347DBE04A19992ULL,
+            0xC362EA21C246B946ULL, 0xE64DAAE228735DD4ULL, 0xCC18496876B6066AULL,
+            0x8931703CA8BA4D59ULL, 0x4FF68525BAF51892ULL, 0x189F6F7D3BCF26C8ULL,
+            0x23D55E178BC0E0D4ULL, 0xAA3BABFFFCD15531ULL, 0xA1AC5B564B8FC3EBULL,
+            0x53AAC72974C4BED3ULL, 0x6A35FB29FF15AF9BULL, 0x12DE0E31592EE441ULL,
+            0xA7DD9825B48543D4ULL, 0xF8E9B9E5D85A4E1AULL, 0x8DF87EAA10BD2AF9ULL,
+            0x8F5E9B689E7B095DULL, 0x5CF0B110E88F496BULL, 0x4F5FDAFB833CAB60ULL,
+            0x6D7F6CB68BBEC23FULL, 0xBE8BE16C7DA59265ULL, 0xAE77D507FAC7D4D5ULL,
+            0x0EF31056E6127FCEULL, 0xE38A457CA9BF21C9ULL, 0xE4013D02C18D2B26ULL,
+            0xBF551CC5BDE9A8CDULL, 0xD694168C14B6A9ABULL, 0xA94665D79F89C3ECULL,
+            0x8B0C32AC5C93FA2DULL, 0x2DAC0F01FBF7E614ULL, 0xB2878FB33BCCE4D3ULL,
+            0x032EC4484853B328ULL, 0x1C58564E0C426EEAULL, 0x37893DA1B90A7B93ULL,
+            0x3BDCAD4A05F0B63DULL
+        },
+        { // Bishop
+            0xCBD2C9873096A6BFULL, 0x0B9610450233408DULL, 0xD04023BC413AC8BDULL,
+            0x43ADFAD48DA2E936ULL, 0x0697FC9815D159C2ULL, 0x1DCDE2E803562FCAULL,
+            0xA3CA9D8676211AC4ULL, 0x5BEDADAC5AE2F8A8ULL, 0x6E91F7D2A2CB713CULL,
+            0x642D10959C93FBAAULL, 0x62ECCEDD0248852AULL, 0xDE997F80E2D8C210ULL,
+            0x40D9FFF1D075E8B0ULL, 0x16CCA90957E9AD19ULL, 0xA1D54C523815811CULL,
+            0xC142DC5C8BA93359ULL, 0x1B3D8D14D43C3A43ULL, 0xA219D7FA28EB0062ULL,
+            0x6C5CEE3FEDD638C5ULL, 0xD9866B2311475569ULL, 0x7183814154C1C79CULL,
+            0x248773A697F2F8FFULL, 0xB8901FA9B57C31F5ULL, 0x4B3702D12C66BBE5ULL,
+            0x5F4D19438B97E64EULL, 0x469EECDAE9B76D09ULL, 0xA84B46F910BDD348ULL,
+            0xBC3385153E4FA48DULL, 0x86C21EB94D2268F6ULL, 0x1200EB8B06355C15ULL,
+            0xD9B85B02016012A1ULL, 0xDEF3F51D437A0D1FULL, 0xA5BB3BDAC8BB0540ULL,
+            0x5A8A09B62E344F5AULL, 0x54B585438F607DB4ULL, 0x9DEE245D12F7D589ULL,
+            0xB632CB81B8B0A038ULL, 0x8783C5317B073395ULL, 0xBA5990626C3F7CA9ULL,
+            0x897DB77DB1B795A5ULL, 0x14C2F947BBA9DA01ULL, 0x61812533E4369DB0ULL,
+            0xDE8D55FFD55AAB51ULL, 0x2616D84EA93A4024ULL, 0x5C5A27FE0DDF08CBULL,
+            0x77A86E3AAFB6BEE4ULL, 0x9845B2893C4C5DECULL, 0x33F0A604EC7BA500ULL,
+            0xA1491CAE0A6B9915ULL, 0x9428BC8CF09FC738ULL, 0x1565517C5CE24926ULL,
+            0x62F05AEC0D5A02A3ULL, 0xBFE2D8F81E121D77ULL, 0x46B4938B537FA843ULL,
+            0x444FAA85B59D2204ULL, 0xFA2A07C4D64B904EULL, 0x55B885AAA99663E8ULL,
+            0x1F25A90BD2BB56D1ULL, 0x9CCA5B7247D91EC2ULL, 0x71091EA2678DC8C7ULL,
+            0x3E0593A31BD6AD35ULL, 0xD2F8868808464EA7ULL, 0x17D7ABF838A09400ULL,
+            0xBB445525BA9E3953ULL
+        },
+        { // Rook
+            0x4EFAABE97350B109ULL, 0xD57D783EBD2438BFULL, 0xE5C7FE73AEF002B3ULL,
+            0x1C2D011C7DA5772AULL, 0x09AA97CC140BEF12ULL, 0x373061C70DD9184BULL,
+            0xE91F21C813207A4BULL, 0x2EFFFCC57FCBEF09ULL, 0x2325FB32FC3D8833ULL,
+            0x96C63DF6716CF0F1ULL, 0xAF1D7117C8C34506ULL, 0xEB37DBB631BD91F6ULL,
+            0x4AA36B3C3DF95CE0ULL, 0xD431046909DDBB1BULL, 0x7A25360559770B65ULL,
+            0x13EFADE784D2E612ULL, 0xC1BE59F8556A460EULL, 0xBACC3A3A7373E57EULL,
+            0x1CFC1A80B3B0F618ULL, 0xC79DD5D131F086ADULL, 0xD129583CE3671134ULL,
+            0xE6FF6D0186746090ULL, 0xB9F2DAE299EDF3F2ULL, 0xC48884A041A70473ULL,
+            0xD123B02DA20D37DAULL, 0x04A2BDB80833587EULL, 0xBAE07FE257A90793ULL,
+            0x0BE45E1E8B49D470ULL, 0x4D3357DFDFD8FB9AULL, 0x4419316ADC602B5CULL,
+            0x4AF8BDE2A24C9909ULL, 0x8080C9519E4A3E16ULL, 0x46DC818DC74C8074ULL,
+            0x94F3A73CB55F03E8ULL, 0x6671662D7A193985ULL, 0x59367E457CCF78B7ULL,
+            0x701CF639FDA62091ULL, 0xAF0984DA5D1A5D5AULL, 0xBE69D5FF89CB96DEULL,
+            0x750C8F01D807A2CDULL, 0xFDBBD97A42062294ULL, 0x34E2C18BC2B8FCBFULL,
+            0x2AE953B55DC8E08AULL, 0xE01D43B2EDE73445ULL, 0xA6501FEC0CE76CFCULL,
+            0x0EF576B96BBCADC8ULL, 0xF8814FEB644A48A9ULL, 0x50B4995AA0B609DAULL,
+            0x63FBA8BD20AFF983ULL, 0x7B5F11AE0B515932ULL, 0x616DC5FA4E959681ULL,
+            0x379B2F5C26AD28FDULL, 0x31BB9787D2F5201AULL, 0x90D1AB3CACF701CFULL,
+            0x2B73908D71A0668BULL, 0xDAAB6149AB84D57DULL, 0x01640491103D2DFFULL,
+            0xF3FE0BFCEDE97C48ULL, 0x597327DE2E42498DULL, 0x2F67F1D699E45EB0ULL,
+            0x1557C686DDCCA93AULL, 0x22A43153117F48B6ULL, 0x869345CEEC8C447FULL,
+            0x51CCF4C5D02E87FCULL
+        },
+        { // Queen
+            0x6239642383CA87BBULL, 0xF9DB709CF353F4AAULL, 0x1E9CB8BD444EC60AULL,
+            0xC46DBEF449D58A48ULL, 0x6E976FFFEF99C20FULL, 0x655D63D4DA342947ULL,
+            0xDF24DC6FD6725469ULL, 0xC23C0B6BAC3CDAD2ULL, 0xC92F894BBBA30914ULL,
+            0xDCEAACB1852B0034ULL, 0x038EA3643098A4ADULL, 0x02DEFA155A012CE6ULL,
+            0x54E45306FCFD7572ULL, 0x35581369C9761142ULL, 0x49D912286EB7DA0BULL,
+            0xC463BD36D7FFE236ULL, 0xFAA652CC9EFC2348ULL, 0xD998CE014193AF00ULL,
+            0x84C617442ABAA6EAULL, 0x8E1832793B64329CULL, 0xA114C10A8FDFD67DULL,
+            0x45F19FCCC8065B04ULL, 0x79871F626D373EE9ULL, 0xCC4C5BC74E6654A2ULL,
+            0xCC64D623291CBAFAULL, 0xACB5A32F3E4DA867ULL, 0x9CE597C5F3C7583AULL,
+            0xB77145151EB98B1FULL, 0x831F430A03958DD4ULL, 0x04187FFF458A49C8ULL,
+            0xB88A8E20E77991B3ULL, 0x47EBF014752D65DFULL, 0x42D323EC93BA889FULL,
+            0xA0548C8FFA14C7D0ULL, 0x8CE5C937CE89EB81ULL, 0x322D4C8E8811B5ADULL,
+            0x91F7FE6CBF75490CULL, 0xCC8D6B2AC75B2897ULL, 0xBCB2847F16722F4BULL,
+            0x522045A4022BB6F8ULL, 0x97C4432DBF7E3921ULL, 0xBCD1E24E5E18154EULL,
+            0x3264D1DE54B62CEFULL, 0xBFC4F46F8BB536CDULL, 0x3AF257F266710807ULL,
+            0x35BC8F4557B74858ULL, 0x8732414DB7C3D7B9ULL, 0xBCB9C760E6C2BD83ULL,
+            0x5E66EE7FC96C8E92ULL, 0xF0C861FDD849C0F6ULL, 0x1CEA68564B289E6EULL,
+            0x354750DAD47C5A9EULL, 0x2FEB042AF9D4CC57ULL, 0xA6B44CDF5001167EULL,
+            0x16D821CE218AC668ULL, 0x1BEC7C5FB7F08639ULL, 0x005D50A737C19435ULL,
+            0x4670C4F8850D9E29ULL, 0x6AA97B8C235B9CDCULL, 0x42887FB13B3D8EDEULL,
+            0x6500ACCEC17C0805ULL, 0x5F2D3D1612C02635ULL, 0xB2B5632A51D92428ULL,
+            0xA753B494D429436AULL
+        }
+    }
+};
+
+uint64_t const mt_chess_zobrist_castling[16] = {
+    0x3158A0C26E66FC23ULL, 0x4C3DABA38F37BC49ULL, 0x4FFC9E72A555C88DULL,
+    0x895EA1BD20505B55ULL, 0x56C5C3A649D4D1A4ULL, 0x0857927A39AA1077ULL,
+    0xCB0DBEDCDC3CECBEULL, 0xEB0A19BE2AED4F38ULL, 0x2366C18A096BA81DULL,
+    0x65388E991654C73AULL, 0x88B2BD210CA84C81ULL, 0x545A9C130A8AF0B1ULL,
+    0xB918DFC157011566ULL, 0x30C4419FECF113C1ULL, 0x2E943485306930CEULL,
+    0xC3C812C6778C324DULL
+};
+
+uint64_t const mt_chess_zobrist_en_passant[8] = {
+    0x20B54A806AEC7C35ULL, 0xF4C1423782207FF8ULL, 0xDDB9B1208A734122ULL,
+    0x4A9D6BCAF2E8E65BULL, 0x0FEF74E72FC87E2AULL, 0xCEA44B0356CB15F1ULL,
+    0xF040CF728E114ABAULL, 0x6A4E6A81FBD1B9ACULL
+};
+
+uint64_t const mt_chess_zobrist_black = 0x37EB94426221FF05ULL;
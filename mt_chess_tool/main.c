@@ -0,0 +1,126 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cstdio>
+    #include <cstring>
+#else //__cplusplus
+    #include <stdio.h>
+    #include <string.h>
+#endif //__cplusplus
+
+#include "mt_chess_tool_perft.h"
+#include "mt_chess_tool_bench.h"
+#include "mt_chess_tool_server.h"
+#include "mt_chess_tool_loadgen.h"
+#include "mt_chess_tool_selfplay.h"
+#include "mt_chess_tool_replay.h"
+#include "mt_chess_tool_index.h"
+#include "mt_chess_tool_gentables.h"
+#include "mt_chess_tool_analyze.h"
+#include "mt_chess_tool_batch.h"
+#include "mt_chess_tool_gendata.h"
+#include "mt_chess_trace.h"
+#include "mt_chess_thread.h"
+
+// Spans per thread recorded with "--trace=<file>" (32 bytes each):
+//
+static int const s_trace_spans = 1 << 18;
+
+struct command
+{
+    char const * name;
+    int (*main)(int const argc, char * * const argv);
+};
+
+static struct command const s_commands[] = {
+    { "perft", mt_chess_tool_perft_main },
+    { "bench", mt_chess_tool_bench_main },
+    { "server", mt_chess_tool_server_main },
+    { "loadgen", mt_chess_tool_loadgen_main },
+    { "selfplay", mt_chess_tool_selfplay_main },
+    { "replay", mt_chess_tool_replay_main },
+    { "index", mt_chess_tool_index_main },
+    { "gentables", mt_chess_tool_gentables_main },
+    { "analyze", mt_chess_tool_analyze_main },
+    { "batch", mt_chess_tool_batch_main },
+    { "gendata", mt_chess_tool_gendata_main }
+};
+
+static void print_usage(void)
+{
+    printf(
+        "Usage: mt_chess_tool [--trace=<file>] <command> [arguments]\n\nCommands:\n");
+    for(size_t i = 0; i < sizeof s_commands / sizeof *s_commands; ++i)
+    {
+        printf("  %s\n", s_commands[i].name);
+    }
+}
+
+/**
+ * - Runs given command, writing a Chrome trace-event JSON file, if a path is
+ *   given (and the library was built with MT_CHESS_TRACE_ENABLED).
+ */
+static int run(
+    struct command const * const command,
+    char const * const trace_path,
+    int const argc,
+    char * * const argv)
+{
+    if(trace_path == NULL)
+    {
+        return command->main(argc, argv);
+    }
+    if(!mt_chess_trace_start(
+        2 * mt_chess_thread_get_cpu_count() + 2, s_trace_spans))
+    {
+        printf("Error: Tracing is not available (see mt_chess_trace.h)!\n");
+        return 1;
+    }
+
+    int const ret_val = command->main(argc, argv);
+    uint64_t dropped = 0;
+
+    if(!mt_chess_trace_stop(trace_path, &dropped))
+    {
+        printf("Error: Failed to write \"%s\"!\n", trace_path);
+        return 1;
+    }
+    printf(
+        "Trace written to \"%s\" (%llu span(-s) dropped).\n",
+        trace_path,
+        (unsigned long long)dropped);
+    return ret_val;
+}
+
+int main(int argc, char * argv[])
+{
+    static char const trace_prefix[] = "--trace=";
+
+    char const * trace_path = NULL;
+
+    if(2 <= argc
+        && strncmp(argv[1], trace_prefix, sizeof trace_prefix - 1) == 0)
+    {
+        trace_path = argv[1] + sizeof trace_prefix - 1;
+        --argc;
+        ++argv;
+    }
+
+    if(argc < 2)
+    {
+        print_usage();
+        return 1;
+    }
+
+    for(size_t i = 0; i < sizeof s_commands / sizeof *s_commands; ++i)
+    {
+        if(strcmp(argv[1], s_commands[i].name) == 0)
+        {
+            return run(s_commands + i, trace_path, argc - 2, argv + 2);
+        }
+    }
+
+    printf("Unknown command \"%s\".\n\n", argv[1]);
+    print_usage();
+    return 1;
+}
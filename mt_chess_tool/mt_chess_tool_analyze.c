@@ -0,0 +1,178 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstdbool>
+    #include <cstdio>
+    #include <cstdlib>
+    #include <cstring>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stdbool.h>
+    #include <stdio.h>
+    #include <stdlib.h>
+    #include <string.h>
+#endif //__cplusplus
+
+#include "mt_chess_tool_analyze.h"
+#include "mt_chess_search_async.h"
+#include "mt_chess_search.h"
+#include "mt_chess_data.h"
+#include "mt_chess_movegen.h"
+#include "mt_chess_move.h"
+#include "mt_chess_san.h"
+
+static void print_score(int const score)
+{
+    int const abs_score = score < 0 ? -score : score;
+
+    if(MT_CHESS_SEARCH_MATE - MT_CHESS_SEARCH_MAX_DEPTH <= abs_score)
+    {
+        int const moves = (MT_CHESS_SEARCH_MATE - abs_score + 1) / 2;
+
+        printf("mate %d", score < 0 ? -moves : moves);
+        return;
+    }
+    printf("%d", score);
+}
+
+/**
+ * - Prints given moves in SAN, starting at given position.
+ */
+static void print_pv(
+    struct mt_chess_data const * const data,
+    uint16_t const * const pv,
+    int const pv_len)
+{
+    struct mt_chess_data cur = *data;
+    struct mt_chess_move_list list;
+    char str[MT_CHESS_SAN_STR_SIZE];
+
+    for(int i = 0; i < pv_len; ++i)
+    {
+        mt_chess_movegen_get_legal(&cur, &list);
+        mt_chess_san_get_str(&cur, &list, pv[i], str);
+        printf(" %s", str);
+        mt_chess_data_apply_move(&cur, pv[i], NULL);
+    }
+}
+
+static void on_iteration(
+    void * const ctx, struct mt_chess_search_info const * const info)
+{
+    struct mt_chess_data const * const data =
+        (struct mt_chess_data const *)ctx;
+    uint64_t const ms = info->time_ns / 1000000;
+
+    printf("depth %2d line %2d score ", info->depth, info->line + 1);
+    print_score(info->score);
+    printf(
+        " nodes %llu time %llu ms nps %llu pv",
+        (unsigned long long)info->nodes,
+        (unsigned long long)ms,
+        (unsigned long long)(info->time_ns == 0
+            ? 0 : info->nodes * 1000000000 / info->time_ns));
+    print_pv(data, info->pv, info->pv_len);
+    printf("\n");
+    fflush(stdout);
+}
+
+static void on_done(
+    void * const ctx, struct mt_chess_search_result const * const result)
+{
+    struct mt_chess_data const * const data =
+        (struct mt_chess_data const *)ctx;
+
+    if(result->move == 0)
+    {
+        printf("No legal move.\n");
+    }
+    else
+    {
+        struct mt_chess_move_list list;
+        char str[MT_CHESS_SAN_STR_SIZE];
+
+        mt_chess_movegen_get_legal(data, &list);
+        mt_chess_san_get_str(data, &list, result->move, str);
+        printf(
+            "Best move: %s (depth %d, %llu nodes).\n",
+            str,
+            result->depth,
+            (unsigned long long)result->nodes);
+    }
+    fflush(stdout);
+}
+
+int mt_chess_tool_analyze_main(int const argc, char * * const argv)
+{
+    static char const multi_pv_prefix[] = "--multipv=";
+
+    bool const has_multi_pv = 1 <= argc
+        && strncmp(argv[0], multi_pv_prefix, sizeof multi_pv_prefix - 1) == 0;
+    int const multi_pv = has_multi_pv
+        ? atoi(argv[0] + sizeof multi_pv_prefix - 1) : 1;
+
+    if(multi_pv < 1 || MT_CHESS_SEARCH_MAX_MULTI_PV < multi_pv)
+    {
+        printf(
+            "Error: MultiPV count must be between 1 and %d!\n",
+            MT_CHESS_SEARCH_MAX_MULTI_PV);
+        return 1;
+    }
+
+    struct mt_chess_data data;
+    struct mt_chess_move_list list;
+
+    mt_chess_data_init(&data);
+    for(int i = has_multi_pv ? 1 : 0; i < argc; ++i)
+    {
+        mt_chess_movegen_get_legal(&data, &list);
+
+        uint16_t move =
+            mt_chess_move_find_str(argv[i], list.moves, list.count);
+
+        if(move == 0)
+        {
+            move = mt_chess_san_find_str(argv[i], &data, &list);
+        }
+
+        if(move == 0)
+        {
+            printf("Error: Illegal move \"%s\"!\n", argv[i]);
+            return 1;
+        }
+        mt_chess_data_apply_move(&data, move, NULL);
+    }
+
+    struct mt_chess_search_async * const async = mt_chess_search_async_create();
+
+    if(async == NULL)
+    {
+        printf("Error: Failed to start search thread!\n");
+        return 1;
+    }
+
+    struct mt_chess_search_limits limits;
+
+    mt_chess_search_init_limits(&limits);
+    limits.multi_pv = multi_pv;
+    limits.on_iteration = on_iteration;
+    limits.ctx = &data; // (not changed during the search)
+
+    printf("Searching, enter a line to stop.\n");
+    fflush(stdout);
+
+    mt_chess_search_async_start(async, &data, &limits, on_done);
+
+    // Blocks on input, only (the search reports via the functions above). Any
+    // line or the end of input stops the search:
+
+    char line[64];
+    char const * const got = fgets(line, (int)sizeof line, stdin);
+
+    (void)got;
+    mt_chess_search_async_stop(async);
+    mt_chess_search_async_wait(async);
+    mt_chess_search_async_free(async);
+    return 0;
+}
@@ -0,0 +1,25 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_TOOL_ANALYZE
+#define MT_CHESS_TOOL_ANALYZE
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+/**
+ * - Command-line entry point ("analyze [--multipv=<n>] [moves]").
+ * - Searches the position after given moves (coordinate notation or SAN) from
+ *   the start position in the background (see mt_chess_search_async.h),
+ *   printing each completed iteration, until a line is read from stdin (or
+ *   end of input).
+ * - Prints the best n moves (default 1) with their scores and principal
+ *   variations per iteration, if given.
+ */
+int mt_chess_tool_analyze_main(int const argc, char * * const argv);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_TOOL_ANALYZE
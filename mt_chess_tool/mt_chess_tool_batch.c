@@ -0,0 +1,184 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstdlib>
+    #include <cstdio>
+    #include <cstring>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stdlib.h>
+    #include <stdio.h>
+    #include <string.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_tool_batch.h"
+#include "mt_chess_batch.h"
+#include "mt_chess_search.h"
+#include "mt_chess_data.h"
+#include "mt_chess_fen.h"
+#include "mt_chess_move.h"
+#include "mt_chess_clock.h"
+
+// Longest input line accepted (longer ones are invalid):
+//
+#define MT_BATCH_LINE_SIZE 256
+
+struct batch
+{
+    FILE * in;
+    FILE * out;
+    uint64_t count; // Positions reported.
+    uint64_t invalid_count;
+    bool write_failed;
+};
+
+static enum mt_chess_batch_next get_next(
+    void * const ctx, struct mt_chess_data * const out_data)
+{
+    struct batch * const batch = (struct batch *)ctx;
+    char line[MT_BATCH_LINE_SIZE];
+
+    if(fgets(line, (int)sizeof line, batch->in) == NULL)
+    {
+        return mt_chess_batch_next_end;
+    }
+
+    size_t const len = strlen(line);
+
+    if(len == sizeof line - 1 && line[len - 1] != '\n')
+    {
+        int c;
+
+        do // Skipping the rest of the (too long) line.
+        {
+            c = fgetc(batch->in);
+        }while(c != '\n' && c != EOF);
+        return mt_chess_batch_next_invalid;
+    }
+    return mt_chess_fen_read(line, out_data)
+        ? mt_chess_batch_next_position : mt_chess_batch_next_invalid;
+}
+
+static void on_result(
+    void * const ctx,
+    uint64_t const index,
+    struct mt_chess_search_result const * const result)
+{
+    struct batch * const batch = (struct batch *)ctx;
+    int written;
+
+    (void)index; // (results come in input order)
+
+    ++batch->count;
+    if(result == NULL)
+    {
+        ++batch->invalid_count;
+        written = fprintf(batch->out, "invalid\n");
+    }
+    else
+    {
+        char move_str[MT_CHESS_MOVE_STR_SIZE] = "-";
+
+        if(result->move != 0)
+        {
+            mt_chess_move_get_str(result->move, move_str);
+        }
+        written = fprintf(
+            batch->out,
+            "%s %d %d %llu\n",
+            move_str,
+            result->score,
+            result->depth,
+            (unsigned long long)result->nodes);
+    }
+    if(written < 0)
+    {
+        batch->write_failed = true;
+    }
+}
+
+int mt_chess_tool_batch_main(int const argc, char * * const argv)
+{
+    struct mt_chess_search_limits limits;
+    int const limit = 4 <= argc ? atoi(argv[3]) : 0;
+    int const threads = 5 <= argc ? atoi(argv[4]) : 0;
+
+    mt_chess_search_init_limits(&limits);
+    if(argc < 4 || 5 < argc || limit < 1 || threads < 0)
+    {
+        limits.depth = 0; // (invalid)
+    }
+    else if(strcmp(argv[2], "depth") == 0)
+    {
+        limits.depth = limit < MT_CHESS_SEARCH_MAX_DEPTH
+            ? limit : MT_CHESS_SEARCH_MAX_DEPTH;
+    }
+    else if(strcmp(argv[2], "nodes") == 0)
+    {
+        limits.nodes = (uint64_t)limit;
+    }
+    else
+    {
+        limits.depth = 0;
+    }
+    if(limits.depth == 0)
+    {
+        printf(
+            "Usage: batch <input file> <output file> <depth | nodes> <limit> [threads]\n"
+            "       (input file holds one FEN per line)\n");
+        return 1;
+    }
+
+    struct batch batch;
+
+    batch.in = fopen(argv[0], "r");
+    if(batch.in == NULL)
+    {
+        printf("Error: Failed to open \"%s\"!\n", argv[0]);
+        return 1;
+    }
+    batch.out = fopen(argv[1], "w");
+    if(batch.out == NULL)
+    {
+        printf("Error: Failed to create \"%s\"!\n", argv[1]);
+        fclose(batch.in);
+        return 1;
+    }
+    batch.count = 0;
+    batch.invalid_count = 0;
+    batch.write_failed = false;
+
+    uint64_t const start = mt_chess_clock_get_ns();
+    bool const ran = mt_chess_batch_run(
+        &limits, threads, get_next, on_result, &batch);
+    uint64_t const ns = mt_chess_clock_get_ns() - start;
+
+    fclose(batch.in);
+    if(fclose(batch.out) != 0)
+    {
+        batch.write_failed = true;
+    }
+    if(!ran)
+    {
+        printf("Error: Failed to start threads!\n");
+        return 1;
+    }
+    if(batch.write_failed)
+    {
+        printf("Error: Failed to write \"%s\"!\n", argv[1]);
+        return 1;
+    }
+
+    double const s = (double)ns / 1000000000.0;
+
+    printf(
+        "Positions: %llu (%llu invalid) in %.3f s (%.1f positions/s)\n",
+        (unsigned long long)batch.count,
+        (unsigned long long)batch.invalid_count,
+        s,
+        0.0 < s ? (double)batch.count / s : 0.0);
+    return 0;
+}
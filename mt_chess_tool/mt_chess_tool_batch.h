@@ -0,0 +1,32 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_TOOL_BATCH
+#define MT_CHESS_TOOL_BATCH
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+/**
+ * - Command-line entry point ("batch <input file> <output file> <depth |
+ *   nodes> <limit> [threads]").
+ * - Searches each position of the input file (one FEN per line) with given
+ *   depth or node limit on multiple threads (see mt_chess_batch.h) and
+ *   writes one line per position to the output file (in input order), while
+ *   reading, so memory use does not grow with the file sizes:
+ *
+ *   <best move> <score> <depth> <nodes>
+ *
+ *   The best move is in coordinate notation ("-" without legal moves), the
+ *   score in centipawns from the view of the player having the turn. Lines
+ *   with an invalid FEN get "invalid".
+ *
+ * - Prints the count of positions and the positions per second.
+ */
+int mt_chess_tool_batch_main(int const argc, char * * const argv);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_TOOL_BATCH
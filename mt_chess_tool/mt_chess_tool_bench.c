@@ -0,0 +1,721 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+// Output:
+//
+// - Text (default): Memory layout, then one line per benchmark.
+// - CSV ("csv" argument): Header line, then one line per benchmark with name,
+//   iterations, ns/op, op/s and allocations/op (for tracking regressions).
+// - Text output ends with the library's hot-path stats, if built with
+//   MT_CHESS_STATS_ENABLED (see mt_chess_stats.h).
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstdlib>
+    #include <cstdio>
+    #include <cstring>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stdlib.h>
+    #include <stdio.h>
+    #include <string.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_tool_bench.h"
+#include "mt_chess.h"
+#include "mt_chess_data.h"
+#include "mt_chess_game.h"
+#include "mt_chess_check.h"
+#include "mt_chess_piece.h"
+#include "mt_chess_log_node.h"
+#include "mt_chess_log_pool.h"
+#include "mt_chess_move.h"
+#include "mt_chess_movegen.h"
+#include "mt_chess_str.h"
+#include "mt_chess_snapshot.h"
+#include "mt_chess_san.h"
+#include "mt_chess_search.h"
+#include "mt_chess_clock.h"
+#include "mt_chess_mem.h"
+
+#define MT_BENCH_CLONES 64 // Destination count (must be a power of two).
+
+static uint64_t const s_default_iterations = 1000000;
+
+// Each benchmark runs this fraction of the iterations untimed, first:
+static uint64_t const s_warm_up_div = 10;
+
+static int const s_long_game_plies = 300;
+
+static struct mt_chess_data s_clones[MT_BENCH_CLONES];
+
+// Shared by the benchmarks (set up by set_up()):
+static struct mt_chess_data s_data; // Start position.
+static struct mt_chess_move_list s_list; // Legal moves of s_data.
+static struct mt_chess_game * s_game; // Start position, for try-move.
+static struct mt_chess_game * s_long_game; // Long game of random moves.
+static struct mt_chess_game * s_restored; // Restored from snapshots.
+static uint8_t * s_snapshot; // Snapshot of the long game.
+
+struct benchmark
+{
+    char const * name;
+
+    // Runs given count of iterations and returns a checksum (to keep the
+    // compiler from dropping the work):
+    uint64_t (*run)(uint64_t const iterations);
+
+    // Slower benchmarks run the count of iterations divided by this:
+    uint64_t iterations_div;
+};
+
+static uint64_t get_random(uint64_t * const state)
+{
+    // xorshift64:
+
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+/**
+ * - Plays random legal moves until the game is over or has given count of
+ *   plies.
+ */
+static void play_random(
+    struct mt_chess_game * const game,
+    int const max_plies,
+    uint64_t * const random)
+{
+    struct mt_chess_move_list list;
+
+    while(game->ply_count < max_plies)
+    {
+        mt_chess_movegen_get_legal(&game->data, &list);
+        if(list.count == 0)
+        {
+            break;
+        }
+        mt_chess_game_do_move(
+            game, list.moves[get_random(random) % (uint64_t)list.count]);
+    }
+}
+
+static void set_up(void)
+{
+    uint64_t random = 0x9E3779B97F4A7C15ULL;
+
+    mt_chess_data_init(&s_data);
+    mt_chess_movegen_get_legal(&s_data, &s_list);
+    assert(0 < s_list.count);
+
+    s_game = mt_chess_game_create();
+
+    // Find a seed giving a game of full length (random games rarely end that
+    // early, anyway):
+    //
+    s_long_game = mt_chess_game_create();
+    do
+    {
+        mt_chess_game_reset(s_long_game);
+        play_random(s_long_game, s_long_game_plies, &random);
+    }while(s_long_game->ply_count < s_long_game_plies);
+
+    s_restored = mt_chess_game_create();
+    s_snapshot = (uint8_t *)mt_chess_mem_alloc(
+        mt_chess_snapshot_get_size(s_long_game));
+}
+
+static void tear_down(void)
+{
+    mt_chess_mem_free(s_snapshot);
+    mt_chess_game_free(s_restored);
+    mt_chess_game_free(s_long_game);
+    mt_chess_game_free(s_game);
+}
+
+static uint64_t bench_clone(uint64_t const iterations)
+{
+    uint64_t sum = 0;
+
+    for(uint64_t i = 0; i < iterations; ++i)
+    {
+        s_clones[i & (MT_BENCH_CLONES - 1)] = s_data; // (a memcpy())
+
+        sum += s_clones[(i * 7) & (MT_BENCH_CLONES - 1)].ply;
+    }
+    return sum;
+}
+
+static uint64_t bench_clone_and_apply_move(uint64_t const iterations)
+{
+    uint64_t sum = 0;
+
+    for(uint64_t i = 0; i < iterations; ++i)
+    {
+        struct mt_chess_data * const clone =
+            s_clones + (i & (MT_BENCH_CLONES - 1));
+
+        *clone = s_data;
+        mt_chess_data_apply_move(
+            clone, s_list.moves[i % (uint64_t)s_list.count], NULL);
+
+        sum += clone->board[i & 63];
+    }
+    return sum;
+}
+
+static uint64_t bench_movegen_legal(uint64_t const iterations)
+{
+    uint64_t sum = 0;
+    struct mt_chess_move_list list;
+
+    for(uint64_t i = 0; i < iterations; ++i)
+    {
+        mt_chess_movegen_get_legal(&s_data, &list);
+        sum += (uint64_t)list.count;
+    }
+    return sum;
+}
+
+static uint64_t bench_san_write(uint64_t const iterations)
+{
+    uint64_t sum = 0;
+    char str[MT_CHESS_SAN_STR_SIZE];
+
+    for(uint64_t i = 0; i < iterations; ++i)
+    {
+        mt_chess_san_get_str(
+            &s_data, &s_list, s_list.moves[i % (uint64_t)s_list.count], str);
+        sum += (uint64_t)str[0];
+    }
+    return sum;
+}
+
+static uint64_t bench_san_parse(uint64_t const iterations)
+{
+    static char const * const s_strs[] = { "e4", "Nf3", "Nbc3", "a3+", "h4!?" };
+
+    uint64_t sum = 0;
+
+    for(uint64_t i = 0; i < iterations; ++i)
+    {
+        sum += mt_chess_san_find_str(
+            s_strs[i % (sizeof s_strs / sizeof *s_strs)], &s_data, &s_list);
+    }
+    return sum;
+}
+
+static uint64_t bench_try_move_legal(uint64_t const iterations)
+{
+    uint64_t sum = 0;
+
+    for(uint64_t i = 0; i < iterations; ++i)
+    {
+        char const * msg = NULL;
+        bool const done = mt_chess_try_move_in_game(
+            s_game, 'e', '2', 'e', '4', &msg);
+
+        assert(done);
+        sum += (uint64_t)done;
+        mt_chess_game_undo(s_game); // (to try the same move again)
+    }
+    return sum;
+}
+
+static uint64_t bench_try_move_illegal(uint64_t const iterations)
+{
+    uint64_t sum = 0;
+
+    for(uint64_t i = 0; i < iterations; ++i)
+    {
+        char const * msg = NULL;
+        bool const done = mt_chess_try_move_in_game(
+            s_game, 'e', '2', 'e', '5', &msg);
+
+        assert(!done && msg != NULL);
+        sum += (uint64_t)(uintptr_t)msg;
+    }
+    return sum;
+}
+
+static uint64_t bench_get_targets(uint64_t const iterations)
+{
+    uint64_t sum = 0;
+
+    for(uint64_t i = 0; i < iterations; ++i)
+    {
+        sum += mt_chess_get_targets_in_game(
+            s_game, (char)('a' + i % 8), i % 2 == 0 ? '1' : '2');
+    }
+    return sum;
+}
+
+static uint64_t bench_get_movable(uint64_t const iterations)
+{
+    uint64_t sum = 0;
+
+    for(uint64_t i = 0; i < iterations; ++i)
+    {
+        sum += mt_chess_get_movable_in_game(s_game);
+    }
+    return sum;
+}
+
+/**
+ * - Searches the start position to a fixed depth keeping given count of
+ *   principal variations (time-to-depth of MultiPV compared with single-PV).
+ */
+static uint64_t bench_search(uint64_t const iterations, int const multi_pv)
+{
+    uint64_t sum = 0;
+    struct mt_chess_search_limits limits;
+    struct mt_chess_search_result result;
+
+    mt_chess_search_init_limits(&limits);
+    limits.depth = 4;
+    limits.multi_pv = multi_pv;
+    for(uint64_t i = 0; i < iterations; ++i)
+    {
+        mt_chess_search_get_best(&s_data, &limits, &result);
+        sum += result.nodes;
+    }
+    return sum;
+}
+
+static uint64_t bench_search_depth4(uint64_t const iterations)
+{
+    return bench_search(iterations, 1);
+}
+
+static uint64_t bench_search_depth4_multi_pv4(uint64_t const iterations)
+{
+    return bench_search(iterations, 4);
+}
+
+static uint64_t bench_move_apply(uint64_t const iterations)
+{
+    uint64_t sum = 0;
+    uint8_t board[8 * 8];
+
+    for(uint64_t i = 0; i < iterations; ++i)
+    {
+        memcpy(board, s_data.board, sizeof board);
+        mt_chess_move_apply(s_list.moves[i % (uint64_t)s_list.count], board);
+        sum += board[i & 63];
+    }
+    return sum;
+}
+
+static uint64_t bench_check_update(uint64_t const iterations)
+{
+    uint64_t sum = 0;
+    struct mt_chess_data data = s_data;
+
+    for(uint64_t i = 0; i < iterations; ++i)
+    {
+        data.turn = (uint8_t)(i & 1);
+        mt_chess_data_update_check(&data);
+        sum += data.check.danger >> (i & 63);
+    }
+    return sum;
+}
+
+static uint64_t bench_piece_get_index(uint64_t const iterations)
+{
+    uint64_t sum = 0;
+
+    for(uint64_t i = 0; i < iterations; ++i)
+    {
+        sum += (uint64_t)mt_chess_piece_get_index(
+            s_data.pieces, (uint8_t)(1 + (i & 31)));
+    }
+    return sum;
+}
+
+static uint64_t bench_log_get_latest(uint64_t const iterations)
+{
+    uint64_t sum = 0;
+
+    for(uint64_t i = 0; i < iterations; ++i)
+    {
+        sum += mt_chess_log_node_get_latest(s_long_game->log)->move;
+    }
+    return sum;
+}
+
+/**
+ * - Scrubs back and forth between the start and the end of the long game.
+ */
+static uint64_t bench_jump_to_ply(uint64_t const iterations)
+{
+    uint64_t sum = 0;
+
+    for(uint64_t i = 0; i < iterations; ++i)
+    {
+        int const ply = (i & 1) == 0 ? 0 : s_long_game_plies;
+        bool const done = mt_chess_game_jump_to_ply(s_long_game, ply);
+
+        assert(done);
+        sum += (uint64_t)done + s_long_game->data.hash;
+    }
+    mt_chess_game_jump_to_ply(s_long_game, s_long_game_plies);
+    return sum;
+}
+
+static uint64_t bench_board_str(uint64_t const iterations, bool const unicode)
+{
+    uint64_t sum = 0;
+
+    for(uint64_t i = 0; i < iterations; ++i)
+    {
+        char * const str = mt_chess_str_create_board(&s_data, unicode);
+
+        sum += (uint64_t)(unsigned char)str[i & 63];
+        mt_chess_mem_free(str);
+    }
+    return sum;
+}
+
+static uint64_t bench_board_str_ascii(uint64_t const iterations)
+{
+    return bench_board_str(iterations, false);
+}
+
+static uint64_t bench_board_str_unicode(uint64_t const iterations)
+{
+    return bench_board_str(iterations, true);
+}
+
+/**
+ * - Plays random legal moves, restarting the game at its end (or after the
+ *   plies of the long game), like a server with constant game churn does.
+ * - The long game's pool already holds the chunks needed, so no allocations
+ *   are expected.
+ */
+static uint64_t bench_game_churn(uint64_t const iterations)
+{
+    static uint64_t s_random = 0x2545F4914F6CDD1DULL;
+
+    struct mt_chess_game * const game = s_long_game;
+    struct mt_chess_move_list list;
+    uint64_t sum = 0;
+
+    mt_chess_game_reset(game);
+    for(uint64_t i = 0; i < iterations; ++i)
+    {
+        mt_chess_movegen_get_legal(&game->data, &list);
+
+        if(list.count == 0 || s_long_game_plies <= game->ply_count)
+        {
+            mt_chess_game_reset(game); // (O(1), reuses memory)
+            mt_chess_movegen_get_legal(&game->data, &list);
+        }
+        mt_chess_game_do_move(
+            game, list.moves[get_random(&s_random) % (uint64_t)list.count]);
+        sum += game->data.hash;
+    }
+
+    // Restore the long game for the other benchmarks:
+    //
+    do
+    {
+        mt_chess_game_reset(game);
+        play_random(game, s_long_game_plies, &s_random);
+    }while(game->ply_count < s_long_game_plies);
+
+    return sum;
+}
+
+/**
+ * - Writes the long game's snapshot (with moves taken back) and restores it.
+ */
+static uint64_t bench_snapshot_round_trip(uint64_t const iterations)
+{
+    uint64_t sum = 0;
+
+    mt_chess_game_jump_to_ply(s_long_game, s_long_game_plies / 2);
+    for(uint64_t i = 0; i < iterations; ++i)
+    {
+        size_t const size = mt_chess_snapshot_write(s_long_game, s_snapshot);
+
+        mt_chess_snapshot_read(s_snapshot, size, s_restored);
+        sum += s_restored->data.hash;
+    }
+    mt_chess_game_jump_to_ply(s_long_game, s_long_game_plies);
+    return sum;
+}
+
+/**
+ * - Checks that a snapshot of the long game (with moves taken back) restores
+ *   the same game: Same snapshot when written again and same positions and
+ *   legal moves when redoing all moves.
+ * - Returns false, if not.
+ */
+static bool check_snapshot(void)
+{
+    int const ply = s_long_game_plies / 2;
+    size_t const size = mt_chess_snapshot_get_size(s_long_game);
+    uint8_t * const again = (uint8_t *)mt_chess_mem_alloc(size);
+    struct mt_chess_move_list list;
+    struct mt_chess_move_list restored_list;
+    bool ret_val = false;
+
+    mt_chess_game_jump_to_ply(s_long_game, ply);
+    mt_chess_snapshot_write(s_long_game, s_snapshot);
+
+    if(mt_chess_snapshot_read(s_snapshot, size, s_restored)
+        && !mt_chess_snapshot_read(s_snapshot, size - 1, s_restored) // Trunc.
+        && mt_chess_snapshot_read(s_snapshot, size, s_restored)
+        && mt_chess_snapshot_write(s_restored, again) == size
+        && memcmp(s_snapshot, again, size) == 0
+        && s_restored->ply == ply)
+    {
+        bool redone = true;
+
+        ret_val = true;
+        while(ret_val && redone)
+        {
+            mt_chess_movegen_get_legal(&s_long_game->data, &list);
+            mt_chess_movegen_get_legal(&s_restored->data, &restored_list);
+            ret_val = s_long_game->data.hash == s_restored->data.hash
+                && s_long_game->data.check.checkers
+                    == s_restored->data.check.checkers
+                && s_long_game->data.check.pinned
+                    == s_restored->data.check.pinned
+                && list.count == restored_list.count
+                && memcmp(
+                        list.moves,
+                        restored_list.moves,
+                        (size_t)list.count * sizeof *list.moves) == 0;
+
+            redone = mt_chess_game_redo(s_long_game);
+            ret_val = ret_val && mt_chess_game_redo(s_restored) == redone;
+        }
+        ret_val = ret_val && s_restored->ply == s_long_game_plies;
+    }
+
+    mt_chess_game_jump_to_ply(s_long_game, s_long_game_plies);
+    mt_chess_mem_free(again);
+    return ret_val;
+}
+
+static struct benchmark const s_benchmarks[] = {
+    { "clone", bench_clone, 1 },
+    { "clone_and_apply_move", bench_clone_and_apply_move, 4 },
+    { "movegen_legal", bench_movegen_legal, 4 },
+    { "san_write", bench_san_write, 4 },
+    { "san_parse", bench_san_parse, 1 },
+    { "try_move_legal_and_undo", bench_try_move_legal, 4 },
+    { "try_move_illegal", bench_try_move_illegal, 4 },
+    { "get_targets", bench_get_targets, 4 },
+    { "get_movable", bench_get_movable, 4 },
+    { "search_depth4", bench_search_depth4, 65536 },
+    { "search_depth4_multipv4", bench_search_depth4_multi_pv4, 65536 },
+    { "move_apply", bench_move_apply, 1 },
+    { "check_update", bench_check_update, 4 },
+    { "piece_get_index", bench_piece_get_index, 1 },
+    { "log_get_latest_300", bench_log_get_latest, 4 },
+    { "jump_to_ply_300", bench_jump_to_ply, 64 },
+    { "board_str_ascii", bench_board_str_ascii, 4 },
+    { "board_str_unicode", bench_board_str_unicode, 4 },
+    { "game_churn", bench_game_churn, 16 },
+    { "snapshot_round_trip_300", bench_snapshot_round_trip, 64 }
+};
+
+static void print_layout(
+    char const * const name, size_t const size, size_t const alignment)
+{
+    printf(
+        "%-26s %5zu bytes, alignment %2zu, %2zu cache line(-s)\n",
+        name, size, alignment, (size + 63) / 64);
+}
+
+static void print_layouts(void)
+{
+    printf("Layout:\n");
+    print_layout(
+        "struct mt_chess_data",
+        sizeof(struct mt_chess_data),
+        _Alignof(struct mt_chess_data));
+    print_layout(
+        "struct mt_chess_check",
+        sizeof(struct mt_chess_check),
+        _Alignof(struct mt_chess_check));
+    print_layout(
+        "struct mt_chess_piece",
+        sizeof(struct mt_chess_piece),
+        _Alignof(struct mt_chess_piece));
+    print_layout(
+        "struct mt_chess_move_list",
+        sizeof(struct mt_chess_move_list),
+        _Alignof(struct mt_chess_move_list));
+    print_layout(
+        "struct mt_chess_log_node",
+        sizeof(struct mt_chess_log_node),
+        _Alignof(struct mt_chess_log_node));
+    print_layout(
+        "struct mt_chess_game",
+        sizeof(struct mt_chess_game),
+        _Alignof(struct mt_chess_game));
+}
+
+/**
+ * - Warms up (caches, branch predictors), then runs the timed iterations.
+ */
+static void run(
+    struct benchmark const * const benchmark,
+    uint64_t const iterations,
+    bool const csv)
+{
+    uint64_t const ops = iterations / benchmark->iterations_div + 1;
+    uint64_t sum = benchmark->run(ops / s_warm_up_div + 1);
+
+    uint64_t const allocs = mt_chess_mem_get_alloc_count();
+    uint64_t const start = mt_chess_clock_get_ns();
+
+    sum += benchmark->run(ops);
+
+    uint64_t const ns = mt_chess_clock_get_ns() - start;
+    double const ns_per_op = (double)ns / (double)ops;
+    double const ops_per_s = 0.0 < ns_per_op ? 1000000000.0 / ns_per_op : 0.0;
+    double const allocs_per_op =
+        (double)(mt_chess_mem_get_alloc_count() - allocs) / (double)ops;
+
+    if(csv)
+    {
+        printf(
+            "%s,%llu,%.2f,%.0f,%.3f\n",
+            benchmark->name,
+            (unsigned long long)ops,
+            ns_per_op,
+            ops_per_s,
+            allocs_per_op);
+    }
+    else
+    {
+        printf(
+            "%-26s %10.2f ns/op %14.0f op/s %8.3f allocs/op\n",
+            benchmark->name,
+            ns_per_op,
+            ops_per_s,
+            allocs_per_op);
+    }
+
+    if(sum == 1) // (to keep the compiler from dropping the work)
+    {
+        printf("\n");
+    }
+}
+
+/**
+ * - Prints the library's hot-path counters and timers of all benchmarks run,
+ *   if the library was built with MT_CHESS_STATS_ENABLED.
+ */
+static void print_stats(void)
+{
+    struct mt_chess_stats stats;
+
+    if(!mt_chess_get_stats(&stats))
+    {
+        return;
+    }
+
+    printf("\nHot-path stats (ticks are cycles on x86/x64, ns otherwise):\n");
+    for(int id = 0; id < (int)mt_chess_stats_id_count; ++id)
+    {
+        struct mt_chess_stats_entry const * const entry = stats.entries + id;
+
+        printf(
+            "%-16s %12llu calls %12.1f ticks/call\n",
+            mt_chess_stats_get_name((enum mt_chess_stats_id)id),
+            (unsigned long long)entry->count,
+            entry->count == 0
+                ? 0.0 : (double)entry->ticks / (double)entry->count);
+    }
+
+    uint64_t const hits = stats.entries[mt_chess_stats_id_pawn_hash_hit].count;
+    uint64_t const probes =
+        hits + stats.entries[mt_chess_stats_id_pawn_hash_miss].count;
+
+    printf(
+        "\nPawn hash hit rate: %.1f %% of %llu probes\n",
+        probes == 0 ? 0.0 : 100.0 * (double)hits / (double)probes,
+        (unsigned long long)probes);
+}
+
+int mt_chess_tool_bench_main(int const argc, char * * const argv)
+{
+    uint64_t iterations = s_default_iterations;
+    bool csv = false;
+    char const * filter = NULL;
+
+    for(int i = 0; i < argc; ++i)
+    {
+        if(strcmp(argv[i], "csv") == 0)
+        {
+            csv = true;
+            continue;
+        }
+        if('0' <= argv[i][0] && argv[i][0] <= '9')
+        {
+            iterations = (uint64_t)strtoull(argv[i], NULL, 10);
+            if(iterations != 0)
+            {
+                continue;
+            }
+        }
+        else
+        {
+            if(filter == NULL)
+            {
+                filter = argv[i];
+                continue;
+            }
+        }
+        printf("Usage: bench [iterations] [csv] [name filter]\n");
+        return 1;
+    }
+
+    set_up();
+    if(!check_snapshot())
+    {
+        printf("Error: Snapshot round trip failed!\n");
+        tear_down();
+        return 1;
+    }
+    mt_chess_reset_stats();
+
+    if(csv)
+    {
+        printf("name,iterations,ns_per_op,ops_per_s,allocs_per_op\n");
+    }
+    else
+    {
+        print_layouts();
+        printf(
+            "\nBenchmarks (%llu iterations, divided for slower ones):\n",
+            (unsigned long long)iterations);
+    }
+
+    for(size_t i = 0; i < sizeof s_benchmarks / sizeof *s_benchmarks; ++i)
+    {
+        if(filter != NULL && strstr(s_benchmarks[i].name, filter) == NULL)
+        {
+            continue;
+        }
+        run(s_benchmarks + i, iterations, csv);
+    }
+
+    if(!csv)
+    {
+        print_stats();
+    }
+
+    tear_down();
+    return 0;
+}
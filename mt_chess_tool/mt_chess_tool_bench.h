@@ -0,0 +1,22 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_TOOL_BENCH
+#define MT_CHESS_TOOL_BENCH
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+/**
+ * - Command-line entry point ("bench [iterations] [csv] [name filter]").
+ * - Prints the memory layout of the main data structures and ns/op, op/s and
+ *   allocations/op of each micro-benchmark (or CSV, to track regressions).
+ * - Runs benchmarks whose names contain the filter, only (if given).
+ */
+int mt_chess_tool_bench_main(int const argc, char * * const argv);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_TOOL_BENCH
@@ -0,0 +1,366 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstdlib>
+    #include <cstdio>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stdlib.h>
+    #include <stdio.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_tool_gendata.h"
+#include "mt_chess_game.h"
+#include "mt_chess_data.h"
+#include "mt_chess_movegen.h"
+#include "mt_chess_move.h"
+#include "mt_chess_search.h"
+#include "mt_chess_sample.h"
+#include "mt_chess_color.h"
+#include "mt_chess_thread.h"
+#include "mt_chess_clock.h"
+#include "mt_chess_trace.h"
+#include "mt_chess_mem.h"
+
+static uint64_t const s_default_nodes = 1000;
+static int const s_default_random_plies = 8;
+
+// Games are adjudicated as draws after this count of plies:
+//
+static int const s_max_plies = 300;
+
+// Samples per thread written to the file at once (1 MiB), the file itself
+// being unbuffered:
+//
+static int const s_buffer_samples = 32768;
+
+struct gendata
+{
+    uint64_t position_count; // To write.
+    uint64_t nodes;
+    int random_plies;
+
+    struct mt_chess_thread_mutex mutex;
+
+    // Protected by the mutex:
+
+    FILE * file;
+    bool write_failed;
+    uint64_t next_game;
+    uint64_t game_count; // Games played to the end, so far.
+    uint64_t reserved; // Positions taken by the threads, so far.
+};
+
+/**
+ * - A position of the game being played, labeled at the end of the game.
+ */
+struct position
+{
+    struct mt_chess_data data;
+    int score;
+};
+
+/**
+ * - The state of a thread.
+ */
+struct worker
+{
+    struct gendata * gendata;
+    struct mt_chess_game * game;
+    struct position * positions; // Of the current game.
+    uint8_t * buf; // Samples not written, yet.
+    int buf_count;
+};
+
+static uint64_t get_random(uint64_t * const state)
+{
+    // xorshift64:
+
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+/**
+ * - Returns, if the score of given best move depends on an exchange or
+ *   promotion to come (quiescence is not over).
+ */
+static bool is_noisy(
+    struct mt_chess_data const * const data, uint16_t const move)
+{
+    return data->board[mt_chess_move_get_to(move)] != 0
+        || mt_chess_move_get_special(move) == mt_chess_move_special_en_passant
+        || mt_chess_move_get_special(move) == mt_chess_move_special_promotion;
+}
+
+static void flush(struct worker * const worker)
+{
+    struct gendata * const gendata = worker->gendata;
+    size_t const size = (size_t)worker->buf_count * MT_CHESS_SAMPLE_SIZE;
+
+    mt_chess_thread_mutex_lock(&gendata->mutex);
+    if(!gendata->write_failed
+        && fwrite(worker->buf, 1, size, gendata->file) != size)
+    {
+        gendata->write_failed = true;
+    }
+    mt_chess_thread_mutex_unlock(&gendata->mutex);
+
+    worker->buf_count = 0;
+}
+
+/**
+ * - Plays the game with given index, starting with random moves.
+ * - Returns the count of positions recorded (0, if the game ended during the
+ *   random moves) and stores the result from white's view.
+ */
+static int play(
+    struct worker * const worker,
+    uint64_t const index,
+    enum mt_chess_sample_result * const out_white_result)
+{
+    struct mt_chess_game * const game = worker->game;
+    uint64_t random_state = (index + 1) * 0x9E3779B97F4A7C15ULL;
+    struct mt_chess_move_list list;
+    enum mt_chess_game_state state = mt_chess_game_state_ongoing;
+    int count = 0;
+
+    mt_chess_game_reset(game);
+    for(int i = 0; i < worker->gendata->random_plies; ++i)
+    {
+        mt_chess_movegen_get_legal(&game->data, &list);
+        if(list.count == 0)
+        {
+            return 0;
+        }
+        mt_chess_game_do_move(
+            game,
+            list.moves[get_random(&random_state) % (uint64_t)list.count]);
+    }
+
+    while(game->ply_count < s_max_plies)
+    {
+        state = mt_chess_game_get_state(game);
+        if(state != mt_chess_game_state_ongoing)
+        {
+            break;
+        }
+
+        struct mt_chess_search_limits limits;
+        struct mt_chess_search_result result;
+
+        mt_chess_search_init_limits(&limits);
+        limits.nodes = worker->gendata->nodes;
+        mt_chess_search_get_best(&game->data, &limits, &result);
+
+        assert(result.move != 0); // (game is not over)
+
+        if(game->data.check.checkers == 0
+            && !is_noisy(&game->data, result.move))
+        {
+            worker->positions[count].data = game->data;
+            worker->positions[count].score = result.score;
+            ++count;
+        }
+        mt_chess_game_do_move(game, result.move);
+    }
+
+    *out_white_result = mt_chess_sample_result_draw;
+    if(state == mt_chess_game_state_checkmate)
+    {
+        // The player having the turn lost:
+        //
+        *out_white_result = game->data.turn == mt_chess_color_white
+            ? mt_chess_sample_result_loss : mt_chess_sample_result_win;
+    }
+    return count;
+}
+
+static void run_thread(void * const arg)
+{
+    struct worker * const worker = (struct worker *)arg;
+    struct gendata * const gendata = worker->gendata;
+
+    while(true)
+    {
+        mt_chess_thread_mutex_lock(&gendata->mutex);
+
+        uint64_t const index = gendata->next_game++;
+        bool const done = gendata->position_count <= gendata->reserved;
+
+        mt_chess_thread_mutex_unlock(&gendata->mutex);
+
+        if(done)
+        {
+            break;
+        }
+
+        enum mt_chess_sample_result white_result;
+
+        MT_CHESS_TRACE_BEGIN(trace_begin);
+
+        int count = play(worker, index, &white_result);
+
+        MT_CHESS_TRACE_END(trace_begin, "game", index);
+
+        // Taking the positions of the game (as many as still needed):
+
+        mt_chess_thread_mutex_lock(&gendata->mutex);
+        if(gendata->position_count - gendata->reserved < (uint64_t)count)
+        {
+            count = (int)(gendata->position_count - gendata->reserved);
+        }
+        gendata->reserved += (uint64_t)count;
+        ++gendata->game_count;
+        mt_chess_thread_mutex_unlock(&gendata->mutex);
+
+        for(int i = 0; i < count; ++i)
+        {
+            struct position const * const position = worker->positions + i;
+            enum mt_chess_sample_result const result =
+                position->data.turn == mt_chess_color_white
+                    ? white_result
+                    : (enum mt_chess_sample_result)(
+                        (int)mt_chess_sample_result_win - (int)white_result);
+
+            mt_chess_sample_write(
+                &position->data,
+                position->score,
+                result,
+                worker->buf + worker->buf_count * MT_CHESS_SAMPLE_SIZE);
+            ++worker->buf_count;
+            if(worker->buf_count == s_buffer_samples)
+            {
+                flush(worker);
+            }
+        }
+    }
+    flush(worker);
+}
+
+int mt_chess_tool_gendata_main(int const argc, char * * const argv)
+{
+    struct gendata gendata;
+    int threads = mt_chess_thread_get_cpu_count();
+    long long const position_count = 2 <= argc ? atoll(argv[1]) : 0;
+    long long const nodes = 4 <= argc ? atoll(argv[3]) : 1;
+
+    gendata.nodes = s_default_nodes;
+    gendata.random_plies = s_default_random_plies;
+    if(argc < 2 || 5 < argc
+        || position_count < 1
+        || (3 <= argc && (threads = atoi(argv[2])) < 1)
+        || nodes < 1
+        || (5 <= argc && (gendata.random_plies = atoi(argv[4])) < 0))
+    {
+        printf(
+            "Usage: gendata <output file> <positions> [threads] [nodes] [random plies]\n"
+            "       (defaults: one thread per logical processor, %llu nodes per move,\n"
+            "       %d random plies)\n",
+            (unsigned long long)s_default_nodes,
+            s_default_random_plies);
+        return 1;
+    }
+    if(4 <= argc)
+    {
+        gendata.nodes = (uint64_t)nodes;
+    }
+    gendata.position_count = (uint64_t)position_count;
+
+    gendata.file = fopen(argv[0], "wb");
+    if(gendata.file == NULL)
+    {
+        printf("Error: Failed to create \"%s\"!\n", argv[0]);
+        return 1;
+    }
+    setvbuf(gendata.file, NULL, _IONBF, 0); // (the threads buffer)
+
+    mt_chess_thread_mutex_init(&gendata.mutex);
+    gendata.write_failed = false;
+    gendata.next_game = 0;
+    gendata.game_count = 0;
+    gendata.reserved = 0;
+
+    struct mt_chess_thread * const thread_objs =
+        (struct mt_chess_thread *)mt_chess_mem_alloc(
+            (size_t)threads * sizeof *thread_objs);
+    struct worker * const workers = (struct worker *)mt_chess_mem_alloc(
+        (size_t)threads * sizeof *workers);
+
+    for(int i = 0; i < threads; ++i)
+    {
+        workers[i].gendata = &gendata;
+        workers[i].game = mt_chess_game_create();
+        workers[i].positions = (struct position *)mt_chess_mem_alloc(
+            (size_t)s_max_plies * sizeof *workers[i].positions);
+        workers[i].buf = (uint8_t *)mt_chess_mem_alloc(
+            (size_t)s_buffer_samples * MT_CHESS_SAMPLE_SIZE);
+        workers[i].buf_count = 0;
+    }
+
+    uint64_t const start = mt_chess_clock_get_ns();
+    int started = 0;
+
+    while(started < threads
+        && mt_chess_thread_start(
+            thread_objs + started, run_thread, workers + started))
+    {
+        ++started;
+    }
+    if(started == 0)
+    {
+        run_thread(workers); // Generates all positions on this thread.
+    }
+    for(int i = 0; i < started; ++i)
+    {
+        mt_chess_thread_join(thread_objs + i);
+    }
+
+    uint64_t const ns = mt_chess_clock_get_ns() - start;
+    double const s = (double)ns / 1000000000.0;
+
+    if(fclose(gendata.file) != 0)
+    {
+        gendata.write_failed = true;
+    }
+
+    if(started < threads)
+    {
+        printf(
+            "Error: Started %d of %d thread(-s), only!\n", started, threads);
+    }
+    printf(
+        "Positions: %llu from %llu games in %.3f s, %d thread(-s)\n",
+        (unsigned long long)gendata.reserved,
+        (unsigned long long)gendata.game_count,
+        s,
+        started == 0 ? 1 : started);
+    printf(
+        "Rate:      %.0f positions/s (%.2f MiB/s)\n",
+        0.0 < s ? (double)gendata.reserved / s : 0.0,
+        0.0 < s
+            ? (double)(gendata.reserved * MT_CHESS_SAMPLE_SIZE)
+                / (1024.0 * 1024.0) / s
+            : 0.0);
+    if(gendata.write_failed)
+    {
+        printf("Error: Failed to write \"%s\"!\n", argv[0]);
+    }
+
+    for(int i = 0; i < threads; ++i)
+    {
+        mt_chess_game_free(workers[i].game);
+        mt_chess_mem_free(workers[i].positions);
+        mt_chess_mem_free(workers[i].buf);
+    }
+    mt_chess_mem_free(workers);
+    mt_chess_mem_free(thread_objs);
+    mt_chess_thread_mutex_deinit(&gendata.mutex);
+    return gendata.write_failed ? 1 : 0;
+}
@@ -0,0 +1,27 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_TOOL_GENDATA
+#define MT_CHESS_TOOL_GENDATA
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+/**
+ * - Command-line entry point ("gendata <output file> <positions> [threads]
+ *   [nodes] [random plies]").
+ * - Plays self-play games on given count of threads (default: one per
+ *   logical processor) with given node budget per move, each game starting
+ *   with given count of random moves, until the given count of positions is
+ *   written as training samples (see mt_chess_sample.h) to the output file.
+ * - Skips positions in check and positions with a catch or promotion as the
+ *   best move (their score depends on the exchange to come).
+ * - Prints the count of positions and games and the positions per second.
+ */
+int mt_chess_tool_gendata_main(int const argc, char * * const argv);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_TOOL_GENDATA
@@ -0,0 +1,198 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstdlib>
+    #include <cstdio>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stdlib.h>
+    #include <stdio.h>
+#endif //__cplusplus
+
+#include "mt_chess_tool_gentables.h"
+#include "mt_chess_line.h"
+
+// Directions as documented in mt_chess_line.h:
+//
+static int const s_row_add[8] = { -1, -1, 1, 1, -1, 0, 0, 1 };
+static int const s_col_add[8] = { -1, 1, -1, 1, 0, -1, 1, 0 };
+
+struct tables
+{
+    uint64_t between[8 * 8][8 * 8];
+    uint64_t through[8 * 8][8 * 8];
+    uint8_t dir[8 * 8][8 * 8];
+    uint8_t distance[8 * 8][8 * 8];
+};
+
+static int is_on_board(int const row, int const col)
+{
+    return 0 <= row && row < 8 && 0 <= col && col < 8;
+}
+
+/**
+ * - Returns the squares from (excluding) given square in given direction up
+ *   to the edge of the board.
+ */
+static uint64_t get_ray(int const index, int const dir)
+{
+    uint64_t ret_val = 0;
+    int row = index / 8 + s_row_add[dir];
+    int col = index % 8 + s_col_add[dir];
+
+    while(is_on_board(row, col))
+    {
+        ret_val |= (uint64_t)1 << (row * 8 + col);
+        row += s_row_add[dir];
+        col += s_col_add[dir];
+    }
+    return ret_val;
+}
+
+static void fill(struct tables * const tables)
+{
+    for(int a = 0; a < 8 * 8; ++a)
+    {
+        for(int b = 0; b < 8 * 8; ++b)
+        {
+            int const row_dist = abs(b / 8 - a / 8);
+            int const col_dist = abs(b % 8 - a % 8);
+
+            tables->between[a][b] = 0;
+            tables->through[a][b] = 0;
+            tables->dir[a][b] = MT_CHESS_LINE_NO_DIR;
+            tables->distance[a][b] =
+                (uint8_t)(row_dist < col_dist ? col_dist : row_dist);
+        }
+
+        for(int dir = 0; dir < 8; ++dir)
+        {
+            // The opposite direction (see mt_chess_line.h):
+            int const opp_dir = dir < 4 ? 3 - dir : 11 - dir;
+
+            uint64_t const through = get_ray(a, dir)
+                | get_ray(a, opp_dir) | (uint64_t)1 << a;
+            uint64_t between = 0;
+            int row = a / 8 + s_row_add[dir];
+            int col = a % 8 + s_col_add[dir];
+
+            while(is_on_board(row, col))
+            {
+                int const b = row * 8 + col;
+
+                tables->between[a][b] = between;
+                tables->through[a][b] = through;
+                tables->dir[a][b] = (uint8_t)dir;
+
+                between |= (uint64_t)1 << b;
+                row += s_row_add[dir];
+                col += s_col_add[dir];
+            }
+        }
+    }
+}
+
+static void print_square_comment(FILE * const file, int const index)
+{
+    fprintf(file, " // %c%c\n", 'a' + index % 8, '8' - index / 8);
+}
+
+// The tables are not const parameters: Before C23, a (non-const) 2D array
+// does not convert to a pointer to const rows.
+
+static void print_u64_table(
+    FILE * const file,
+    char const * const name,
+    uint64_t table[8 * 8][8 * 8])
+{
+    fprintf(file, "\nuint64_t const %s[8 * 8][8 * 8] = {\n", name);
+    for(int a = 0; a < 8 * 8; ++a)
+    {
+        fprintf(file, "    {");
+        print_square_comment(file, a);
+        for(int b = 0; b < 8 * 8; ++b)
+        {
+            fprintf(
+                file,
+                "%s0x%016llXULL%s",
+                b % 3 == 0 ? "        " : " ",
+                (unsigned long long)table[a][b],
+                b == 8 * 8 - 1 ? "\n" : (b % 3 == 2 ? ",\n" : ","));
+        }
+        fprintf(file, "    }%s\n", a == 8 * 8 - 1 ? "" : ",");
+    }
+    fprintf(file, "};\n");
+}
+
+static void print_u8_table(
+    FILE * const file,
+    char const * const name,
+    uint8_t table[8 * 8][8 * 8])
+{
+    fprintf(file, "\nuint8_t const %s[8 * 8][8 * 8] = {\n", name);
+    for(int a = 0; a < 8 * 8; ++a)
+    {
+        fprintf(file, "    {");
+        print_square_comment(file, a);
+        for(int b = 0; b < 8 * 8; ++b)
+        {
+            fprintf(
+                file,
+                "%s%3u%s",
+                b % 8 == 0 ? "        " : " ",
+                (unsigned int)table[a][b],
+                b == 8 * 8 - 1 ? "\n" : (b % 8 == 7 ? ",\n" : ","));
+        }
+        fprintf(file, "    }%s\n", a == 8 * 8 - 1 ? "" : ",");
+    }
+    fprintf(file, "};\n");
+}
+
+int mt_chess_tool_gentables_main(int const argc, char * * const argv)
+{
+    if(argc != 1)
+    {
+        printf("Usage: gentables <output file>\n");
+        return 1;
+    }
+
+    FILE * const file = fopen(argv[0], "w");
+
+    if(file == NULL)
+    {
+        printf("Error: Failed to create \"%s\"!\n", argv[0]);
+        return 1;
+    }
+
+    static struct tables s_tables; // (too large for the stack)
+
+    fill(&s_tables);
+
+    fprintf(
+        file,
+        "// Marcel Timm, RhinoDevel, 2026oct19\n"
+        "\n"
+        "#ifdef __cplusplus\n"
+        "    #include <cstdint>\n"
+        "#else //__cplusplus\n"
+        "    #include <stdint.h>\n"
+        "#endif //__cplusplus\n"
+        "\n"
+        "#include \"mt_chess_line.h\"\n"
+        "\n"
+        "// Generated by \"mt_chess_tool gentables\", do not edit (see\n"
+        "// mt_chess_line.h). Indexed by the board indices of both squares,\n"
+        "// with a comment naming the first square.\n");
+    print_u64_table(file, "mt_chess_line_between", s_tables.between);
+    print_u64_table(file, "mt_chess_line_through", s_tables.through);
+    print_u8_table(file, "mt_chess_line_dir", s_tables.dir);
+    print_u8_table(file, "mt_chess_line_distance", s_tables.distance);
+
+    if(fclose(file) != 0)
+    {
+        printf("Error: Failed to write \"%s\"!\n", argv[0]);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,21 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_TOOL_GENTABLES
+#define MT_CHESS_TOOL_GENTABLES
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+/**
+ * - Command-line entry point ("gentables <output file>").
+ * - Generates the source file of the lookup tables declared in
+ *   mt_chess_line.h (to be saved as mt_chess/mt_chess_line_tables.c).
+ */
+int mt_chess_tool_gentables_main(int const argc, char * * const argv);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_TOOL_GENTABLES
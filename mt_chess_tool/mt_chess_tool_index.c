@@ -0,0 +1,160 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstdlib>
+    #include <cstdio>
+    #include <cstring>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stdlib.h>
+    #include <stdio.h>
+    #include <string.h>
+#endif //__cplusplus
+
+#include "mt_chess_tool_index.h"
+#include "mt_chess_index.h"
+#include "mt_chess_data.h"
+#include "mt_chess_movegen.h"
+#include "mt_chess_move.h"
+#include "mt_chess_san.h"
+#include "mt_chess_clock.h"
+
+// Count of matches printed, at most:
+//
+#define MT_INDEX_MAX_PRINTED 20
+
+static int print_usage(void)
+{
+    printf(
+        "Usage: index build <record file> <index file> [threads]\n"
+        "       index find <index file> [moves]\n");
+    return 1;
+}
+
+static int build(int const argc, char * * const argv)
+{
+    if(argc < 2 || 3 < argc)
+    {
+        return print_usage();
+    }
+
+    int const threads = argc == 3 ? atoi(argv[2]) : 0;
+
+    if(threads < 0)
+    {
+        return print_usage();
+    }
+
+    uint64_t const start = mt_chess_clock_get_ns();
+
+    if(!mt_chess_index_build(argv[0], argv[1], threads))
+    {
+        printf("Error: Failed to build index of \"%s\"!\n", argv[0]);
+        return 1;
+    }
+
+    double const seconds =
+        (double)(mt_chess_clock_get_ns() - start) / 1000000000.0;
+    struct mt_chess_index index;
+
+    if(!mt_chess_index_open(&index, argv[1]))
+    {
+        printf("Error: Failed to open \"%s\"!\n", argv[1]);
+        return 1;
+    }
+    printf(
+        "Games:     %lu\n"
+        "Positions: %llu (%.2f bytes each)\n"
+        "Time:      %.3f s (%.0f positions/s)\n",
+        (unsigned long)index.game_count,
+        (unsigned long long)index.entry_count,
+        index.entry_count == 0
+            ? 0.0 : (double)index.map.size / (double)index.entry_count,
+        seconds,
+        0.0 < seconds ? (double)index.entry_count / seconds : 0.0);
+    mt_chess_index_close(&index);
+    return 0;
+}
+
+static int find(int const argc, char * * const argv)
+{
+    if(argc < 1)
+    {
+        return print_usage();
+    }
+
+    struct mt_chess_data data;
+    struct mt_chess_move_list list;
+
+    mt_chess_data_init(&data);
+    for(int i = 1; i < argc; ++i)
+    {
+        mt_chess_movegen_get_legal(&data, &list);
+
+        uint16_t move =
+            mt_chess_move_find_str(argv[i], list.moves, list.count);
+
+        if(move == 0)
+        {
+            move = mt_chess_san_find_str(argv[i], &data, &list);
+        }
+
+        if(move == 0)
+        {
+            printf("Error: Illegal move \"%s\"!\n", argv[i]);
+            return 1;
+        }
+        mt_chess_data_apply_move(&data, move, NULL);
+    }
+
+    struct mt_chess_index index;
+
+    if(!mt_chess_index_open(&index, argv[0]))
+    {
+        printf("Error: Failed to open \"%s\"!\n", argv[0]);
+        return 1;
+    }
+
+    struct mt_chess_index_match matches[MT_INDEX_MAX_PRINTED];
+    uint64_t const start = mt_chess_clock_get_ns();
+    uint64_t const count = mt_chess_index_find(
+        &index, data.hash, matches, MT_INDEX_MAX_PRINTED);
+    uint64_t const ns = mt_chess_clock_get_ns() - start;
+
+    for(uint64_t i = 0; i < count && i < MT_INDEX_MAX_PRINTED; ++i)
+    {
+        printf(
+            "Game %lu, ply %u\n",
+            (unsigned long)matches[i].game,
+            (unsigned int)matches[i].ply);
+    }
+    if(MT_INDEX_MAX_PRINTED < count)
+    {
+        printf("...\n");
+    }
+    printf(
+        "Matches: %llu (%.1f us)\n",
+        (unsigned long long)count,
+        (double)ns / 1000.0);
+
+    mt_chess_index_close(&index);
+    return 0;
+}
+
+int mt_chess_tool_index_main(int const argc, char * * const argv)
+{
+    if(argc < 1)
+    {
+        return print_usage();
+    }
+    if(strcmp(argv[0], "build") == 0)
+    {
+        return build(argc - 1, argv + 1);
+    }
+    if(strcmp(argv[0], "find") == 0)
+    {
+        return find(argc - 1, argv + 1);
+    }
+    return print_usage();
+}
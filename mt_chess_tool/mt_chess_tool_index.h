@@ -0,0 +1,26 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_TOOL_INDEX
+#define MT_CHESS_TOOL_INDEX
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+/**
+ * - Command-line entry point:
+ *
+ *   - "index build <record file> <index file> [threads]" builds the position
+ *     index of the games in given record file (see mt_chess_index.h).
+ *
+ *   - "index find <index file> [moves]" prints the games that reached the
+ *     position after given moves in coordinate notation (e.g. "e2e4 e7e5")
+ *     from the start position, with the ply the position was reached at.
+ */
+int mt_chess_tool_index_main(int const argc, char * * const argv);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_TOOL_INDEX
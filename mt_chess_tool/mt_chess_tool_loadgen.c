@@ -0,0 +1,325 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstdlib>
+    #include <cstdio>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stdlib.h>
+    #include <stdio.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_tool_loadgen.h"
+#include "mt_chess_tool_server.h"
+#include "mt_chess_data.h"
+#include "mt_chess_movegen.h"
+#include "mt_chess_move.h"
+#include "mt_chess_thread.h"
+#include "mt_chess_clock.h"
+#include "mt_chess_hist.h"
+#include "mt_chess_mem.h"
+
+static uint32_t const s_default_games = 1000;
+static uint64_t const s_default_requests = 100000;
+static uint64_t const s_default_nodes = 1000;
+
+static int const s_max_plies = 200; // Games get restarted after this.
+
+/**
+ * - The load generator's copy of a game, to be able to choose legal moves.
+ */
+struct client_game
+{
+    struct mt_chess_data data;
+
+    uint8_t next_cmd; // Holds value of enumeration mt_chess_tool_server_cmd.
+    uint16_t sent_move; // Move of the pending move request.
+    uint16_t reply; // Move of last response (written by a worker).
+    bool failed; // Last response was an error (written by a worker).
+};
+
+struct loadgen
+{
+    // Protects all members below (workers call on_response() concurrently):
+    struct mt_chess_thread_mutex mutex;
+    struct mt_chess_thread_cond ready_cond;
+
+    uint32_t * ready; // Ring buffer of IDs of games without pending request.
+    uint32_t ready_first;
+    uint32_t ready_count;
+    uint32_t game_count;
+
+    struct client_game * games;
+
+    // Latencies in nanoseconds per command:
+    struct mt_chess_hist latencies[MT_CHESS_TOOL_SERVER_CMD_COUNT];
+
+    uint64_t done;
+    uint64_t errors;
+};
+
+static void on_response(
+    void * const ctx,
+    struct mt_chess_tool_server_response const * const response)
+{
+    uint64_t const now = mt_chess_clock_get_ns();
+    struct loadgen * const loadgen = (struct loadgen *)ctx;
+    struct mt_chess_tool_server_request const * const request =
+        response->request;
+    struct client_game * const game = loadgen->games + request->game;
+
+    mt_chess_thread_mutex_lock(&loadgen->mutex);
+
+    mt_chess_hist_record(
+        loadgen->latencies + request->cmd, now - request->submit_ns);
+    ++loadgen->done;
+
+    game->reply = response->move;
+    game->failed = response->error != NULL;
+    if(game->failed)
+    {
+        ++loadgen->errors;
+    }
+
+    loadgen->ready[
+        (loadgen->ready_first + loadgen->ready_count) % loadgen->game_count] =
+            request->game;
+    ++loadgen->ready_count;
+    mt_chess_thread_cond_signal(&loadgen->ready_cond);
+
+    mt_chess_thread_mutex_unlock(&loadgen->mutex);
+}
+
+static uint64_t get_random(uint64_t * const state)
+{
+    // xorshift64:
+
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+/**
+ * - Applies the result of the last request of the game to the client's copy
+ *   and prepares the next request.
+ */
+static void prepare_next(
+    struct client_game * const game,
+    uint32_t const game_id,
+    uint64_t const nodes,
+    uint64_t * const random,
+    struct mt_chess_tool_server_request * const out_request)
+{
+    if(!game->failed)
+    {
+        switch((enum mt_chess_tool_server_cmd)game->next_cmd)
+        {
+            case mt_chess_tool_server_cmd_new:
+            {
+                mt_chess_data_init(&game->data);
+                game->next_cmd = (uint8_t)mt_chess_tool_server_cmd_move;
+                break;
+            }
+            case mt_chess_tool_server_cmd_move:
+            {
+                mt_chess_data_apply_move(&game->data, game->sent_move, NULL);
+                game->next_cmd = (uint8_t)mt_chess_tool_server_cmd_bot;
+                break;
+            }
+            case mt_chess_tool_server_cmd_bot:
+            {
+                mt_chess_data_apply_move(&game->data, game->reply, NULL);
+                game->next_cmd = (uint8_t)mt_chess_tool_server_cmd_move;
+                break;
+            }
+
+            default:
+            {
+                assert(false); // Must not get here.
+                break;
+            }
+        }
+    }
+
+    struct mt_chess_move_list list;
+
+    mt_chess_movegen_get_legal(&game->data, &list);
+    if(game->failed || list.count == 0 || s_max_plies <= (int)game->data.ply)
+    {
+        game->next_cmd = (uint8_t)mt_chess_tool_server_cmd_new;
+    }
+
+    out_request->id = 0;
+    out_request->client = NULL;
+    out_request->game = game_id;
+    out_request->cmd = game->next_cmd;
+    out_request->nodes = nodes;
+    out_request->move[0] = '\0';
+
+    if(game->next_cmd == (uint8_t)mt_chess_tool_server_cmd_move)
+    {
+        game->sent_move =
+            list.moves[get_random(random) % (uint64_t)list.count];
+        mt_chess_move_get_str(game->sent_move, out_request->move);
+    }
+}
+
+static double get_percentile_us(
+    struct mt_chess_hist const * const hist, double const percentile)
+{
+    return (double)mt_chess_hist_get_percentile(hist, percentile) / 1000.0;
+}
+
+static void print_report(
+    struct loadgen * const loadgen, uint64_t const ns, int const workers)
+{
+    double const seconds = (double)ns / 1000000000.0;
+
+    printf(
+        "Requests: %llu in %.3f s (%.0f requests/s), %d worker(-s), %u games, %llu error(-s)\n\n",
+        (unsigned long long)loadgen->done,
+        seconds,
+        0.0 < seconds ? (double)loadgen->done / seconds : 0.0,
+        workers,
+        loadgen->game_count,
+        (unsigned long long)loadgen->errors);
+
+    printf(
+        "%-8s %10s %12s %12s %12s %12s %12s\n",
+        "command", "count", "req/s", "p50 us", "p99 us", "p999 us", "max us");
+
+    for(int c = 0; c < MT_CHESS_TOOL_SERVER_CMD_COUNT; ++c)
+    {
+        struct mt_chess_hist const * const hist = loadgen->latencies + c;
+
+        if(hist->count == 0)
+        {
+            continue;
+        }
+        printf(
+            "%-8s %10llu %12.0f %12.1f %12.1f %12.1f %12.1f\n",
+            mt_chess_tool_server_get_cmd_name(
+                (enum mt_chess_tool_server_cmd)c),
+            (unsigned long long)hist->count,
+            0.0 < seconds ? (double)hist->count / seconds : 0.0,
+            get_percentile_us(hist, 50.0),
+            get_percentile_us(hist, 99.0),
+            get_percentile_us(hist, 99.9),
+            (double)hist->max / 1000.0);
+    }
+}
+
+int mt_chess_tool_loadgen_main(int const argc, char * * const argv)
+{
+    uint32_t games = s_default_games;
+    uint64_t requests = s_default_requests;
+    int workers = mt_chess_thread_get_cpu_count();
+    uint64_t nodes = s_default_nodes;
+
+    if(1 <= argc)
+    {
+        games = (uint32_t)strtoul(argv[0], NULL, 10);
+    }
+    if(2 <= argc)
+    {
+        requests = (uint64_t)strtoull(argv[1], NULL, 10);
+    }
+    if(3 <= argc)
+    {
+        workers = atoi(argv[2]);
+    }
+    if(4 <= argc)
+    {
+        nodes = (uint64_t)strtoull(argv[3], NULL, 10);
+    }
+    if(games == 0 || MT_CHESS_TOOL_SERVER_MAX_GAMES < games
+        || requests == 0 || workers < 1
+        || nodes == 0 || MT_CHESS_TOOL_SERVER_MAX_BOT_NODES < nodes)
+    {
+        printf("Usage: loadgen [games] [requests] [workers] [nodes]\n");
+        return 1;
+    }
+
+    struct loadgen loadgen;
+    uint64_t random = 0x9E3779B97F4A7C15ULL;
+
+    mt_chess_thread_mutex_init(&loadgen.mutex);
+    mt_chess_thread_cond_init(&loadgen.ready_cond);
+    loadgen.ready = (uint32_t *)mt_chess_mem_alloc(
+        games * sizeof *loadgen.ready);
+    loadgen.ready_first = 0;
+    loadgen.ready_count = 0;
+    loadgen.game_count = games;
+    loadgen.games = (struct client_game *)mt_chess_mem_alloc(
+        games * sizeof *loadgen.games);
+    for(int c = 0; c < MT_CHESS_TOOL_SERVER_CMD_COUNT; ++c)
+    {
+        mt_chess_hist_reset(loadgen.latencies + c);
+    }
+    loadgen.done = 0;
+    loadgen.errors = 0;
+
+    struct mt_chess_tool_server * const server =
+        mt_chess_tool_server_create(workers, 0, on_response, &loadgen);
+    uint64_t sent = 0;
+    uint64_t const start = mt_chess_clock_get_ns();
+
+    for(uint32_t i = 0; i < games && sent < requests; ++i, ++sent)
+    {
+        struct mt_chess_tool_server_request request;
+
+        mt_chess_data_init(&loadgen.games[i].data);
+        loadgen.games[i].next_cmd = (uint8_t)mt_chess_tool_server_cmd_new;
+        loadgen.games[i].failed = false;
+
+        request.id = sent;
+        request.game = i;
+        request.cmd = (uint8_t)mt_chess_tool_server_cmd_new;
+        request.nodes = nodes;
+        request.move[0] = '\0';
+        mt_chess_tool_server_submit(server, &request);
+    }
+
+    while(sent < requests)
+    {
+        mt_chess_thread_mutex_lock(&loadgen.mutex);
+        while(loadgen.ready_count == 0)
+        {
+            mt_chess_thread_cond_wait(&loadgen.ready_cond, &loadgen.mutex);
+        }
+
+        uint32_t const game_id = loadgen.ready[loadgen.ready_first];
+
+        loadgen.ready_first = (loadgen.ready_first + 1) % games;
+        --loadgen.ready_count;
+        mt_chess_thread_mutex_unlock(&loadgen.mutex);
+
+        // The game has no pending request, so no worker accesses its copy:
+
+        struct mt_chess_tool_server_request request;
+
+        prepare_next(
+            loadgen.games + game_id, game_id, nodes, &random, &request);
+        request.id = sent;
+        mt_chess_tool_server_submit(server, &request);
+        ++sent;
+    }
+
+    mt_chess_tool_server_free(server); // (waits for all responses)
+
+    uint64_t const ns = mt_chess_clock_get_ns() - start;
+
+    print_report(&loadgen, ns, workers);
+
+    mt_chess_mem_free(loadgen.games);
+    mt_chess_mem_free(loadgen.ready);
+    mt_chess_thread_cond_deinit(&loadgen.ready_cond);
+    mt_chess_thread_mutex_deinit(&loadgen.mutex);
+    return loadgen.errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,23 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_TOOL_LOADGEN
+#define MT_CHESS_TOOL_LOADGEN
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+/**
+ * - Command-line entry point ("loadgen [games] [requests] [workers] [nodes]").
+ * - Plays the given count of games at once against an in-process server (see
+ *   mt_chess_tool_server.h), each game alternating between a random legal
+ *   move and a bot reply with given node limit, restarting at game end.
+ * - Prints throughput and latency percentiles (up to p999) per request type.
+ */
+int mt_chess_tool_loadgen_main(int const argc, char * * const argv);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_TOOL_LOADGEN
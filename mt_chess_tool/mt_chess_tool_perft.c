@@ -0,0 +1,613 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstdlib>
+    #include <cstdio>
+    #include <cstring>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stdlib.h>
+    #include <stdio.h>
+    #include <string.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_tool_perft.h"
+#include "mt_chess_data.h"
+#include "mt_chess_movegen.h"
+#include "mt_chess_move.h"
+#include "mt_chess_thread.h"
+#include "mt_chess_clock.h"
+#include "mt_chess_mem.h"
+
+// Count of mutexes guarding the entries of the perft hash table (must be a
+// power of two):
+//
+#define MT_PERFT_LOCKS 1024
+
+static int const s_default_hash_mb = 64;
+
+// Roots get split into subtrees until there are this many tasks per thread
+// (for the work stealing to even out the different sizes of the subtrees):
+//
+static int const s_tasks_per_thread = 16;
+
+// Subtrees are not split below this depth (to keep the hash table useful):
+//
+static int const s_min_task_depth = 3;
+
+struct perft_entry
+{
+    uint64_t hash;
+    uint64_t count_and_depth; // Node count shifted left by 8 bits.
+};
+
+// Node counts of subtrees by position hash and depth, shared by all threads.
+//
+struct perft_table
+{
+    struct perft_entry * entries;
+    uint64_t mask; // Count of entries minus one.
+    struct mt_chess_thread_mutex locks[MT_PERFT_LOCKS];
+};
+
+struct perft_task
+{
+    struct mt_chess_data data;
+    int depth;
+    int root; // Index of the root move the subtree belongs to.
+    uint64_t count;
+};
+
+// Indices of tasks of a thread: The owner takes from the end, others steal
+// from the start.
+//
+struct perft_queue
+{
+    struct mt_chess_thread_mutex mutex;
+    int * tasks;
+    int first;
+    int end;
+};
+
+struct perft_worker
+{
+    struct mt_chess_thread thread;
+    struct perft_pool * pool;
+    int index;
+    struct perft_queue queue;
+};
+
+struct perft_pool
+{
+    struct perft_task * tasks;
+    struct perft_worker * workers;
+    int worker_count;
+    struct perft_table * table; // NULL, if no hash table is used.
+};
+
+uint64_t mt_chess_tool_perft(
+    struct mt_chess_data const * const data, int const depth)
+{
+    assert(data != NULL);
+    assert(0 <= depth);
+
+    struct mt_chess_move_list list;
+    uint64_t ret_val = 0;
+
+    if(depth == 0)
+    {
+        return 1;
+    }
+
+    mt_chess_movegen_get_legal(data, &list);
+    if(depth == 1)
+    {
+        return (uint64_t)list.count; // Bulk-counting.
+    }
+
+    for(int i = 0; i < list.count; ++i)
+    {
+        struct mt_chess_data child = *data; // Copy-make.
+
+        mt_chess_data_apply_move(&child, list.moves[i], NULL);
+        ret_val += mt_chess_tool_perft(&child, depth - 1);
+    }
+    return ret_val;
+}
+
+static struct perft_table * create_table(int const hash_mb)
+{
+    assert(0 < hash_mb);
+
+    struct perft_table * const ret_val =
+        (struct perft_table *)mt_chess_mem_alloc(sizeof *ret_val);
+    uint64_t count = 1;
+
+    while(count * 2 * sizeof *ret_val->entries
+            <= (uint64_t)hash_mb * 1024 * 1024)
+    {
+        count *= 2;
+    }
+
+    ret_val->entries = (struct perft_entry *)mt_chess_mem_alloc(
+        (size_t)count * sizeof *ret_val->entries);
+    memset(ret_val->entries, 0, (size_t)count * sizeof *ret_val->entries);
+    ret_val->mask = count - 1;
+    for(int i = 0; i < MT_PERFT_LOCKS; ++i)
+    {
+        mt_chess_thread_mutex_init(ret_val->locks + i);
+    }
+    return ret_val;
+}
+
+static void free_table(struct perft_table * const table)
+{
+    for(int i = 0; i < MT_PERFT_LOCKS; ++i)
+    {
+        mt_chess_thread_mutex_deinit(table->locks + i);
+    }
+    mt_chess_mem_free(table->entries);
+    mt_chess_mem_free(table);
+}
+
+static uint64_t get_table_index(
+    struct perft_table const * const table,
+    uint64_t const hash,
+    int const depth)
+{
+    return (hash ^ (uint64_t)depth * 0x9E3779B97F4A7C15ULL) & table->mask;
+}
+
+/**
+ * - Returns true and the count via given pointer, if found.
+ */
+static bool probe(
+    struct perft_table * const table,
+    uint64_t const hash,
+    int const depth,
+    uint64_t * const out_count)
+{
+    uint64_t const index = get_table_index(table, hash, depth);
+    struct mt_chess_thread_mutex * const lock =
+        table->locks + (index & (MT_PERFT_LOCKS - 1));
+
+    mt_chess_thread_mutex_lock(lock);
+
+    struct perft_entry const entry = table->entries[index];
+
+    mt_chess_thread_mutex_unlock(lock);
+
+    if(entry.hash != hash || (int)(entry.count_and_depth & 0xFF) != depth)
+    {
+        return false;
+    }
+    *out_count = entry.count_and_depth >> 8;
+    return true;
+}
+
+static void store(
+    struct perft_table * const table,
+    uint64_t const hash,
+    int const depth,
+    uint64_t const count)
+{
+    uint64_t const index = get_table_index(table, hash, depth);
+    struct mt_chess_thread_mutex * const lock =
+        table->locks + (index & (MT_PERFT_LOCKS - 1));
+
+    mt_chess_thread_mutex_lock(lock);
+    table->entries[index].hash = hash;
+    table->entries[index].count_and_depth = count << 8 | (uint64_t)depth;
+    mt_chess_thread_mutex_unlock(lock);
+}
+
+/**
+ * - Like mt_chess_tool_perft(), but caching the node counts of subtrees in
+ *   given table (if not NULL).
+ */
+static uint64_t perft_hashed(
+    struct perft_table * const table,
+    struct mt_chess_data const * const data,
+    int const depth)
+{
+    if(table == NULL || depth < 2)
+    {
+        return mt_chess_tool_perft(data, depth);
+    }
+
+    uint64_t ret_val = 0;
+
+    if(probe(table, data->hash, depth, &ret_val))
+    {
+        return ret_val;
+    }
+
+    struct mt_chess_move_list list;
+
+    mt_chess_movegen_get_legal(data, &list);
+    for(int i = 0; i < list.count; ++i)
+    {
+        struct mt_chess_data child = *data;
+
+        mt_chess_data_apply_move(&child, list.moves[i], NULL);
+        ret_val += perft_hashed(table, &child, depth - 1);
+    }
+    store(table, data->hash, depth, ret_val);
+    return ret_val;
+}
+
+/**
+ * - Returns the index of the next task for given worker, taken from its own
+ *   queue or stolen from another worker's queue, or -1, if all are empty.
+ */
+static int get_task(struct perft_worker * const worker)
+{
+    struct perft_pool * const pool = worker->pool;
+    int ret_val = -1;
+
+    mt_chess_thread_mutex_lock(&worker->queue.mutex);
+    if(worker->queue.first < worker->queue.end)
+    {
+        ret_val = worker->queue.tasks[--worker->queue.end];
+    }
+    mt_chess_thread_mutex_unlock(&worker->queue.mutex);
+
+    for(int i = 1; ret_val == -1 && i < pool->worker_count; ++i)
+    {
+        struct perft_queue * const victim =
+            &pool->workers[(worker->index + i) % pool->worker_count].queue;
+
+        mt_chess_thread_mutex_lock(&victim->mutex);
+        if(victim->first < victim->end)
+        {
+            ret_val = victim->tasks[victim->first++];
+        }
+        mt_chess_thread_mutex_unlock(&victim->mutex);
+    }
+    return ret_val;
+}
+
+static void work(void * const arg)
+{
+    struct perft_worker * const worker = (struct perft_worker *)arg;
+
+    for(int i = get_task(worker); i != -1; i = get_task(worker))
+    {
+        struct perft_task * const task = worker->pool->tasks + i;
+
+        task->count = perft_hashed(
+            worker->pool->table, &task->data, task->depth);
+    }
+}
+
+/**
+ * - Returns the tasks (to be freed by the caller) for the subtrees of the
+ *   root moves of given position, split to the depth giving enough tasks
+ *   for given count of threads.
+ */
+static struct perft_task * create_tasks(
+    struct mt_chess_data const * const data,
+    int const depth,
+    int const thread_count,
+    int * const out_count)
+{
+    struct mt_chess_move_list list;
+    struct perft_task * ret_val = NULL;
+    int count = 0;
+
+    mt_chess_movegen_get_legal(data, &list);
+    ret_val = (struct perft_task *)mt_chess_mem_alloc(
+        (size_t)(list.count + 1) * sizeof *ret_val);
+    for(int i = 0; i < list.count; ++i)
+    {
+        ret_val[count].data = *data;
+        mt_chess_data_apply_move(&ret_val[count].data, list.moves[i], NULL);
+        ret_val[count].depth = depth - 1;
+        ret_val[count].root = i;
+        ret_val[count].count = 0;
+        ++count;
+    }
+
+    // All tasks have the same depth, split all of them by one more ply until
+    // there are enough:
+    //
+    while(0 < count
+        && count < thread_count * s_tasks_per_thread
+        && s_min_task_depth < ret_val[0].depth)
+    {
+        int split_count = 0;
+
+        for(int i = 0; i < count; ++i)
+        {
+            mt_chess_movegen_get_legal(&ret_val[i].data, &list);
+            split_count += list.count;
+        }
+
+        struct perft_task * const split = (struct perft_task *)
+            mt_chess_mem_alloc((size_t)(split_count + 1) * sizeof *split);
+
+        split_count = 0;
+
+        for(int i = 0; i < count; ++i)
+        {
+            mt_chess_movegen_get_legal(&ret_val[i].data, &list);
+            for(int j = 0; j < list.count; ++j)
+            {
+                struct perft_task * const task = split + split_count;
+
+                task->data = ret_val[i].data;
+                mt_chess_data_apply_move(&task->data, list.moves[j], NULL);
+                task->depth = ret_val[i].depth - 1;
+                task->root = ret_val[i].root;
+                task->count = 0;
+                ++split_count;
+            }
+        }
+        mt_chess_mem_free(ret_val);
+        ret_val = split;
+        count = split_count;
+    }
+    *out_count = count;
+    return ret_val;
+}
+
+uint64_t mt_chess_tool_perft_parallel(
+    struct mt_chess_data const * const data,
+    int const depth,
+    int const thread_count,
+    int const hash_mb,
+    uint64_t * const out_root_counts)
+{
+    assert(data != NULL);
+    assert(1 <= depth);
+    assert(1 <= thread_count);
+    assert(0 <= hash_mb);
+
+    struct perft_pool pool;
+    int task_count = 0;
+
+    pool.tasks = create_tasks(data, depth, thread_count, &task_count);
+    pool.worker_count = thread_count;
+    pool.workers = (struct perft_worker *)mt_chess_mem_alloc(
+        (size_t)thread_count * sizeof *pool.workers);
+    pool.table = hash_mb == 0 ? NULL : create_table(hash_mb);
+
+    // Deal the tasks round-robin:
+    //
+    for(int i = 0; i < thread_count; ++i)
+    {
+        struct perft_worker * const worker = pool.workers + i;
+
+        worker->pool = &pool;
+        worker->index = i;
+        mt_chess_thread_mutex_init(&worker->queue.mutex);
+        worker->queue.tasks = (int *)mt_chess_mem_alloc(
+            (size_t)(task_count / thread_count + 1)
+                * sizeof *worker->queue.tasks);
+        worker->queue.first = 0;
+        worker->queue.end = 0;
+    }
+    for(int i = 0; i < task_count; ++i)
+    {
+        struct perft_queue * const queue =
+            &pool.workers[i % thread_count].queue;
+
+        queue->tasks[queue->end++] = i;
+    }
+
+    for(int i = 1; i < thread_count; ++i)
+    {
+        if(!mt_chess_thread_start(
+            &pool.workers[i].thread, work, pool.workers + i))
+        {
+            pool.workers[i].thread.func = NULL; // (tasks get stolen)
+        }
+    }
+    work(pool.workers);
+    for(int i = 1; i < thread_count; ++i)
+    {
+        if(pool.workers[i].thread.func != NULL)
+        {
+            mt_chess_thread_join(&pool.workers[i].thread);
+        }
+    }
+
+    uint64_t ret_val = 0;
+
+    if(out_root_counts != NULL)
+    {
+        struct mt_chess_move_list list;
+
+        mt_chess_movegen_get_legal(data, &list);
+        memset(
+            out_root_counts, 0, (size_t)list.count * sizeof *out_root_counts);
+    }
+    for(int i = 0; i < task_count; ++i)
+    {
+        ret_val += pool.tasks[i].count;
+        if(out_root_counts != NULL)
+        {
+            out_root_counts[pool.tasks[i].root] += pool.tasks[i].count;
+        }
+    }
+
+    for(int i = 0; i < thread_count; ++i)
+    {
+        mt_chess_mem_free(pool.workers[i].queue.tasks);
+        mt_chess_thread_mutex_deinit(&pool.workers[i].queue.mutex);
+    }
+    if(pool.table != NULL)
+    {
+        free_table(pool.table);
+    }
+    mt_chess_mem_free(pool.workers);
+    mt_chess_mem_free(pool.tasks);
+    return ret_val;
+}
+
+static int print_usage(void)
+{
+    printf(
+        "Usage: perft <depth> [threads] [hash MB]\n"
+        "       perft <depth> scale [max. threads] [hash MB]\n"
+        "       (0 threads means one per logical processor)\n");
+    return 1;
+}
+
+/**
+ * - Runs the serial perft (without hash table) as reference and the parallel
+ *   one with 1, 2, 4, ... and given maximum count of threads, printing the
+ *   speed-up and efficiency relative to one thread.
+ * - Returns false, if a count differs from the reference.
+ */
+static bool print_scaling(
+    struct mt_chess_data const * const data,
+    int const depth,
+    int const max_threads,
+    int const hash_mb)
+{
+    uint64_t start = mt_chess_clock_get_ns();
+    uint64_t const reference = mt_chess_tool_perft(data, depth);
+    double seconds = (double)(mt_chess_clock_get_ns() - start) / 1e9;
+    double one_thread_seconds = 0.0;
+    bool ret_val = true;
+
+    printf(
+        "Serial:     %llu nodes, %.3f s (no hash table)\n\n",
+        (unsigned long long)reference,
+        seconds);
+    printf("Threads       Time  Speed-up  Efficiency  Nodes\n");
+
+    for(int threads = 1;; threads *= 2)
+    {
+        if(max_threads < threads)
+        {
+            threads = max_threads;
+        }
+
+        start = mt_chess_clock_get_ns();
+
+        uint64_t const count =
+            mt_chess_tool_perft_parallel(data, depth, threads, hash_mb, NULL);
+
+        seconds = (double)(mt_chess_clock_get_ns() - start) / 1e9;
+        if(threads == 1)
+        {
+            one_thread_seconds = seconds;
+        }
+
+        double const speed_up =
+            0.0 < seconds ? one_thread_seconds / seconds : 0.0;
+
+        printf(
+            "%7d %8.3f s %8.2fx %10.1f %%  %llu%s\n",
+            threads,
+            seconds,
+            speed_up,
+            100.0 * speed_up / (double)threads,
+            (unsigned long long)count,
+            count == reference ? "" : " (MISMATCH)");
+        ret_val = ret_val && count == reference;
+
+        if(threads == max_threads)
+        {
+            break;
+        }
+    }
+    return ret_val;
+}
+
+int mt_chess_tool_perft_main(int const argc, char * * const argv)
+{
+    if(argc < 1 || 4 < argc)
+    {
+        return print_usage();
+    }
+
+    int const depth = atoi(argv[0]);
+
+    if(depth < 1)
+    {
+        printf("Depth must be at least 1.\n");
+        return 1;
+    }
+
+    bool const scale = 2 <= argc && strcmp(argv[1], "scale") == 0;
+    int const first_arg = scale ? 2 : 1;
+    int threads = first_arg < argc ? atoi(argv[first_arg]) : 0;
+    int const hash_mb =
+        first_arg + 1 < argc ? atoi(argv[first_arg + 1]) : s_default_hash_mb;
+
+    if(threads < 0 || hash_mb < 0 || (!scale && 3 < argc))
+    {
+        return print_usage();
+    }
+    if(threads == 0)
+    {
+        threads = mt_chess_thread_get_cpu_count();
+    }
+
+    struct mt_chess_data data;
+    struct mt_chess_move_list list;
+
+    mt_chess_data_init(&data);
+
+    if(scale)
+    {
+        return print_scaling(&data, depth, threads, hash_mb) ? 0 : 1;
+    }
+
+    uint64_t * const counts = (uint64_t *)mt_chess_mem_alloc(
+        MT_CHESS_MOVE_LIST_MAX * sizeof *counts);
+    uint64_t const start = mt_chess_clock_get_ns();
+    uint64_t total = 0;
+
+    mt_chess_movegen_get_legal(&data, &list);
+    if(argc == 1)
+    {
+        // Serial, without hash table:
+
+        for(int i = 0; i < list.count; ++i)
+        {
+            struct mt_chess_data child = data;
+
+            mt_chess_data_apply_move(&child, list.moves[i], NULL);
+            counts[i] = mt_chess_tool_perft(&child, depth - 1);
+            total += counts[i];
+        }
+    }
+    else
+    {
+        total = mt_chess_tool_perft_parallel(
+            &data, depth, threads, hash_mb, counts);
+    }
+
+    double const seconds = (double)(mt_chess_clock_get_ns() - start) / 1e9;
+
+    for(int i = 0; i < list.count; ++i)
+    {
+        uint16_t const move = list.moves[i];
+        int const from_index = mt_chess_move_get_from(move);
+        int const to_index = mt_chess_move_get_to(move);
+
+        printf(
+            "%c%c%c%c: %llu\n",
+            'a' + from_index % 8, '8' - from_index / 8,
+            'a' + to_index % 8, '8' - to_index / 8,
+            (unsigned long long)counts[i]);
+    }
+    mt_chess_mem_free(counts);
+
+    printf("\nNodes: %llu\n", (unsigned long long)total);
+    printf("Time:  %.3f s\n", seconds);
+    if(0.0 < seconds)
+    {
+        printf("Speed: %.0f nodes/s\n", (double)total / seconds);
+    }
+    return 0;
+}
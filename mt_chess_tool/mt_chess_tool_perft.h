@@ -0,0 +1,55 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_TOOL_PERFT
+#define MT_CHESS_TOOL_PERFT
+
+#ifdef __cplusplus
+    #include <cstdint>
+#else //__cplusplus
+    #include <stdint.h>
+#endif //__cplusplus
+
+#include "mt_chess_data.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+/**
+ * - Returns the count of leaf nodes of the legal move tree of given depth.
+ */
+uint64_t mt_chess_tool_perft(
+    struct mt_chess_data const * const data, int const depth);
+
+/**
+ * - Returns the same count as mt_chess_tool_perft() for given depth (at least
+ *   1), computed by given count of threads.
+ * - The subtrees of the root moves (split deeper, if there are few) are dealt
+ *   to the threads, which steal from each other when done with their own.
+ * - Node counts of subtrees get cached by position hash and depth in a hash
+ *   table of given size in MB shared by the threads (none, if 0).
+ * - Stores the count per root move (in the order of the legal moves), if
+ *   given array is not NULL.
+ */
+uint64_t mt_chess_tool_perft_parallel(
+    struct mt_chess_data const * const data,
+    int const depth,
+    int const thread_count,
+    int const hash_mb,
+    uint64_t * const out_root_counts);
+
+/**
+ * - Command-line entry point ("perft <depth> [threads] [hash MB]" or
+ *   "perft <depth> scale [max. threads] [hash MB]").
+ * - Prints the node count per root move and the total, computed serially
+ *   (without hash table) or in parallel, if a count of threads is given.
+ * - Or prints the time, speed-up and efficiency of the parallel perft for
+ *   1, 2, 4, ... threads, checking the counts against the serial perft.
+ */
+int mt_chess_tool_perft_main(int const argc, char * * const argv);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_TOOL_PERFT
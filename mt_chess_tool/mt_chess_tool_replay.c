@@ -0,0 +1,132 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdio>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdio.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_tool_replay.h"
+#include "mt_chess_record.h"
+#include "mt_chess_game.h"
+#include "mt_chess_clock.h"
+#include "mt_chess_mem.h"
+
+/**
+ * - Returns the content of the file with given path (to be freed by the
+ *   caller) or NULL on error.
+ */
+static uint8_t * create_file_content(
+    char const * const path, size_t * const out_size)
+{
+    FILE * const file = fopen(path, "rb");
+
+    if(file == NULL)
+    {
+        return NULL;
+    }
+    if(fseek(file, 0, SEEK_END) != 0)
+    {
+        fclose(file);
+        return NULL;
+    }
+
+    long const size = ftell(file);
+
+    if(size < 0 || fseek(file, 0, SEEK_SET) != 0)
+    {
+        fclose(file);
+        return NULL;
+    }
+
+    uint8_t * const ret_val =
+        (uint8_t *)mt_chess_mem_alloc(size == 0 ? 1 : (size_t)size);
+
+    if(fread(ret_val, 1, (size_t)size, file) != (size_t)size)
+    {
+        mt_chess_mem_free(ret_val);
+        fclose(file);
+        return NULL;
+    }
+    fclose(file);
+    *out_size = (size_t)size;
+    return ret_val;
+}
+
+int mt_chess_tool_replay_main(int const argc, char * * const argv)
+{
+    if(argc != 1)
+    {
+        printf("Usage: replay <record file>\n");
+        return 1;
+    }
+
+    size_t size = 0;
+    uint8_t * const buf = create_file_content(argv[0], &size);
+
+    if(buf == NULL)
+    {
+        printf("Error: Failed to read \"%s\"!\n", argv[0]);
+        return 1;
+    }
+
+    struct mt_chess_game * const game = mt_chess_game_create();
+    struct mt_chess_record_header header;
+    uint64_t games = 0;
+    uint64_t plies = 0;
+    uint64_t results[4] = { 0 }; // Indexed by enum mt_chess_record_result.
+    size_t pos = 0;
+    uint64_t const start = mt_chess_clock_get_ns();
+
+    while(pos < size)
+    {
+        size_t const len =
+            mt_chess_record_read(buf + pos, size - pos, game, &header);
+
+        if(len == 0)
+        {
+            break;
+        }
+        pos += len;
+        ++games;
+        plies += header.ply_count;
+        ++results[header.result];
+    }
+
+    uint64_t const ns = mt_chess_clock_get_ns() - start;
+    double const seconds = (double)ns / 1000000000.0;
+
+    printf(
+        "Games:   %llu (%llu moves, %.2f bytes/move)\n",
+        (unsigned long long)games,
+        (unsigned long long)plies,
+        plies == 0 ? 0.0 : (double)pos / (double)plies);
+    printf(
+        "Results: 1-0 %llu, 0-1 %llu, 1/2-1/2 %llu, unknown %llu\n",
+        (unsigned long long)results[mt_chess_record_result_white],
+        (unsigned long long)results[mt_chess_record_result_black],
+        (unsigned long long)results[mt_chess_record_result_draw],
+        (unsigned long long)results[mt_chess_record_result_unknown]);
+    printf(
+        "Time:    %.3f s (%.0f moves/s)\n",
+        seconds,
+        0.0 < seconds ? (double)plies / seconds : 0.0);
+
+    bool const ok = pos == size;
+
+    if(!ok)
+    {
+        printf(
+            "Error: Invalid record at byte %llu!\n", (unsigned long long)pos);
+    }
+
+    mt_chess_game_free(game);
+    mt_chess_mem_free(buf);
+    return ok ? 0 : 1;
+}
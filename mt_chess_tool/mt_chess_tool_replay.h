@@ -0,0 +1,22 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_TOOL_REPLAY
+#define MT_CHESS_TOOL_REPLAY
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+/**
+ * - Command-line entry point ("replay <record file>").
+ * - Replays all binary game records of given file (see mt_chess_record.h)
+ *   and prints the count of games and moves, bytes per move, the results and
+ *   the import speed.
+ */
+int mt_chess_tool_replay_main(int const argc, char * * const argv);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_TOOL_REPLAY
@@ -0,0 +1,877 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+// Output file format, one line per game (in game order):
+//
+// <game> <opening> <engine playing white: A or B> <result> <reason> <moves>
+//
+// - Result is 1-0, 0-1 or 1/2-1/2.
+// - Reason is the game state ending the game (e.g. checkmate) or "time" (lost
+//   on time in a clocked game).
+// - Moves are in coordinate notation (including the opening's moves).
+//
+// If the output file name ends with ".rec", binary game records are written
+// instead, in game order (see mt_chess_record.h and the replay command).
+//
+// With "--opponent=<socket path>", engine B is the server of another build
+// listening there (e.g. "mt_chess_tool server 8 0 /tmp/b.sock" of that build),
+// to compare two builds. Each thread connects on its own and plays its games
+// via the server's new, move, bot and end requests. Budget B must be a node
+// count, then, and the nodes reported are the ones of engine A, only.
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstdlib>
+    #include <cstdio>
+    #include <cstring>
+    #include <cmath>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stdlib.h>
+    #include <stdio.h>
+    #include <string.h>
+    #include <math.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_tool_selfplay.h"
+#include "mt_chess_tool_server.h"
+#include "mt_chess_tool_socket.h"
+#include "mt_chess_game.h"
+#include "mt_chess_log_node.h"
+#include "mt_chess_movegen.h"
+#include "mt_chess_move.h"
+#include "mt_chess_search.h"
+#include "mt_chess_timeman.h"
+#include "mt_chess_color.h"
+#include "mt_chess_thread.h"
+#include "mt_chess_clock.h"
+#include "mt_chess_latency.h"
+#include "mt_chess_hist.h"
+#include "mt_chess_trace.h"
+#include "mt_chess_record.h"
+#include "mt_chess_mem.h"
+
+static int const s_default_games = 100;
+static uint64_t const s_default_nodes = 5000;
+
+// Games not over by the rules after this count of plies are drawn:
+static int const s_max_plies = 300;
+
+// Opening lines (in coordinate notation) to start the games with:
+static char const * const s_openings[] = {
+    "e2e4 e7e5 g1f3 b8c6 f1b5",
+    "e2e4 e7e5 g1f3 b8c6 f1c4",
+    "e2e4 c7c5 g1f3 d7d6 d2d4",
+    "e2e4 c7c5 b1c3 b8c6 g2g3",
+    "e2e4 e7e6 d2d4 d7d5 b1c3",
+    "e2e4 c7c6 d2d4 d7d5 e4e5",
+    "e2e4 d7d5 e4d5 d8d5 b1c3",
+    "e2e4 g8f6 e4e5 f6d5 d2d4",
+    "d2d4 d7d5 c2c4 e7e6 b1c3",
+    "d2d4 d7d5 c2c4 c7c6 g1f3",
+    "d2d4 g8f6 c2c4 e7e6 g1f3",
+    "d2d4 g8f6 c2c4 g7g6 b1c3",
+    "d2d4 f7f5 g2g3 g8f6 f1g2",
+    "c2c4 e7e5 b1c3 g8f6 g2g3",
+    "g1f3 d7d5 g2g3 g8f6 f1g2",
+    "b2b3 e7e5 c1b2 b8c6 e2e3"
+};
+
+static int const s_opening_count =
+    (int)(sizeof s_openings / sizeof *s_openings);
+
+// Game state (see game_result.state) of a game lost on time, following the
+// values of enumeration mt_chess_game_state:
+//
+#define MT_SELFPLAY_STATE_TIME 6
+
+enum result
+{
+    result_white = 0,
+    result_black = 1,
+    result_draw = 2
+};
+
+struct budget
+{
+    uint64_t nodes; // 0, if time or a clock is used.
+    uint64_t time_ns; // Per move, 0, if nodes or a clock are used.
+
+    // Time per game and increment per move (clocked game, if not 0):
+    //
+    uint64_t clock_ns;
+    uint64_t increment_ns;
+};
+
+/**
+ * - Result of one game (written by the thread that played it).
+ */
+struct game_result
+{
+    char * moves; // Coordinate notation, separated by spaces.
+    uint8_t * record; // See mt_chess_record.h.
+    size_t record_size;
+    uint64_t nodes; // Searched by both engines (by A, only, with opponent).
+    uint8_t result; // Holds value of enumeration result.
+    // Holds value of enumeration mt_chess_game_state or
+    // MT_SELFPLAY_STATE_TIME.
+    uint8_t state;
+};
+
+struct selfplay
+{
+    struct budget budgets[2]; // A and B.
+
+    // Socket path of the server playing B or NULL (B is this build):
+    char const * opponent_path;
+
+    struct game_result * results;
+    int game_count;
+
+    // Protects next_game, failed and bot_latency, only:
+    struct mt_chess_thread_mutex mutex;
+    int next_game;
+    bool failed; // The opponent could not be reached or sent an error.
+
+    // Merged from the threads' histograms, when they are done:
+    struct mt_chess_hist bot_latency;
+};
+
+static char const * get_reason(int const state)
+{
+    switch(state)
+    {
+        case MT_SELFPLAY_STATE_TIME: return "time";
+        case mt_chess_game_state_checkmate: return "checkmate";
+        case mt_chess_game_state_stalemate: return "stalemate";
+        case mt_chess_game_state_fifty_moves: return "fifty_moves";
+        case mt_chess_game_state_repetition: return "repetition";
+        case mt_chess_game_state_insufficient_material: return "material";
+        default: return "max_plies";
+    }
+}
+
+static bool parse_budget(char const * const str, struct budget * const out)
+{
+    char * end = NULL;
+    uint64_t const value = (uint64_t)strtoull(str, &end, 10);
+
+    if(value == 0)
+    {
+        return false;
+    }
+    out->nodes = 0;
+    out->time_ns = 0;
+    out->clock_ns = 0;
+    out->increment_ns = 0;
+    if(strcmp(end, "ms") == 0)
+    {
+        out->time_ns = value * 1000000ULL;
+        return true;
+    }
+    if(*end == '+')
+    {
+        char const * const inc_str = end + 1;
+
+        out->clock_ns = value * 1000000ULL;
+        out->increment_ns =
+            (uint64_t)strtoull(inc_str, &end, 10) * 1000000ULL;
+        return end != inc_str && *end == '\0';
+    }
+    if(*end != '\0')
+    {
+        return false;
+    }
+    out->nodes = value;
+    return true;
+}
+
+/**
+ * - Connection of a thread to the server playing engine B.
+ */
+struct remote
+{
+    struct mt_chess_tool_socket socket;
+    char buf[256]; // Received, but not read, yet.
+    size_t len;
+    uint64_t next_id;
+};
+
+/**
+ * - Reads the next line received (without line break).
+ * - Returns false on error.
+ */
+static bool read_remote_line(
+    struct remote * const remote, char * const out_line, size_t const size)
+{
+    while(true)
+    {
+        char const * const end =
+            (char const *)memchr(remote->buf, '\n', remote->len);
+
+        if(end != NULL)
+        {
+            size_t const len = (size_t)(end - remote->buf);
+
+            if(size <= len)
+            {
+                return false;
+            }
+            memcpy(out_line, remote->buf, len);
+            out_line[len] = '\0';
+            remote->len -= len + 1;
+            memmove(remote->buf, end + 1, remote->len);
+            return true;
+        }
+        if(remote->len == sizeof remote->buf)
+        {
+            return false; // (line is too long)
+        }
+
+        size_t const count = mt_chess_tool_socket_recv(
+            &remote->socket,
+            remote->buf + remote->len,
+            sizeof remote->buf - remote->len);
+
+        if(count == 0)
+        {
+            return false;
+        }
+        remote->len += count;
+    }
+}
+
+/**
+ * - Sends the request of given command and arguments (e.g. "move 3 e2e4") and
+ *   waits for the response.
+ * - Stores the move of the response (or an empty string), if given a buffer.
+ * - Returns false on error or an error response.
+ */
+static bool request_remote(
+    struct remote * const remote,
+    char const * const cmd_args,
+    char * const out_move)
+{
+    char line[128];
+    uint64_t const id = remote->next_id++;
+    int const len = snprintf(
+        line, sizeof line, "%llu %s\n", (unsigned long long)id, cmd_args);
+
+    assert(0 < len && len < (int)sizeof line);
+
+    if(!mt_chess_tool_socket_send(&remote->socket, line, (size_t)len)
+        || !read_remote_line(remote, line, sizeof line))
+    {
+        return false;
+    }
+
+    unsigned long long response_id = 0;
+    char status[8];
+    char move[MT_CHESS_MOVE_STR_SIZE] = "";
+
+    if(sscanf(line, "%llu %7s %5s", &response_id, status, move) < 2
+        || response_id != id
+        || strcmp(status, "ok") != 0)
+    {
+        return false;
+    }
+    if(out_move != NULL)
+    {
+        strcpy(out_move, move);
+    }
+    return true;
+}
+
+/**
+ * - Sends the moves of the game from given count of moves on to the server.
+ * - Returns false on error.
+ */
+static bool sync_remote(
+    struct remote * const remote,
+    struct mt_chess_game const * const game,
+    uint32_t const game_id,
+    int const synced)
+{
+    int i = 0;
+
+    for(struct mt_chess_log_node const * node = game->log;
+        node != NULL;
+        node = node->next, ++i)
+    {
+        if(i < synced)
+        {
+            continue;
+        }
+
+        char move[MT_CHESS_MOVE_STR_SIZE];
+        char cmd_args[64];
+
+        mt_chess_move_get_str(node->move, move);
+        snprintf(cmd_args, sizeof cmd_args, "move %u %s", game_id, move);
+        if(!request_remote(remote, cmd_args, NULL))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * - Lets the server search and apply the move of engine B and returns it.
+ * - Returns 0 on error.
+ */
+static uint16_t get_remote_move(
+    struct remote * const remote,
+    struct mt_chess_game const * const game,
+    uint32_t const game_id,
+    uint64_t const nodes)
+{
+    char cmd_args[64];
+    char move_str[MT_CHESS_MOVE_STR_SIZE];
+    struct mt_chess_move_list list;
+
+    snprintf(
+        cmd_args,
+        sizeof cmd_args,
+        "bot %u %llu",
+        game_id,
+        (unsigned long long)nodes);
+    if(!request_remote(remote, cmd_args, move_str))
+    {
+        return 0;
+    }
+    mt_chess_movegen_get_legal(&game->data, &list);
+    return mt_chess_move_find_str(move_str, list.moves, list.count);
+}
+
+/**
+ * - Applies the opening's moves to given (new) game.
+ */
+static void play_opening(
+    struct mt_chess_game * const game, char const * const opening)
+{
+    char const * str = opening;
+
+    while(*str != '\0')
+    {
+        char move_str[MT_CHESS_MOVE_STR_SIZE];
+        int len = 0;
+        struct mt_chess_move_list list;
+
+        while(str[len] != ' ' && str[len] != '\0')
+        {
+            assert(len < MT_CHESS_MOVE_STR_SIZE - 1);
+
+            move_str[len] = str[len];
+            ++len;
+        }
+        move_str[len] = '\0';
+
+        mt_chess_movegen_get_legal(&game->data, &list);
+
+        uint16_t const move =
+            mt_chess_move_find_str(move_str, list.moves, list.count);
+
+        assert(move != 0); // (opening list is hard-coded)
+
+        mt_chess_game_do_move(game, move);
+
+        str += len;
+        while(*str == ' ')
+        {
+            ++str;
+        }
+    }
+}
+
+/**
+ * - Creates the string of the game's moves (to be freed by the caller).
+ */
+static char * create_moves_str(struct mt_chess_game const * const game)
+{
+    size_t const size = (size_t)game->ply_count * MT_CHESS_MOVE_STR_SIZE + 1;
+    char * const ret_val = (char *)mt_chess_mem_alloc(size);
+    size_t len = 0;
+
+    ret_val[0] = '\0';
+    for(struct mt_chess_log_node const * node = game->log;
+        node != NULL;
+        node = node->next)
+    {
+        if(len != 0)
+        {
+            ret_val[len++] = ' ';
+        }
+        mt_chess_move_get_str(node->move, ret_val + len);
+        len += strlen(ret_val + len);
+    }
+    assert(len < size);
+    return ret_val;
+}
+
+/**
+ * - Plays game with given index (engine A is white for even indices), engine
+ *   B via given connection, if not NULL.
+ * - Returns false, if the opponent failed (the result is not set, then).
+ */
+static bool play(
+    struct selfplay * const selfplay,
+    struct remote * const remote,
+    struct mt_chess_game * const game,
+    int const index)
+{
+    struct game_result * const out = selfplay->results + index;
+    int const a_color = index % 2 == 0
+        ? (int)mt_chess_color_white : (int)mt_chess_color_black;
+    enum mt_chess_game_state state = mt_chess_game_state_ongoing;
+    uint64_t time_ns[2] = { 0, 0 }; // Per color.
+    uint64_t clock_ns[2]; // Per color (time left in clocked games).
+    bool lost_on_time = false; // By the player having the turn.
+    uint32_t const game_id =
+        (uint32_t)index % MT_CHESS_TOOL_SERVER_MAX_GAMES;
+    int synced = 0; // Count of moves the opponent knows.
+    char cmd_args[64];
+
+    snprintf(cmd_args, sizeof cmd_args, "new %u", game_id);
+    if(remote != NULL && !request_remote(remote, cmd_args, NULL))
+    {
+        return false;
+    }
+
+    mt_chess_game_reset(game);
+    play_opening(game, s_openings[(index / 2) % s_opening_count]);
+
+    for(int color = 0; color < 2; ++color)
+    {
+        clock_ns[color] =
+            selfplay->budgets[color == a_color ? 0 : 1].clock_ns;
+    }
+
+    out->nodes = 0;
+    while(game->ply_count < s_max_plies)
+    {
+        state = mt_chess_game_get_state(game);
+        if(state != mt_chess_game_state_ongoing)
+        {
+            break;
+        }
+
+        struct budget const * const budget =
+            selfplay->budgets + ((int)game->data.turn == a_color ? 0 : 1);
+        struct mt_chess_search_limits limits;
+        struct mt_chess_search_result result;
+        struct mt_chess_timeman timeman;
+
+        mt_chess_search_init_limits(&limits);
+        limits.nodes = budget->nodes;
+        limits.time_ns = budget->time_ns;
+        if(budget->clock_ns != 0)
+        {
+            struct mt_chess_timeman_clock clock;
+
+            clock.remaining_ns = clock_ns[game->data.turn];
+            clock.increment_ns = budget->increment_ns;
+            clock.moves_to_go = 0;
+            mt_chess_timeman_init(&timeman, &clock);
+            limits.timeman = &timeman;
+        }
+
+        uint64_t const start = mt_chess_clock_get_ns();
+
+        if(remote != NULL && (int)game->data.turn != a_color)
+        {
+            if(!sync_remote(remote, game, game_id, synced))
+            {
+                return false;
+            }
+            result.move = get_remote_move(remote, game, game_id, budget->nodes);
+            result.nodes = 0;
+            if(result.move == 0)
+            {
+                return false;
+            }
+            synced = game->ply_count + 1; // (the server applied it, too)
+        }
+        else
+        {
+            mt_chess_search_get_best(&game->data, &limits, &result);
+        }
+
+        uint64_t const spent = mt_chess_clock_get_ns() - start;
+
+        time_ns[game->data.turn] += spent;
+
+        assert(result.move != 0); // (game is not over)
+
+        if(budget->clock_ns != 0)
+        {
+            if(clock_ns[game->data.turn] <= spent)
+            {
+                lost_on_time = true;
+                break;
+            }
+            clock_ns[game->data.turn] =
+                clock_ns[game->data.turn] - spent + budget->increment_ns;
+        }
+
+        out->nodes += result.nodes;
+        mt_chess_game_do_move(game, result.move);
+    }
+
+    out->state = lost_on_time
+        ? (uint8_t)MT_SELFPLAY_STATE_TIME : (uint8_t)state;
+    out->result = (uint8_t)result_draw;
+    if(state == mt_chess_game_state_checkmate || lost_on_time)
+    {
+        // The player having the turn lost.
+        out->result = game->data.turn == mt_chess_color_white
+            ? (uint8_t)result_black : (uint8_t)result_white;
+    }
+    out->moves = create_moves_str(game);
+
+    struct mt_chess_record_header header;
+
+    header.result = out->result == (uint8_t)result_draw
+        ? (uint8_t)mt_chess_record_result_draw
+        : (out->result == (uint8_t)result_white
+            ? (uint8_t)mt_chess_record_result_white
+            : (uint8_t)mt_chess_record_result_black);
+    header.termination = state == mt_chess_game_state_ongoing
+        ? (uint8_t)mt_chess_record_termination_adjudication // (max. plies)
+        : (uint8_t)state; // (same values)
+    if(lost_on_time)
+    {
+        header.termination = (uint8_t)mt_chess_record_termination_time;
+    }
+    header.time_ms[0] = (uint32_t)(time_ns[0] / 1000000);
+    header.time_ms[1] = (uint32_t)(time_ns[1] / 1000000);
+    out->record_size = mt_chess_record_get_size(game);
+    out->record = (uint8_t *)mt_chess_mem_alloc(out->record_size);
+    mt_chess_record_write(game, &header, out->record);
+
+    snprintf(cmd_args, sizeof cmd_args, "end %u", game_id);
+    return remote == NULL || request_remote(remote, cmd_args, NULL);
+}
+
+static void run_thread(void * const arg)
+{
+    struct selfplay * const selfplay = (struct selfplay *)arg;
+    struct mt_chess_game * const game = mt_chess_game_create();
+    struct mt_chess_hist latency;
+    struct remote remote;
+    bool connected = false;
+
+    if(selfplay->opponent_path != NULL)
+    {
+        remote.len = 0;
+        remote.next_id = 0;
+        connected = mt_chess_tool_socket_connect(
+            selfplay->opponent_path, &remote.socket);
+    }
+
+    bool ok = selfplay->opponent_path == NULL || connected;
+
+    mt_chess_latency_reset();
+    mt_chess_latency_set_enabled(true);
+
+    while(ok)
+    {
+        mt_chess_thread_mutex_lock(&selfplay->mutex);
+
+        int const index = selfplay->failed ? selfplay->game_count
+            : selfplay->next_game;
+
+        if(index < selfplay->game_count)
+        {
+            ++selfplay->next_game;
+        }
+        mt_chess_thread_mutex_unlock(&selfplay->mutex);
+
+        if(selfplay->game_count <= index)
+        {
+            break; // All games are (being) played or the opponent failed.
+        }
+
+        MT_CHESS_TRACE_BEGIN(trace_begin);
+
+        ok = play(
+            selfplay,
+            selfplay->opponent_path != NULL ? &remote : NULL,
+            game,
+            index);
+
+        MT_CHESS_TRACE_END(trace_begin, "game", index);
+    }
+    mt_chess_game_free(game);
+    if(connected)
+    {
+        mt_chess_tool_socket_close(&remote.socket);
+    }
+
+    mt_chess_latency_get(mt_chess_latency_id_bot_move, &latency);
+    mt_chess_thread_mutex_lock(&selfplay->mutex);
+    mt_chess_hist_merge(&selfplay->bot_latency, &latency);
+    selfplay->failed = selfplay->failed || !ok;
+    mt_chess_thread_mutex_unlock(&selfplay->mutex);
+}
+
+static bool is_record_path(char const * const path)
+{
+    static char const ext[] = ".rec";
+
+    size_t const len = strlen(path);
+
+    return sizeof ext - 1 <= len
+        && strcmp(path + len - (sizeof ext - 1), ext) == 0;
+}
+
+static bool write_results(
+    struct selfplay const * const selfplay, char const * const path)
+{
+    static char const * const result_strs[3] = { "1-0", "0-1", "1/2-1/2" };
+
+    bool const records = is_record_path(path);
+    FILE * const file = fopen(path, records ? "wb" : "w");
+
+    if(file == NULL)
+    {
+        return false;
+    }
+    if(records)
+    {
+        bool written = true;
+
+        for(int i = 0; i < selfplay->game_count && written; ++i)
+        {
+            struct game_result const * const r = selfplay->results + i;
+
+            written = fwrite(r->record, 1, r->record_size, file)
+                == r->record_size;
+        }
+        return fclose(file) == 0 && written;
+    }
+    for(int i = 0; i < selfplay->game_count; ++i)
+    {
+        struct game_result const * const r = selfplay->results + i;
+
+        fprintf(
+            file,
+            "%d %d %c %s %s %s\n",
+            i,
+            (i / 2) % s_opening_count,
+            i % 2 == 0 ? 'A' : 'B',
+            result_strs[r->result],
+            get_reason((int)r->state),
+            r->moves);
+    }
+    return fclose(file) == 0;
+}
+
+static void print_report(
+    struct selfplay const * const selfplay,
+    uint64_t const ns,
+    int const threads)
+{
+    double const seconds = (double)ns / 1000000000.0;
+    uint64_t nodes = 0;
+    int wins = 0; // Of A.
+    int draws = 0;
+    int losses = 0;
+    int reasons[MT_SELFPLAY_STATE_TIME + 1] = { 0 };
+
+    for(int i = 0; i < selfplay->game_count; ++i)
+    {
+        struct game_result const * const r = selfplay->results + i;
+        enum result const a_win = i % 2 == 0 ? result_white : result_black;
+
+        nodes += r->nodes;
+        ++reasons[r->state];
+        if(r->result == result_draw)
+        {
+            ++draws;
+            continue;
+        }
+        if(r->result == (uint8_t)a_win)
+        {
+            ++wins;
+            continue;
+        }
+        ++losses;
+    }
+
+    double const score =
+        ((double)wins + 0.5 * (double)draws) / (double)selfplay->game_count;
+
+    printf(
+        "Games:   %d in %.3f s (%.2f games/s), %d thread(-s)\n",
+        selfplay->game_count,
+        seconds,
+        0.0 < seconds ? (double)selfplay->game_count / seconds : 0.0,
+        threads);
+    printf(
+        "Nodes:   %llu (%.0f nodes/s)\n",
+        (unsigned long long)nodes,
+        0.0 < seconds ? (double)nodes / seconds : 0.0);
+    printf(
+        "A:       +%d =%d -%d (score %.1f %%",
+        wins, draws, losses, 100.0 * score);
+    if(0.0 < score && score < 1.0)
+    {
+        // (adding 0.0 to avoid printing "-0")
+        printf(", %+.0f Elo", -400.0 * log10(1.0 / score - 1.0) + 0.0);
+    }
+    printf(")\n");
+    printf("Reasons:");
+    for(int s = 0; s <= MT_SELFPLAY_STATE_TIME; ++s)
+    {
+        if(reasons[s] != 0)
+        {
+            printf(" %s %d", get_reason(s), reasons[s]);
+        }
+    }
+    printf("\n");
+
+    struct mt_chess_hist const * const latency = &selfplay->bot_latency;
+
+    printf(
+        "Latency: p50 %.2f ms, p99 %.2f ms, p999 %.2f ms, max %.2f ms (per bot move)\n",
+        (double)mt_chess_hist_get_percentile(latency, 50.0) / 1000000.0,
+        (double)mt_chess_hist_get_percentile(latency, 99.0) / 1000000.0,
+        (double)mt_chess_hist_get_percentile(latency, 99.9) / 1000000.0,
+        (double)latency->max / 1000000.0);
+}
+
+int mt_chess_tool_selfplay_main(int const argc, char * * const argv)
+{
+    static char const opponent_prefix[] = "--opponent=";
+
+    struct selfplay selfplay;
+    int threads = mt_chess_thread_get_cpu_count();
+    int arg_count = argc;
+    char * * args = argv;
+
+    selfplay.opponent_path = NULL;
+    if(1 <= argc
+        && strncmp(argv[0], opponent_prefix, sizeof opponent_prefix - 1) == 0)
+    {
+        selfplay.opponent_path = argv[0] + sizeof opponent_prefix - 1;
+        --arg_count;
+        ++args;
+    }
+
+    selfplay.game_count = s_default_games;
+    selfplay.budgets[0].nodes = s_default_nodes;
+    selfplay.budgets[0].time_ns = 0;
+    selfplay.budgets[0].clock_ns = 0;
+    selfplay.budgets[0].increment_ns = 0;
+    selfplay.budgets[1] = selfplay.budgets[0];
+
+    if(arg_count < 1
+        || (2 <= arg_count && (selfplay.game_count = atoi(args[1])) < 1)
+        || (3 <= arg_count && (threads = atoi(args[2])) < 1)
+        || (4 <= arg_count && !parse_budget(args[3], selfplay.budgets))
+        || (5 <= arg_count && !parse_budget(args[4], selfplay.budgets + 1)))
+    {
+        printf(
+            "Usage: selfplay [--opponent=<socket path>] <output file> [games] [threads]\n"
+            "                [budget A] [budget B]\n"
+            "       (budget is a node count, a time per move, e.g. 50ms, or a clock in ms\n"
+            "       with increment, e.g. 10000+100)\n"
+            "       (the opponent is the server command of another build playing B,\n"
+            "       budget B must be a node count, then)\n");
+        return 1;
+    }
+    if(arg_count == 4)
+    {
+        selfplay.budgets[1] = selfplay.budgets[0];
+    }
+    if(selfplay.opponent_path != NULL)
+    {
+        if(selfplay.budgets[1].nodes == 0
+            || MT_CHESS_TOOL_SERVER_MAX_BOT_NODES < selfplay.budgets[1].nodes)
+        {
+            printf(
+                "Error: Budget B must be a node count of at most %d with an opponent!\n",
+                MT_CHESS_TOOL_SERVER_MAX_BOT_NODES);
+            return 1;
+        }
+        if(!mt_chess_tool_socket_init())
+        {
+            printf("Error: Sockets are not available!\n");
+            return 1;
+        }
+    }
+
+    selfplay.results = (struct game_result *)mt_chess_mem_alloc(
+        (size_t)selfplay.game_count * sizeof *selfplay.results);
+    for(int i = 0; i < selfplay.game_count; ++i)
+    {
+        selfplay.results[i].moves = NULL;
+        selfplay.results[i].record = NULL;
+    }
+    selfplay.next_game = 0;
+    selfplay.failed = false;
+    mt_chess_thread_mutex_init(&selfplay.mutex);
+    mt_chess_hist_reset(&selfplay.bot_latency);
+
+    struct mt_chess_thread * const thread_objs =
+        (struct mt_chess_thread *)mt_chess_mem_alloc(
+            (size_t)threads * sizeof *thread_objs);
+    uint64_t const start = mt_chess_clock_get_ns();
+    int started = 0;
+
+    while(started < threads
+        && mt_chess_thread_start(thread_objs + started, run_thread, &selfplay))
+    {
+        ++started;
+    }
+    if(started == 0)
+    {
+        run_thread(&selfplay); // Plays all games on this thread.
+    }
+    for(int i = 0; i < started; ++i)
+    {
+        mt_chess_thread_join(thread_objs + i);
+    }
+
+    uint64_t const ns = mt_chess_clock_get_ns() - start;
+    bool written = false;
+
+    if(started < threads)
+    {
+        printf(
+            "Error: Started %d of %d thread(-s), only!\n", started, threads);
+    }
+    if(selfplay.failed)
+    {
+        printf(
+            "Error: Failed to play via opponent at \"%s\"!\n",
+            selfplay.opponent_path);
+    }
+    else
+    {
+        written = write_results(&selfplay, args[0]);
+        print_report(&selfplay, ns, started == 0 ? 1 : started);
+        if(!written)
+        {
+            printf("Error: Failed to write \"%s\"!\n", args[0]);
+        }
+    }
+
+    for(int i = 0; i < selfplay.game_count; ++i)
+    {
+        mt_chess_mem_free(selfplay.results[i].moves);
+        mt_chess_mem_free(selfplay.results[i].record);
+    }
+    mt_chess_mem_free(thread_objs);
+    mt_chess_mem_free(selfplay.results);
+    mt_chess_thread_mutex_deinit(&selfplay.mutex);
+    if(selfplay.opponent_path != NULL)
+    {
+        mt_chess_tool_socket_deinit();
+    }
+    return written ? 0 : 1;
+}
@@ -0,0 +1,32 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_TOOL_SELFPLAY
+#define MT_CHESS_TOOL_SELFPLAY
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+/**
+ * - Command-line entry point ("selfplay [--opponent=<socket path>] <output
+ *   file> [games] [threads] [budget A] [budget B]").
+ * - Plays games of engine configuration A against B on multiple threads, each
+ *   thread playing its own games. A budget is a node count (e.g. "20000"), a
+ *   time per move (e.g. "50ms") or a clock in milliseconds per game plus
+ *   increment per move (e.g. "10000+100", see mt_chess_timeman.h).
+ * - B is this build with its own budget or, with an opponent given, the server
+ *   command of another build listening at the socket path (to compare two
+ *   builds, budget B must be a node count, then).
+ * - Game pairs start with the same opening from a built-in list, with colors
+ *   swapped.
+ * - Writes one line per game to the output file (or binary game records, if
+ *   its name ends with ".rec") and prints games/s, nodes/s, win/draw/loss of
+ *   A and latency percentiles of the bot moves.
+ */
+int mt_chess_tool_selfplay_main(int const argc, char * * const argv);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_TOOL_SELFPLAY
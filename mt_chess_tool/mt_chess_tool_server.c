@@ -0,0 +1,982 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+// Line protocol of the server command (stdin/stdout and each connection to the
+// socket, if any):
+//
+// - Request:  <id> new <game>
+//             <id> move <game> <move>   (coordinate notation, e.g. e7e8q, or
+//                                        SAN, e.g. e8=Q+)
+//             <id> bot <game> [<nodes>] (1 to 1000000, default 20000)
+//             <id> undo <game>
+//             <id> end <game>
+// - Response: <id> ok [<move>]
+//             <id> error <message>
+// - Responses of one game are in request order, responses of different games
+//   may be not.
+// - Game IDs are shared by all clients, so clients should use distinct ones.
+// - Reading "quit" or end of input waits for all responses and exits (or
+//   closes the connection of a socket client).
+// - After a bot move, the expected reply gets searched in the background, if
+//   less than the given count of games ("server [workers] [pondering games]")
+//   are pondering (see mt_chess_ponder.h). The next bot move of the game
+//   continues that search, if the expected reply was played.
+// - With a socket path given ("server [workers] [pondering games] [path]"),
+//   local clients may connect to the socket file created there (AF_UNIX, on
+//   Windows 10 version 1803 or later), too. Stdin still controls the lifetime:
+//   Reading "quit" or end of input from it stops accepting connections, stops
+//   reading from the clients, waits for their responses and removes the
+//   socket file.
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstdlib>
+    #include <cstdio>
+    #include <cstring>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stdlib.h>
+    #include <stdio.h>
+    #include <string.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_tool_server.h"
+#include "mt_chess_tool_socket.h"
+#include "mt_chess_game.h"
+#include "mt_chess_movegen.h"
+#include "mt_chess_move.h"
+#include "mt_chess_san.h"
+#include "mt_chess_search.h"
+#include "mt_chess_ponder.h"
+#include "mt_chess_thread.h"
+#include "mt_chess_clock.h"
+#include "mt_chess_trace.h"
+#include "mt_chess_mem.h"
+
+static uint64_t const s_default_bot_nodes = 20000;
+
+static char const * const s_cmd_names[MT_CHESS_TOOL_SERVER_CMD_COUNT] = {
+    "new", "move", "bot", "undo", "end"
+};
+
+/**
+ * - A game and its pondering state.
+ */
+struct game_slot
+{
+    struct mt_chess_game * game; // NULL, if no game.
+    struct mt_chess_ponder ponder;
+};
+
+/**
+ * - A worker thread with its queue and the games it owns.
+ */
+struct shard
+{
+    struct mt_chess_tool_server * server;
+
+    struct mt_chess_thread thread;
+
+    // Protects the queue and the stop flag (not the games):
+    struct mt_chess_thread_mutex mutex;
+    struct mt_chess_thread_cond not_empty;
+    struct mt_chess_thread_cond not_full;
+
+    struct mt_chess_tool_server_request queue[MT_CHESS_TOOL_SERVER_QUEUE_LEN];
+    int first; // Index of the oldest queued request.
+    int count; // Count of queued requests.
+    bool stop;
+
+    // Accessed by the worker, only. Indexed by game ID divided by worker count:
+    struct game_slot * games;
+    uint32_t game_capacity;
+};
+
+struct mt_chess_tool_server
+{
+    struct shard * shards;
+    int shard_count;
+
+    void (*on_response)(
+        void * const ctx,
+        struct mt_chess_tool_server_response const * const response);
+    void * ctx;
+
+    struct mt_chess_ponder_pool * ponder_pool; // NULL = no pondering.
+};
+
+char const * mt_chess_tool_server_get_cmd_name(
+    enum mt_chess_tool_server_cmd const cmd)
+{
+    assert(0 <= (int)cmd && (int)cmd < MT_CHESS_TOOL_SERVER_CMD_COUNT);
+
+    return s_cmd_names[cmd];
+}
+
+/**
+ * - Returns pointer to the game's slot.
+ */
+static struct game_slot * get_slot(
+    struct shard * const shard, uint32_t const game_id)
+{
+    uint32_t const slot = game_id / (uint32_t)shard->server->shard_count;
+
+    if(shard->game_capacity <= slot)
+    {
+        uint32_t capacity = shard->game_capacity == 0
+            ? 64 : shard->game_capacity;
+
+        while(capacity <= slot)
+        {
+            capacity *= 2;
+        }
+
+        struct game_slot * const games =
+            (struct game_slot *)mt_chess_mem_alloc(capacity * sizeof *games);
+
+        for(uint32_t i = 0; i < capacity; ++i)
+        {
+            if(i < shard->game_capacity)
+            {
+                games[i] = shard->games[i];
+                continue;
+            }
+            games[i].game = NULL;
+            mt_chess_ponder_init(
+                &games[i].ponder, shard->server->ponder_pool);
+        }
+        mt_chess_mem_free(shard->games);
+        shard->games = games;
+        shard->game_capacity = capacity;
+    }
+    return shard->games + slot;
+}
+
+static int get_legal_count(struct mt_chess_game const * const game)
+{
+    struct mt_chess_move_list list;
+
+    mt_chess_movegen_get_legal(&game->data, &list);
+    return list.count;
+}
+
+static void process(
+    struct shard * const shard,
+    struct mt_chess_tool_server_request const * const request,
+    struct mt_chess_tool_server_response * const out_response)
+{
+    struct game_slot * const slot = get_slot(shard, request->game);
+    struct mt_chess_game * game = slot->game;
+
+    out_response->request = request;
+    out_response->error = NULL;
+    out_response->move = 0;
+    out_response->legal_count = 0;
+
+    if(request->cmd == mt_chess_tool_server_cmd_new)
+    {
+        mt_chess_ponder_stop(&slot->ponder);
+        if(game == NULL)
+        {
+            slot->game = mt_chess_game_create();
+        }
+        else
+        {
+            mt_chess_game_reset(game); // Reuses memory.
+        }
+        out_response->legal_count = get_legal_count(slot->game);
+        return;
+    }
+
+    if(game == NULL)
+    {
+        out_response->error = "Unknown game.";
+        return;
+    }
+
+    switch((enum mt_chess_tool_server_cmd)request->cmd)
+    {
+        case mt_chess_tool_server_cmd_move:
+        {
+            struct mt_chess_move_list list;
+
+            mt_chess_movegen_get_legal(&game->data, &list);
+
+            uint16_t move =
+                mt_chess_move_find_str(request->move, list.moves, list.count);
+
+            if(move == 0)
+            {
+                move = mt_chess_san_find_str(request->move, &game->data, &list);
+            }
+
+            if(move == 0)
+            {
+                out_response->error = "Illegal move.";
+                break;
+            }
+            mt_chess_game_do_move(game, move);
+            out_response->move = move;
+
+            mt_chess_ponder_check_miss(&slot->ponder, &game->data);
+            break;
+        }
+        case mt_chess_tool_server_cmd_bot:
+        {
+            struct mt_chess_search_limits limits;
+            struct mt_chess_search_result result;
+
+            mt_chess_search_init_limits(&limits);
+            limits.nodes = request->nodes;
+
+            // Pondering was started after the bot's last move, if at all (a
+            // miss stops it):
+            //
+            if(!mt_chess_ponder_get_best(
+                &slot->ponder, &game->data, &limits, &result))
+            {
+                mt_chess_search_get_best(&game->data, &limits, &result);
+            }
+
+            if(result.move == 0)
+            {
+                out_response->error = "There is no legal move.";
+                break;
+            }
+            mt_chess_game_do_move(game, result.move);
+            out_response->move = result.move;
+
+            // Searches the expected reply during the opponent's time (if
+            // below the cap of pondering games):
+            //
+            mt_chess_ponder_start(&slot->ponder, &game->data, result.reply);
+            break;
+        }
+        case mt_chess_tool_server_cmd_undo:
+        {
+            mt_chess_ponder_stop(&slot->ponder);
+            if(!mt_chess_game_undo(game))
+            {
+                out_response->error = "There is no move to take back.";
+            }
+            break;
+        }
+        case mt_chess_tool_server_cmd_end:
+        {
+            mt_chess_ponder_stop(&slot->ponder);
+            mt_chess_game_free(game);
+            slot->game = NULL;
+            return;
+        }
+
+        default:
+        {
+            out_response->error = "Unknown command.";
+            return;
+        }
+    }
+    out_response->legal_count = get_legal_count(game);
+}
+
+static void run_worker(void * const arg)
+{
+    struct shard * const shard = (struct shard *)arg;
+    struct mt_chess_tool_server_request request;
+    struct mt_chess_tool_server_response response;
+
+    while(true)
+    {
+        mt_chess_thread_mutex_lock(&shard->mutex);
+        while(shard->count == 0 && !shard->stop)
+        {
+            mt_chess_thread_cond_wait(&shard->not_empty, &shard->mutex);
+        }
+        if(shard->count == 0)
+        {
+            assert(shard->stop);
+
+            mt_chess_thread_mutex_unlock(&shard->mutex);
+            return; // Stopped and all requests processed.
+        }
+        request = shard->queue[shard->first];
+        shard->first = (shard->first + 1) % MT_CHESS_TOOL_SERVER_QUEUE_LEN;
+        --shard->count;
+        mt_chess_thread_cond_signal(&shard->not_full);
+        mt_chess_thread_mutex_unlock(&shard->mutex);
+
+        MT_CHESS_TRACE_BEGIN(trace_begin);
+
+        process(shard, &request, &response);
+
+        MT_CHESS_TRACE_END(
+            trace_begin,
+            request.cmd < MT_CHESS_TOOL_SERVER_CMD_COUNT
+                ? mt_chess_tool_server_get_cmd_name(
+                    (enum mt_chess_tool_server_cmd)request.cmd)
+                : "unknown",
+            request.game);
+
+        shard->server->on_response(shard->server->ctx, &response);
+    }
+}
+
+struct mt_chess_tool_server * mt_chess_tool_server_create(
+    int const worker_count,
+    int const ponder_count,
+    void (*on_response)(
+        void * const ctx,
+        struct mt_chess_tool_server_response const * const response),
+    void * const ctx)
+{
+    assert(1 <= worker_count);
+    assert(0 <= ponder_count);
+    assert(on_response != NULL);
+
+    struct mt_chess_tool_server * const ret_val =
+        (struct mt_chess_tool_server *)mt_chess_mem_alloc(sizeof *ret_val);
+
+    ret_val->shards = (struct shard *)mt_chess_mem_alloc(
+        (size_t)worker_count * sizeof *ret_val->shards);
+    ret_val->shard_count = worker_count;
+    ret_val->on_response = on_response;
+    ret_val->ctx = ctx;
+    ret_val->ponder_pool = ponder_count == 0
+        ? NULL : mt_chess_ponder_pool_create(ponder_count);
+    assert(ponder_count == 0 || ret_val->ponder_pool != NULL);
+
+    for(int i = 0; i < worker_count; ++i)
+    {
+        struct shard * const shard = ret_val->shards + i;
+
+        shard->server = ret_val;
+        mt_chess_thread_mutex_init(&shard->mutex);
+        mt_chess_thread_cond_init(&shard->not_empty);
+        mt_chess_thread_cond_init(&shard->not_full);
+        shard->first = 0;
+        shard->count = 0;
+        shard->stop = false;
+        shard->games = NULL;
+        shard->game_capacity = 0;
+    }
+    for(int i = 0; i < worker_count; ++i)
+    {
+        bool const started = mt_chess_thread_start(
+            &ret_val->shards[i].thread, run_worker, ret_val->shards + i);
+
+        assert(started);
+        (void)started;
+    }
+    return ret_val;
+}
+
+void mt_chess_tool_server_free(struct mt_chess_tool_server * const server)
+{
+    assert(server != NULL);
+
+    for(int i = 0; i < server->shard_count; ++i)
+    {
+        struct shard * const shard = server->shards + i;
+
+        mt_chess_thread_mutex_lock(&shard->mutex);
+        shard->stop = true;
+        mt_chess_thread_cond_signal(&shard->not_empty);
+        mt_chess_thread_mutex_unlock(&shard->mutex);
+    }
+    for(int i = 0; i < server->shard_count; ++i)
+    {
+        struct shard * const shard = server->shards + i;
+
+        mt_chess_thread_join(&shard->thread);
+
+        for(uint32_t j = 0; j < shard->game_capacity; ++j)
+        {
+            mt_chess_ponder_stop(&shard->games[j].ponder);
+            if(shard->games[j].game != NULL)
+            {
+                mt_chess_game_free(shard->games[j].game);
+            }
+        }
+        mt_chess_mem_free(shard->games);
+
+        mt_chess_thread_cond_deinit(&shard->not_full);
+        mt_chess_thread_cond_deinit(&shard->not_empty);
+        mt_chess_thread_mutex_deinit(&shard->mutex);
+    }
+    if(server->ponder_pool != NULL)
+    {
+        mt_chess_ponder_pool_free(server->ponder_pool);
+    }
+    mt_chess_mem_free(server->shards);
+    mt_chess_mem_free(server);
+}
+
+void mt_chess_tool_server_submit(
+    struct mt_chess_tool_server * const server,
+    struct mt_chess_tool_server_request const * const request)
+{
+    assert(server != NULL);
+    assert(request != NULL);
+    assert(request->game < MT_CHESS_TOOL_SERVER_MAX_GAMES);
+    assert(
+        request->cmd != (uint8_t)mt_chess_tool_server_cmd_bot
+            || (0 < request->nodes
+                && request->nodes <= MT_CHESS_TOOL_SERVER_MAX_BOT_NODES));
+
+    struct shard * const shard =
+        server->shards + request->game % (uint32_t)server->shard_count;
+
+    mt_chess_thread_mutex_lock(&shard->mutex);
+    while(shard->count == MT_CHESS_TOOL_SERVER_QUEUE_LEN)
+    {
+        mt_chess_thread_cond_wait(&shard->not_full, &shard->mutex);
+    }
+
+    struct mt_chess_tool_server_request * const queued = shard->queue
+        + (shard->first + shard->count) % MT_CHESS_TOOL_SERVER_QUEUE_LEN;
+
+    *queued = *request;
+    queued->submit_ns = mt_chess_clock_get_ns();
+    ++shard->count;
+    mt_chess_thread_cond_signal(&shard->not_empty);
+    mt_chess_thread_mutex_unlock(&shard->mutex);
+}
+
+/**
+ * - A connection of a client to the socket (see run_client()).
+ */
+struct client
+{
+    struct listener * listener;
+    struct mt_chess_tool_socket socket;
+    struct mt_chess_thread thread;
+
+    // Protects sending and the count of pending requests:
+    struct mt_chess_thread_mutex mutex;
+    struct mt_chess_thread_cond idle; // Signaled, when no request is pending.
+    uint64_t pending; // Count of requests submitted, but not responded to.
+
+    // Protected by the listener's mutex:
+    bool done; // The thread closed the socket and is about to return.
+    struct client * next;
+};
+
+/**
+ * - Accepts the connections to the socket (see run_listener()).
+ */
+struct listener
+{
+    struct mt_chess_tool_server * server;
+    char const * path;
+    struct mt_chess_tool_socket socket;
+    struct mt_chess_thread thread;
+
+    // Protects the list of clients and the stop flag:
+    struct mt_chess_thread_mutex mutex;
+    struct client * clients;
+    bool stop;
+};
+
+/**
+ * - Writes the response line to given buffer and returns its length.
+ */
+static int get_response_line(
+    struct mt_chess_tool_server_response const * const response,
+    char * const out_line,
+    size_t const size)
+{
+    int len = 0;
+
+    if(response->error != NULL)
+    {
+        len = snprintf(
+            out_line,
+            size,
+            "%llu error %s\n",
+            (unsigned long long)response->request->id,
+            response->error);
+    }
+    else
+    {
+        char move[MT_CHESS_MOVE_STR_SIZE] = "";
+
+        if(response->move != 0)
+        {
+            mt_chess_move_get_str(response->move, move);
+        }
+        len = snprintf(
+            out_line,
+            size,
+            "%llu ok%s%s\n",
+            (unsigned long long)response->request->id,
+            response->move != 0 ? " " : "",
+            move);
+    }
+    assert(0 < len && len < (int)size);
+    return len;
+}
+
+/**
+ * - Writes the response line to stdout (for a request without client) with a
+ *   single call, so lines written by different workers do not get mixed, or
+ *   sends it to the client.
+ * - The mutex of the client must be locked by the caller.
+ */
+static void write_response(
+    struct mt_chess_tool_server_response const * const response)
+{
+    char line[128];
+    int const len = get_response_line(response, line, sizeof line);
+    struct client * const client = (struct client *)response->request->client;
+
+    if(client == NULL)
+    {
+        fwrite(line, 1, (size_t)len, stdout);
+        fflush(stdout);
+        return;
+    }
+
+    // (fails, if the client is gone, then there is no one to respond to)
+    //
+    mt_chess_tool_socket_send(&client->socket, line, (size_t)len);
+}
+
+static void on_response(
+    void * const ctx,
+    struct mt_chess_tool_server_response const * const response)
+{
+    struct client * const client = (struct client *)response->request->client;
+
+    (void)ctx;
+
+    if(client == NULL)
+    {
+        write_response(response);
+        return;
+    }
+    mt_chess_thread_mutex_lock(&client->mutex);
+    write_response(response);
+    assert(0 < client->pending);
+    --client->pending;
+    if(client->pending == 0)
+    {
+        mt_chess_thread_cond_signal(&client->idle);
+    }
+    mt_chess_thread_mutex_unlock(&client->mutex);
+}
+
+/**
+ * - Returns NULL on success or an error message.
+ */
+static char const * parse_request(
+    char const * const line,
+    struct mt_chess_tool_server_request * const out_request)
+{
+    char cmd[8];
+    char arg[32] = "";
+    unsigned long long id = 0;
+    unsigned long game = 0;
+
+    int const count = sscanf(
+        line, "%llu %7s %lu %31s", &id, cmd, &game, arg);
+
+    out_request->id = (uint64_t)id;
+    if(count < 3)
+    {
+        return "Expected <id> <command> <game> [<argument>].";
+    }
+    if(MT_CHESS_TOOL_SERVER_MAX_GAMES <= game)
+    {
+        return "Game ID is too big.";
+    }
+    out_request->game = (uint32_t)game;
+    out_request->nodes = s_default_bot_nodes;
+    out_request->move[0] = '\0';
+
+    int c = 0;
+
+    while(c < MT_CHESS_TOOL_SERVER_CMD_COUNT
+        && strcmp(cmd, s_cmd_names[c]) != 0)
+    {
+        ++c;
+    }
+    if(c == MT_CHESS_TOOL_SERVER_CMD_COUNT)
+    {
+        return "Unknown command.";
+    }
+    out_request->cmd = (uint8_t)c;
+
+    if(c == (int)mt_chess_tool_server_cmd_move)
+    {
+        if(count < 4 || MT_CHESS_TOOL_SERVER_MOVE_STR_SIZE <= strlen(arg))
+        {
+            return "Expected move in coordinate notation or SAN.";
+        }
+        strcpy(out_request->move, arg);
+    }
+    if(c == (int)mt_chess_tool_server_cmd_bot && count == 4)
+    {
+        char * end = NULL;
+
+        // (0 would mean no limit at all)
+        //
+        out_request->nodes = (uint64_t)strtoull(arg, &end, 10);
+        if(end == arg || *end != '\0' || out_request->nodes == 0
+            || MT_CHESS_TOOL_SERVER_MAX_BOT_NODES < out_request->nodes)
+        {
+            return "Expected node count of 1 to 1000000.";
+        }
+    }
+    return NULL;
+}
+
+/**
+ * - Submits the request of given line (without line break) from given client
+ *   (NULL for stdin) or responds with an error.
+ * - Returns false, if the line is "quit".
+ */
+static bool handle_line(
+    struct mt_chess_tool_server * const server,
+    struct client * const client,
+    char const * const line)
+{
+    struct mt_chess_tool_server_request request;
+
+    if(strncmp(line, "quit", 4) == 0)
+    {
+        return false;
+    }
+    if(line[0] == '\0')
+    {
+        return true;
+    }
+
+    char const * const error = parse_request(line, &request);
+
+    request.client = client;
+    if(error != NULL)
+    {
+        // (this thread does not share a game with any worker)
+        struct mt_chess_tool_server_response response;
+
+        response.request = &request;
+        response.error = error;
+        response.move = 0;
+        response.legal_count = 0;
+        if(client != NULL)
+        {
+            mt_chess_thread_mutex_lock(&client->mutex);
+        }
+        write_response(&response);
+        if(client != NULL)
+        {
+            mt_chess_thread_mutex_unlock(&client->mutex);
+        }
+        return true;
+    }
+    if(client != NULL)
+    {
+        mt_chess_thread_mutex_lock(&client->mutex);
+        ++client->pending;
+        mt_chess_thread_mutex_unlock(&client->mutex);
+    }
+    mt_chess_tool_server_submit(server, &request);
+    return true;
+}
+
+/**
+ * - Reads the requests of a client until "quit", end of input or the listener
+ *   stopping, waits for the responses and closes the connection.
+ */
+static void run_client(void * const arg)
+{
+    struct client * const client = (struct client *)arg;
+    struct listener * const listener = client->listener;
+    char buf[4096];
+    char line[256];
+    size_t len = 0; // Length of the line read so far.
+    bool is_too_long = false;
+    bool quit = false;
+    size_t count = 0;
+
+    while(!quit
+        && (count = mt_chess_tool_socket_recv(
+            &client->socket, buf, sizeof buf)) != 0)
+    {
+        for(size_t i = 0; i < count && !quit; ++i)
+        {
+            if(buf[i] != '\n')
+            {
+                if(len + 1 < sizeof line)
+                {
+                    line[len++] = buf[i];
+                }
+                else
+                {
+                    is_too_long = true; // (skips the rest of the line)
+                }
+                continue;
+            }
+            if(0 < len && line[len - 1] == '\r')
+            {
+                --len;
+            }
+            line[len] = '\0';
+            if(is_too_long)
+            {
+                // (the beginning holds the ID to respond with)
+                struct mt_chess_tool_server_request request;
+                struct mt_chess_tool_server_response response;
+
+                request.id = (uint64_t)strtoull(line, NULL, 10);
+                request.client = client;
+                response.request = &request;
+                response.error = "Request is too long.";
+                response.move = 0;
+                response.legal_count = 0;
+                mt_chess_thread_mutex_lock(&client->mutex);
+                write_response(&response);
+                mt_chess_thread_mutex_unlock(&client->mutex);
+            }
+            else
+            {
+                quit = !handle_line(listener->server, client, line);
+            }
+            len = 0;
+            is_too_long = false;
+        }
+    }
+
+    mt_chess_thread_mutex_lock(&client->mutex);
+    while(client->pending != 0)
+    {
+        mt_chess_thread_cond_wait(&client->idle, &client->mutex);
+    }
+    mt_chess_thread_mutex_unlock(&client->mutex);
+
+    mt_chess_thread_mutex_lock(&listener->mutex);
+    mt_chess_tool_socket_close(&client->socket);
+    client->done = true;
+    mt_chess_thread_mutex_unlock(&listener->mutex);
+}
+
+/**
+ * - Waits for the thread of given client to return and frees the client.
+ */
+static void free_client(struct client * const client)
+{
+    mt_chess_thread_join(&client->thread);
+    mt_chess_thread_cond_deinit(&client->idle);
+    mt_chess_thread_mutex_deinit(&client->mutex);
+    mt_chess_mem_free(client);
+}
+
+/**
+ * - Frees the clients that are done.
+ * - The mutex of the listener must be locked by the caller.
+ */
+static void free_done_clients(struct listener * const listener)
+{
+    struct client * * next = &listener->clients;
+
+    while(*next != NULL)
+    {
+        struct client * const client = *next;
+
+        if(!client->done)
+        {
+            next = &client->next;
+            continue;
+        }
+        *next = client->next;
+        free_client(client);
+    }
+}
+
+/**
+ * - Accepts connections and starts a thread for each client, until stopped.
+ */
+static void run_listener(void * const arg)
+{
+    struct listener * const listener = (struct listener *)arg;
+
+    while(true)
+    {
+        struct mt_chess_tool_socket socket;
+        bool const accepted =
+            mt_chess_tool_socket_accept(&listener->socket, &socket);
+
+        mt_chess_thread_mutex_lock(&listener->mutex);
+        if(listener->stop)
+        {
+            mt_chess_thread_mutex_unlock(&listener->mutex);
+            if(accepted)
+            {
+                mt_chess_tool_socket_close(&socket); // (see stop_listener())
+            }
+            return;
+        }
+        free_done_clients(listener);
+        if(!accepted)
+        {
+            mt_chess_thread_mutex_unlock(&listener->mutex);
+            continue; // (e.g. the client gave up, before being accepted)
+        }
+
+        struct client * const client =
+            (struct client *)mt_chess_mem_alloc(sizeof *client);
+
+        client->listener = listener;
+        client->socket = socket;
+        mt_chess_thread_mutex_init(&client->mutex);
+        mt_chess_thread_cond_init(&client->idle);
+        client->pending = 0;
+        client->done = false;
+        if(mt_chess_thread_start(&client->thread, run_client, client))
+        {
+            client->next = listener->clients;
+            listener->clients = client;
+        }
+        else
+        {
+            mt_chess_tool_socket_close(&socket);
+            mt_chess_thread_cond_deinit(&client->idle);
+            mt_chess_thread_mutex_deinit(&client->mutex);
+            mt_chess_mem_free(client);
+        }
+        mt_chess_thread_mutex_unlock(&listener->mutex);
+    }
+}
+
+/**
+ * - Creates the socket file at given path and starts accepting connections.
+ * - Returns false on error.
+ */
+static bool start_listener(
+    struct listener * const listener,
+    struct mt_chess_tool_server * const server,
+    char const * const path)
+{
+    listener->server = server;
+    listener->path = path;
+    listener->clients = NULL;
+    listener->stop = false;
+    if(!mt_chess_tool_socket_listen(path, &listener->socket))
+    {
+        return false;
+    }
+    mt_chess_thread_mutex_init(&listener->mutex);
+    if(!mt_chess_thread_start(&listener->thread, run_listener, listener))
+    {
+        mt_chess_thread_mutex_deinit(&listener->mutex);
+        mt_chess_tool_socket_close(&listener->socket);
+        remove(path);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * - Stops accepting connections and reading from the clients, waits for the
+ *   responses to all requests read and removes the socket file.
+ */
+static void stop_listener(struct listener * const listener)
+{
+    mt_chess_thread_mutex_lock(&listener->mutex);
+    listener->stop = true;
+    for(struct client * c = listener->clients; c != NULL; c = c->next)
+    {
+        if(!c->done)
+        {
+            mt_chess_tool_socket_stop_recv(&c->socket);
+        }
+    }
+    mt_chess_thread_mutex_unlock(&listener->mutex);
+
+    // Wakes up the listener waiting for a connection:
+    //
+    struct mt_chess_tool_socket socket;
+
+    if(mt_chess_tool_socket_connect(listener->path, &socket))
+    {
+        mt_chess_tool_socket_close(&socket);
+    }
+    mt_chess_thread_join(&listener->thread);
+
+    while(listener->clients != NULL)
+    {
+        struct client * const client = listener->clients;
+
+        listener->clients = client->next;
+        free_client(client);
+    }
+    mt_chess_thread_mutex_deinit(&listener->mutex);
+    mt_chess_tool_socket_close(&listener->socket);
+    remove(listener->path);
+}
+
+int mt_chess_tool_server_main(int const argc, char * * const argv)
+{
+    int workers = mt_chess_thread_get_cpu_count();
+    int ponder_count = 0;
+    char const * path = NULL;
+
+    if(1 <= argc)
+    {
+        workers = atoi(argv[0]);
+    }
+    if(2 <= argc)
+    {
+        ponder_count = atoi(argv[1]);
+    }
+    if(3 <= argc)
+    {
+        path = argv[2];
+    }
+    if(3 < argc || workers < 1 || ponder_count < 0)
+    {
+        printf("Usage: server [workers] [pondering games] [socket path]\n");
+        return 1;
+    }
+    if(path != NULL && !mt_chess_tool_socket_init())
+    {
+        printf("Error: Sockets are not available!\n");
+        return 1;
+    }
+
+    struct mt_chess_tool_server * const server = mt_chess_tool_server_create(
+        workers, ponder_count, on_response, NULL);
+    struct listener listener;
+
+    if(path != NULL && !start_listener(&listener, server, path))
+    {
+        printf("Error: Failed to listen on \"%s\"!\n", path);
+        mt_chess_tool_server_free(server);
+        mt_chess_tool_socket_deinit();
+        return 1;
+    }
+
+    char line[256];
+
+    while(fgets(line, (int)sizeof line, stdin) == line)
+    {
+        line[strcspn(line, "\r\n")] = '\0';
+        if(!handle_line(server, NULL, line))
+        {
+            break;
+        }
+    }
+
+    if(path != NULL)
+    {
+        stop_listener(&listener);
+    }
+    mt_chess_tool_server_free(server);
+    if(path != NULL)
+    {
+        mt_chess_tool_socket_deinit();
+    }
+    return 0;
+}
@@ -0,0 +1,129 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_TOOL_SERVER
+#define MT_CHESS_TOOL_SERVER
+
+#ifdef __cplusplus
+    #include <cstdint>
+#else //__cplusplus
+    #include <stdint.h>
+#endif //__cplusplus
+
+#include "mt_chess_san.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Game IDs must be less than this.
+//
+#define MT_CHESS_TOOL_SERVER_MAX_GAMES (1 << 20)
+
+// Highest node limit of a bot request, so a single request can not keep its
+// worker (and all games of that worker) busy for long.
+//
+#define MT_CHESS_TOOL_SERVER_MAX_BOT_NODES 1000000
+
+// Count of requests each worker's queue can hold.
+//
+#define MT_CHESS_TOOL_SERVER_QUEUE_LEN 1024
+
+enum mt_chess_tool_server_cmd
+{
+    mt_chess_tool_server_cmd_new = 0, // Starts (or restarts) the game.
+    mt_chess_tool_server_cmd_move = 1, // Validates and applies a move.
+    mt_chess_tool_server_cmd_bot = 2, // Searches and applies a reply.
+    mt_chess_tool_server_cmd_undo = 3, // Takes back the last move.
+    mt_chess_tool_server_cmd_end = 4 // Frees the game.
+};
+
+#define MT_CHESS_TOOL_SERVER_CMD_COUNT 5
+
+// Size of the move of a request, including terminator (SAN may be followed by
+// annotations, e.g. "exd8=Q+!?").
+//
+#define MT_CHESS_TOOL_SERVER_MOVE_STR_SIZE (MT_CHESS_SAN_STR_SIZE + 4)
+
+struct mt_chess_tool_server_request
+{
+    uint64_t id; // Chosen by the client, just handed back with the response.
+    uint64_t submit_ns; // Set by mt_chess_tool_server_submit().
+    // Node limit of the search, 1 to MT_CHESS_TOOL_SERVER_MAX_BOT_NODES (bot
+    // command, only).
+    uint64_t nodes;
+    uint32_t game; // ID of the game.
+    uint8_t cmd; // Holds value of enumeration mt_chess_tool_server_cmd.
+    void * client; // Chosen by the caller, just handed back with the response.
+
+    // Coordinate notation or SAN (move command, only).
+    char move[MT_CHESS_TOOL_SERVER_MOVE_STR_SIZE];
+};
+
+struct mt_chess_tool_server_response
+{
+    struct mt_chess_tool_server_request const * request;
+
+    char const * error; // NULL on success.
+
+    uint16_t move; // Packed move applied (move and bot commands) or 0.
+
+    // Count of legal moves after processing the request, 0 if game is over.
+    int legal_count;
+};
+
+char const * mt_chess_tool_server_get_cmd_name(
+    enum mt_chess_tool_server_cmd const cmd);
+
+/**
+ * - Holds the games and a fixed pool of worker threads.
+ * - Each game belongs to one worker (by game ID), which processes the requests
+ *   of the game in submission order. So there is no lock per game and no
+ *   global lock, just one queue (and lock) per worker.
+ */
+struct mt_chess_tool_server;
+
+/**
+ * - Given function gets called by the worker threads (concurrently!) for each
+ *   processed request. The request pointed to is valid during the call, only.
+ * - At most given count of games ponder at once (0 = no pondering), each on a
+ *   search thread of its own (see mt_chess_ponder.h).
+ * - Free return value via mt_chess_tool_server_free().
+ */
+struct mt_chess_tool_server * mt_chess_tool_server_create(
+    int const worker_count,
+    int const ponder_count,
+    void (*on_response)(
+        void * const ctx,
+        struct mt_chess_tool_server_response const * const response),
+    void * const ctx);
+
+/**
+ * - Processes all requests submitted, before stopping the workers and freeing
+ *   the games.
+ */
+void mt_chess_tool_server_free(struct mt_chess_tool_server * const server);
+
+/**
+ * - Queues a copy of given request (setting its submit time) for the worker
+ *   owning the game.
+ * - Blocks, while the queue of that worker is full.
+ */
+void mt_chess_tool_server_submit(
+    struct mt_chess_tool_server * const server,
+    struct mt_chess_tool_server_request const * const request);
+
+/**
+ * - Command-line entry point ("server [workers] [pondering games] [socket
+ *   path]").
+ * - Reads one request per line from stdin and writes one response per line to
+ *   stdout (see mt_chess_tool_server.c for the format).
+ * - If a path is given, also listens on a local socket created there and
+ *   serves each client connecting the same way on a thread of its own.
+ */
+int mt_chess_tool_server_main(int const argc, char * * const argv);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_TOOL_SERVER
@@ -0,0 +1,235 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200809L // For sockets and MSG_NOSIGNAL.
+#endif //_WIN32
+
+#ifdef _WIN32
+    #include <winsock2.h> // (before anything including windows.h)
+    #include <afunix.h>
+#else //_WIN32
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+#endif //_WIN32
+
+#ifdef __cplusplus
+    #include <cassert>
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstring>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <assert.h>
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <string.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#include "mt_chess_tool_socket.h"
+
+#ifdef _WIN32
+    typedef SOCKET handle_t;
+    typedef int len_t; // Type of the length of send() and recv().
+    typedef int addr_len_t;
+
+    static handle_t const s_invalid = INVALID_SOCKET;
+    static int const s_max_len = INT32_MAX;
+#else //_WIN32
+    typedef int handle_t;
+    typedef size_t len_t;
+    typedef socklen_t addr_len_t;
+
+    static handle_t const s_invalid = -1;
+    static size_t const s_max_len = SIZE_MAX;
+#endif //_WIN32
+
+#ifdef MSG_NOSIGNAL
+    // (a peer having closed the connection must not raise SIGPIPE)
+    static int const s_send_flags = MSG_NOSIGNAL;
+#else //MSG_NOSIGNAL
+    static int const s_send_flags = 0;
+#endif //MSG_NOSIGNAL
+
+/**
+ * - Sets given address to the one of the socket file at given path.
+ * - Returns false, if the path is too long.
+ */
+static bool set_addr(char const * const path, struct sockaddr_un * const addr)
+{
+    size_t const len = strlen(path);
+
+    memset(addr, 0, sizeof *addr);
+    addr->sun_family = AF_UNIX;
+    if(sizeof addr->sun_path <= len)
+    {
+        return false;
+    }
+    memcpy(addr->sun_path, path, len + 1);
+    return true;
+}
+
+static void close_handle(handle_t const handle)
+{
+#ifdef _WIN32
+    closesocket(handle);
+#else //_WIN32
+    close(handle);
+#endif //_WIN32
+}
+
+bool mt_chess_tool_socket_init(void)
+{
+#ifdef _WIN32
+    WSADATA wsa_data;
+
+    return WSAStartup(MAKEWORD(2, 2), &wsa_data) == 0;
+#else //_WIN32
+    return true;
+#endif //_WIN32
+}
+
+void mt_chess_tool_socket_deinit(void)
+{
+#ifdef _WIN32
+    WSACleanup();
+#endif //_WIN32
+}
+
+bool mt_chess_tool_socket_listen(
+    char const * const path, struct mt_chess_tool_socket * const out_listener)
+{
+    assert(path != NULL);
+    assert(out_listener != NULL);
+
+    struct sockaddr_un addr;
+
+    if(!set_addr(path, &addr))
+    {
+        return false;
+    }
+
+    handle_t const handle = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if(handle == s_invalid)
+    {
+        return false;
+    }
+    if(bind(handle, (struct sockaddr const *)&addr, (addr_len_t)sizeof addr)
+            != 0
+        || listen(handle, SOMAXCONN) != 0)
+    {
+        close_handle(handle);
+        return false;
+    }
+    out_listener->handle = handle;
+    return true;
+}
+
+bool mt_chess_tool_socket_connect(
+    char const * const path, struct mt_chess_tool_socket * const out_socket)
+{
+    assert(path != NULL);
+    assert(out_socket != NULL);
+
+    struct sockaddr_un addr;
+
+    if(!set_addr(path, &addr))
+    {
+        return false;
+    }
+
+    handle_t const handle = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if(handle == s_invalid)
+    {
+        return false;
+    }
+    if(connect(
+            handle, (struct sockaddr const *)&addr, (addr_len_t)sizeof addr)
+        != 0)
+    {
+        close_handle(handle);
+        return false;
+    }
+    out_socket->handle = handle;
+    return true;
+}
+
+bool mt_chess_tool_socket_accept(
+    struct mt_chess_tool_socket const * const listener,
+    struct mt_chess_tool_socket * const out_socket)
+{
+    assert(listener != NULL);
+    assert(out_socket != NULL);
+
+    handle_t const handle = accept((handle_t)listener->handle, NULL, NULL);
+
+    if(handle == s_invalid)
+    {
+        return false;
+    }
+    out_socket->handle = handle;
+    return true;
+}
+
+size_t mt_chess_tool_socket_recv(
+    struct mt_chess_tool_socket const * const s,
+    char * const buf,
+    size_t const size)
+{
+    assert(s != NULL);
+    assert(buf != NULL);
+    assert(0 < size);
+
+    len_t const len = (len_t)(size < (size_t)s_max_len ? size : s_max_len);
+    long long const count = (long long)recv((handle_t)s->handle, buf, len, 0);
+
+    return count <= 0 ? 0 : (size_t)count;
+}
+
+bool mt_chess_tool_socket_send(
+    struct mt_chess_tool_socket const * const s,
+    char const * const buf,
+    size_t const size)
+{
+    assert(s != NULL);
+    assert(buf != NULL || size == 0);
+
+    size_t sent = 0;
+
+    while(sent < size)
+    {
+        size_t const left = size - sent;
+        len_t const len = (len_t)(left < (size_t)s_max_len ? left : s_max_len);
+        long long const count = (long long)send(
+            (handle_t)s->handle, buf + sent, len, s_send_flags);
+
+        if(count <= 0)
+        {
+            return false;
+        }
+        sent += (size_t)count;
+    }
+    return true;
+}
+
+void mt_chess_tool_socket_stop_recv(
+    struct mt_chess_tool_socket const * const s)
+{
+    assert(s != NULL);
+
+#ifdef _WIN32
+    shutdown((handle_t)s->handle, SD_RECEIVE);
+#else //_WIN32
+    shutdown(s->handle, SHUT_RD);
+#endif //_WIN32
+}
+
+void mt_chess_tool_socket_close(struct mt_chess_tool_socket const * const s)
+{
+    assert(s != NULL);
+
+    close_handle((handle_t)s->handle);
+}
@@ -0,0 +1,94 @@
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_CHESS_TOOL_SOCKET
+#define MT_CHESS_TOOL_SOCKET
+
+#ifdef __cplusplus
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdbool>
+#else //__cplusplus
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+#endif //__cplusplus
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// Thin wrappers around local (AF_UNIX) stream sockets of Winsock (Windows 10
+// version 1803 or later) or POSIX.
+
+struct mt_chess_tool_socket
+{
+#ifdef _WIN32
+    uintptr_t handle; // (a SOCKET)
+#else //_WIN32
+    int handle;
+#endif //_WIN32
+};
+
+/**
+ * - Must be called once before using any other function.
+ * - Returns false on error.
+ */
+bool mt_chess_tool_socket_init(void);
+
+void mt_chess_tool_socket_deinit(void);
+
+/**
+ * - Creates a socket file at given path (that must not exist) and listens
+ *   for connections to it.
+ * - Returns false on error.
+ */
+bool mt_chess_tool_socket_listen(
+    char const * const path, struct mt_chess_tool_socket * const out_listener);
+
+/**
+ * - Connects to the socket file at given path.
+ * - Returns false on error.
+ */
+bool mt_chess_tool_socket_connect(
+    char const * const path, struct mt_chess_tool_socket * const out_socket);
+
+/**
+ * - Waits for the next connection to given listening socket.
+ * - Returns false on error.
+ */
+bool mt_chess_tool_socket_accept(
+    struct mt_chess_tool_socket const * const listener,
+    struct mt_chess_tool_socket * const out_socket);
+
+/**
+ * - Waits for data and reads at most given count of bytes of it.
+ * - Returns the count of bytes read or 0 on end of input or error.
+ */
+size_t mt_chess_tool_socket_recv(
+    struct mt_chess_tool_socket const * const s,
+    char * const buf,
+    size_t const size);
+
+/**
+ * - Sends all given bytes.
+ * - Returns false on error (e.g. the peer closed the connection).
+ */
+bool mt_chess_tool_socket_send(
+    struct mt_chess_tool_socket const * const s,
+    char const * const buf,
+    size_t const size);
+
+/**
+ * - Stops receiving, making a mt_chess_tool_socket_recv() call waiting on
+ *   another thread return 0. Sending is still possible.
+ */
+void mt_chess_tool_socket_stop_recv(
+    struct mt_chess_tool_socket const * const s);
+
+void mt_chess_tool_socket_close(struct mt_chess_tool_socket const * const s);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //MT_CHESS_TOOL_SOCKET